@@ -0,0 +1,77 @@
+/**
+ * @file medicion.hpp
+ * @brief Timing helpers shared by the benchmark programs
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef MEDICION_HPP
+#define MEDICION_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace Medicion {
+    using Reloj = std::chrono::steady_clock;
+
+    /**
+     * @brief Seconds taken by funcion()
+     */
+    template <typename Funcion>
+    double segundos(Funcion&& funcion) {
+        const auto inicio = Reloj::now();
+        funcion();
+        return std::chrono::duration<double>(Reloj::now() - inicio).count();
+    }
+
+    /**
+     * @brief Best of @p repeticiones runs, in seconds (filters scheduler noise)
+     */
+    template <typename Funcion>
+    double mejorDe(const int repeticiones, Funcion&& funcion) {
+        double mejor = segundos(funcion);
+        for (int i = 1; i < repeticiones; ++i) {
+            const double tiempo = segundos(funcion);
+            if (tiempo < mejor) mejor = tiempo;
+        }
+        return mejor;
+    }
+
+    /**
+     * @brief Size given as first argument, or @p porDefecto
+     */
+    inline std::size_t tamano(const int argc, char** argv, const std::size_t porDefecto) {
+        return argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : porDefecto;
+    }
+
+    /**
+     * @brief Resident memory of the process in bytes (0 where it is not available)
+     */
+    inline std::size_t memoriaResidente() {
+#if defined(__linux__)
+        std::ifstream statm("/proc/self/statm");
+        std::size_t paginas = 0;
+        std::size_t residentes = 0;
+        if (statm >> paginas >> residentes) return residentes * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief Valid article code "<prefijo>-<n>" with @p n zero-padded
+     */
+    inline std::string codigo(const char* prefijo, const std::size_t n) {
+        char texto[24];
+        std::snprintf(texto, sizeof texto, "%s-%07zu", prefijo, n);
+        return texto;
+    }
+}
+
+#endif // MEDICION_HPP
@@ -0,0 +1,124 @@
+/**
+ * @file medir_carga.cpp
+ * @brief Load time, resident memory and teardown of 1M articles: one heap object each vs. slab pools
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Uso: medir_carga [articulos] [individual|pool|inventario]   (por defecto 1000000, las tres)
+ *
+ * - individual: un std::unique_ptr por artículo, como antes de los pools
+ * - pool: los mismos artículos en PoolArticulos (un bloque cada 4096)
+ * - inventario: Inventario::agregarArticulo completo (pools, columnas e índices)
+ *
+ * Cada variante corre en su propio proceso para que la memoria liberada
+ * por una no se reutilice en la siguiente. Los dos tercios son equipos y
+ * un tercio mobiliario; los textos repetidos (técnico, material, fecha)
+ * van a la tabla de símbolos en las tres.
+ */
+
+#include "inventario.hpp"
+#include "medicion.hpp"
+#include "pool_articulos.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    template <typename Crear>
+    void paraCadaArticulo(const std::size_t cantidad, Crear&& crear) {
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            if (i % 3 != 0) {
+                crear(EquipoMedico(Medicion::codigo("EQ", i), "01/02/2020", ArticleStatus::OPERATIONAL,
+                                   100.0 + static_cast<double>(i % 1000), MarcaEquipo::GE, 5,
+                                   "Tecnico " + std::to_string(i % 300), AreaUso::PEDIATRIA));
+            } else {
+                crear(MobiliarioClinico(Medicion::codigo("MB", i), "01/02/2020", ArticleStatus::DAMAGED,
+                                        100.0 + static_cast<double>(i % 1000), "Material " + std::to_string(i % 20),
+                                        AreaUbicacion::CONSULTA));
+            }
+        }
+    }
+
+    void informar(const char* variante, const double carga, const std::size_t antes, const std::size_t despues,
+                  const double liberacion) {
+        std::printf("%-11s %10.3f %12.1f %14.3f\n", variante, carga,
+                    static_cast<double>(despues - antes) / (1024.0 * 1024.0), liberacion);
+    }
+
+    // La memoria se mide antes de liberar: la liberación va aparte
+    void medirIndividual(const std::size_t cantidad) {
+        const std::size_t antes = Medicion::memoriaResidente();
+        auto articulos = std::make_unique<std::vector<std::unique_ptr<Articulo>>>();
+        const double carga = Medicion::segundos([&] {
+            paraCadaArticulo(cantidad, [&](auto&& articulo) {
+                using Tipo = std::decay_t<decltype(articulo)>;
+                articulos->push_back(std::make_unique<Tipo>(std::move(articulo)));
+            });
+        });
+        const std::size_t tras = Medicion::memoriaResidente();
+        const double liberacion = Medicion::segundos([&] { articulos.reset(); });
+        informar("individual", carga, antes, tras, liberacion);
+    }
+
+    void medirPool(const std::size_t cantidad) {
+        const std::size_t antes = Medicion::memoriaResidente();
+        auto equipos = std::make_unique<PoolArticulos<EquipoMedico>>();
+        auto mobiliario = std::make_unique<PoolArticulos<MobiliarioClinico>>();
+        std::vector<Articulo*> articulos;
+        articulos.reserve(cantidad);
+        const double carga = Medicion::segundos([&] {
+            paraCadaArticulo(cantidad, [&](auto&& articulo) {
+                using Tipo = std::decay_t<decltype(articulo)>;
+                if constexpr (std::is_same_v<Tipo, EquipoMedico>) articulos.push_back(&equipos->crear(std::move(articulo)));
+                else articulos.push_back(&mobiliario->crear(std::move(articulo)));
+            });
+        });
+        const std::size_t tras = Medicion::memoriaResidente();
+        const double liberacion = Medicion::segundos([&] {
+            equipos.reset();
+            mobiliario.reset();
+        });
+        informar("pool", carga, antes, tras, liberacion);
+    }
+
+    void medirInventario(const std::size_t cantidad) {
+        const std::size_t antes = Medicion::memoriaResidente();
+        auto inventario = std::make_unique<Inventario>();
+        const double carga = Medicion::segundos([&] {
+            paraCadaArticulo(cantidad, [&](auto&& articulo) { inventario->agregarArticulo(std::move(articulo)); });
+        });
+        if (inventario->obtenerCantidadTotal() != cantidad) {
+            std::fprintf(stderr, "se esperaban %zu articulos y hay %zu\n", cantidad, inventario->obtenerCantidadTotal());
+            std::exit(1);
+        }
+        const std::size_t tras = Medicion::memoriaResidente();
+        const double liberacion = Medicion::segundos([&] { inventario.reset(); });
+        informar("inventario", carga, antes, tras, liberacion);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t cantidad = Medicion::tamano(argc, argv, 1000000);
+    if (argc > 2) {
+        const std::string variante = argv[2];
+        if (variante == "individual") medirIndividual(cantidad);
+        else if (variante == "pool") medirPool(cantidad);
+        else if (variante == "inventario") medirInventario(cantidad);
+        else return 1;
+        return 0;
+    }
+
+    std::printf("%zu articulos (memoria: RSS tras la carga menos RSS inicial)\n", cantidad);
+    std::printf("%-11s %10s %12s %14s\n", "variante", "carga (s)", "memoria (MB)", "liberacion (s)");
+    std::fflush(stdout);
+    for (const char* variante : {"individual", "pool", "inventario"}) {
+        const std::string orden = std::string("\"") + argv[0] + "\" " + std::to_string(cantidad) + " " + variante;
+        if (std::system(orden.c_str()) != 0) return 1;
+    }
+    return 0;
+}
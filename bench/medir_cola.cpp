@@ -0,0 +1,156 @@
+/**
+ * @file medir_cola.cpp
+ * @brief Throughput and enqueue latency of ColaMPSC and AplicadorEventos with 1 to 64 producers
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Uso: medir_cola [eventos]   (por defecto 1000000, repartidos entre los productores)
+ *
+ * Para 1, 2, 4, ... 64 productores se mide primero la cola sola, con un
+ * consumidor que solo la vacía, y después el aplicador sobre un
+ * inventario de 100000 artículos. Cada productor toma el tiempo de cada
+ * publicación (con publicarEsperando, así que incluye las esperas con la
+ * cola llena); el rendimiento cuenta hasta que el consumidor termina.
+ */
+
+#include "aplicador_eventos.hpp"
+#include "cola_mpsc.hpp"
+#include "inventario.hpp"
+#include "medicion.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    constexpr std::size_t ARTICULOS = 100000;
+    constexpr std::size_t CAPACIDAD = AplicadorEventos::CAPACIDAD_POR_DEFECTO;
+
+    struct Resultado {
+        double eventosPorSegundo;
+        double p50;  // nanosegundos
+        double p99;
+        double maximo;
+    };
+
+    // Eventos de cada productor, construidos fuera de la medición
+    std::vector<std::vector<EventoInventario>> prepararEventos(const std::size_t productores, const std::size_t total) {
+        std::vector<std::vector<EventoInventario>> eventos(productores);
+        const ArticleStatus estados[] = {ArticleStatus::OPERATIONAL, ArticleStatus::UNDER_REVIEW, ArticleStatus::DAMAGED};
+        for (std::size_t p = 0; p < productores; ++p) {
+            const std::size_t propios = total / productores;
+            eventos[p].reserve(propios);
+            for (std::size_t i = 0; i < propios; ++i) {
+                const std::size_t articulo = (p * 7919 + i * 31) % ARTICULOS;
+                eventos[p].push_back(EventoInventario::cambioEstado(Medicion::codigo("EQ", articulo), estados[i % 3]));
+            }
+        }
+        return eventos;
+    }
+
+    // Los productores salen juntos y cada uno anota la latencia de cada
+    // publicación; 'terminar' espera al consumidor
+    template <typename Publicar, typename Terminar>
+    Resultado medir(const std::vector<std::vector<EventoInventario>>& eventos, Publicar&& publicar,
+                    Terminar&& terminar) {
+        std::vector<std::vector<std::uint32_t>> latencias(eventos.size());
+        std::atomic<bool> salida{false};
+        std::vector<std::thread> productores;
+        for (std::size_t p = 0; p < eventos.size(); ++p) {
+            productores.emplace_back([&, p] {
+                std::vector<std::uint32_t>& propias = latencias[p];
+                propias.reserve(eventos[p].size());
+                while (!salida.load(std::memory_order_acquire)) std::this_thread::yield();
+                for (const EventoInventario& evento : eventos[p]) {
+                    const auto inicio = Medicion::Reloj::now();
+                    publicar(evento);
+                    const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Medicion::Reloj::now() - inicio);
+                    propias.push_back(static_cast<std::uint32_t>(std::min<long long>(nanos.count(), UINT32_MAX)));
+                }
+            });
+        }
+        const double segundos = Medicion::segundos([&] {
+            salida.store(true, std::memory_order_release);
+            for (std::thread& productor : productores) productor.join();
+            terminar();
+        });
+
+        std::vector<std::uint32_t> todas;
+        for (const std::vector<std::uint32_t>& propias : latencias) todas.insert(todas.end(), propias.begin(), propias.end());
+        const auto percentil = [&todas](const double fraccion) {
+            const auto k = static_cast<std::size_t>(fraccion * static_cast<double>(todas.size() - 1));
+            std::nth_element(todas.begin(), todas.begin() + static_cast<std::ptrdiff_t>(k), todas.end());
+            return static_cast<double>(todas[k]);
+        };
+        const double p50 = percentil(0.50);
+        const double p99 = percentil(0.99);
+        const double maximo = static_cast<double>(*std::max_element(todas.begin(), todas.end()));
+        return {static_cast<double>(todas.size()) / segundos, p50, p99, maximo};
+    }
+
+    Resultado medirCola(const std::vector<std::vector<EventoInventario>>& eventos, const std::size_t total) {
+        ColaMPSC<EventoInventario> cola(CAPACIDAD);
+        std::atomic<bool> fin{false};
+        std::thread consumidor([&] {
+            EventoInventario evento;
+            std::size_t recibidos = 0;
+            while (recibidos < total) {
+                if (cola.intentarDesencolar(evento)) {
+                    ++recibidos;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            fin = true;
+        });
+        const Resultado resultado = medir(eventos,
+            [&cola](const EventoInventario& evento) {
+                while (!cola.intentarEncolar(evento)) std::this_thread::yield();
+            },
+            [&] {
+                while (!fin) std::this_thread::yield();
+            });
+        consumidor.join();
+        return resultado;
+    }
+
+    Resultado medirAplicador(Inventario& inventario, const std::vector<std::vector<EventoInventario>>& eventos) {
+        AplicadorEventos aplicador(inventario, CAPACIDAD);
+        return medir(eventos, [&aplicador](const EventoInventario& evento) { aplicador.publicarEsperando(evento); },
+                     [&aplicador] { aplicador.vaciar(); });
+    }
+
+    void imprimir(const std::size_t productores, const char* que, const Resultado& resultado) {
+        std::printf("%11zu %-10s %14.0f %10.0f %10.0f %12.0f\n", productores, que, resultado.eventosPorSegundo,
+                    resultado.p50, resultado.p99, resultado.maximo);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t eventos = Medicion::tamano(argc, argv, 1000000);
+    if (eventos < 64) return 1;
+    Inventario inventario;
+    inventario.reservar(ARTICULOS);
+    for (std::size_t i = 0; i < ARTICULOS; ++i) {
+        inventario.agregarArticulo(EquipoMedico(Medicion::codigo("EQ", i), "01/01/2020", ArticleStatus::OPERATIONAL,
+                                                100.0 + static_cast<double>(i % 1000), MarcaEquipo::GE, 5, "Ana",
+                                                AreaUso::EMERGENCIA));
+    }
+
+    std::printf("%zu eventos, cola de %zu, %u hilos de hardware\n", eventos, CAPACIDAD,
+                std::thread::hardware_concurrency());
+    std::printf("%11s %-10s %14s %10s %10s %12s\n", "productores", "destino", "eventos/s", "p50 ns", "p99 ns",
+                "max ns");
+    for (std::size_t productores = 1; productores <= 64; productores *= 2) {
+        const auto porProductor = prepararEventos(productores, eventos);
+        const std::size_t total = (eventos / productores) * productores;
+        imprimir(productores, "cola", medirCola(porProductor, total));
+        imprimir(productores, "aplicador", medirAplicador(inventario, porProductor));
+    }
+    return 0;
+}
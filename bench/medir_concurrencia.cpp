@@ -0,0 +1,100 @@
+/**
+ * @file medir_concurrencia.cpp
+ * @brief Write and read throughput of InventarioConcurrente with 0, 1 and 3 concurrent readers
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Uso: medir_concurrencia [articulos]   (por defecto 1000000)
+ *
+ * Un escritor cambia estados al azar durante un segundo mientras los
+ * lectores toman versiones y cuentan artículos dañados (y cada mil
+ * lecturas recorren la versión entera). Al final, 100 lotes de 1000
+ * ediciones con modificar().
+ */
+
+#include "inventario.hpp"
+#include "inventario_concurrente.hpp"
+#include "medicion.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+int main(int argc, char** argv) {
+    const std::size_t cantidad = Medicion::tamano(argc, argv, 1000000);
+    if (cantidad == 0) return 1;
+    const char* const tecnicos[] = {"Ana", "Luis", "Marta"};
+    Inventario inventario;
+    inventario.reservar(cantidad);
+    for (std::size_t i = 0; i < cantidad; ++i) {
+        if (i % 2 != 0) {
+            inventario.agregarArticulo(EquipoMedico(Medicion::codigo("EQ", i), "01/01/2020", ArticleStatus::OPERATIONAL,
+                                                    100.0 + static_cast<double>(i % 1000), MarcaEquipo::GE, 5,
+                                                    tecnicos[i % 3], AreaUso::EMERGENCIA));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico(Medicion::codigo("MB", i), "01/01/2020",
+                                                         ArticleStatus::OPERATIONAL,
+                                                         10.0 + static_cast<double>(i % 5), "madera",
+                                                         AreaUbicacion::CONSULTA));
+        }
+    }
+
+    std::unique_ptr<InventarioConcurrente> concurrente;
+    const double copia = Medicion::segundos([&] { concurrente = std::make_unique<InventarioConcurrente>(inventario); });
+    std::printf("%zu articulos, copia inicial %.3f s\n", cantidad, copia);
+    std::printf("%9s %14s %14s %12s %11s\n", "lectores", "escrituras/s", "lecturas/s", "recorridos", "pendientes");
+
+    for (const int cuantos : {0, 1, 3}) {
+        std::atomic<bool> fin{false};
+        std::atomic<long> lecturas{0};
+        std::atomic<long> recorridos{0};
+        std::vector<std::thread> lectores;
+        for (int r = 0; r < cuantos; ++r) {
+            lectores.emplace_back([&] {
+                long propias = 0;
+                long completos = 0;
+                volatile std::size_t sumidero = 0;
+                while (!fin) {
+                    const LecturaInventario lectura = concurrente->leer();
+                    sumidero = lectura.obtenerCantidadPorEstado(ArticleStatus::DAMAGED);
+                    if (++propias % 1000 == 0) {
+                        lectura.calcularDepreciacionTotal();
+                        ++completos;
+                    }
+                }
+                lecturas += propias;
+                recorridos += completos;
+            });
+        }
+
+        std::mt19937 azar(1);
+        long escrituras = 0;
+        const auto inicio = Medicion::Reloj::now();
+        while (Medicion::Reloj::now() - inicio < std::chrono::seconds(1)) {
+            const std::size_t i = azar() % cantidad;
+            concurrente->actualizarEstado(Medicion::codigo(i % 2 != 0 ? "EQ" : "MB", i),
+                                          azar() % 2 != 0 ? ArticleStatus::DAMAGED : ArticleStatus::UNDER_REVIEW);
+            ++escrituras;
+        }
+        fin = true;
+        for (std::thread& lector : lectores) lector.join();
+        std::printf("%9d %14ld %14ld %12ld %11zu\n", cuantos, escrituras, lecturas.load(), recorridos.load(),
+                    concurrente->obtenerPendientesDeLiberar());
+    }
+
+    std::mt19937 azar(2);
+    const double lotes = Medicion::segundos([&] {
+        for (int lote = 0; lote < 100; ++lote) {
+            concurrente->modificar([&azar, cantidad](EscrituraInventario& escritura) {
+                for (int k = 0; k < 1000; ++k) escritura.editar(azar() % cantidad).SetStatus(ArticleStatus::OPERATIONAL);
+            });
+        }
+    });
+    std::printf("100 lotes de 1000 ediciones: %.3f s\n", lotes);
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file medir_diario.cpp
+ * @brief Cost of journaling mutations and throughput of replaying the journal
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Uso: medir_diario [articulos]   (por defecto 1000000; se hacen dos
+ * cambios de estado por artículo)
+ *
+ * Mide SetStatus con y sin diario abierto, el tiempo de confirmar los
+ * cambios pendientes y la recuperación de snapshot + diario, en registros
+ * aplicados por segundo. El diario se escribe en el directorio temporal.
+ */
+
+#include "inventario.hpp"
+#include "medicion.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    void cargar(Inventario& inventario, const std::size_t cantidad) {
+        inventario.reservar(cantidad);
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            inventario.agregarArticulo(EquipoMedico(Medicion::codigo("EQ", i), "01/01/2020",
+                                                    ArticleStatus::OPERATIONAL,
+                                                    100.0 + static_cast<double>(i % 1000), MarcaEquipo::GE, 5,
+                                                    "Tecnico", AreaUso::EMERGENCIA));
+        }
+    }
+
+    // Orden disperso: cada cambio toca un slot lejano del anterior
+    void cambiarEstados(const std::vector<Articulo*>& articulos, const std::size_t cambios) {
+        for (std::size_t i = 0; i < cambios; ++i) {
+            articulos[(i * 7919u) % articulos.size()]->SetStatus(static_cast<ArticleStatus>(i % 3));
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t cantidad = Medicion::tamano(argc, argv, 1000000);
+    const std::size_t cambios = 2 * cantidad;
+    if (cantidad == 0) return 1;
+    const std::filesystem::path carpeta = std::filesystem::temp_directory_path() / "medir_diario";
+    std::filesystem::remove_all(carpeta);
+    std::filesystem::create_directories(carpeta);
+    const std::string snapshot = (carpeta / "inventario.snap").string();
+
+    double sinDiario = 0.0;
+    {
+        Inventario inventario;
+        cargar(inventario, cantidad);
+        const std::vector<Articulo*> articulos = inventario.obtenerTodosLosArticulos();
+        sinDiario = Medicion::segundos([&] { cambiarEstados(articulos, cambios); });
+    }
+
+    Inventario inventario;
+    inventario.abrirDiario(snapshot);
+    const double altas = Medicion::segundos([&] { cargar(inventario, cantidad); });
+    const std::vector<Articulo*> articulos = inventario.obtenerTodosLosArticulos();
+    const double conDiario = Medicion::segundos([&] { cambiarEstados(articulos, cambios); });
+    const double confirmar = Medicion::segundos([&] { inventario.confirmarCambios(); });
+    const double megasDiario = static_cast<double>(std::filesystem::file_size(snapshot + ".wal")) / 1e6;
+    inventario.cerrarDiario();
+
+    ResultadoRecuperacion resultado;
+    Inventario recuperado;
+    const double recuperacion = Medicion::segundos([&] { resultado = recuperado.abrirDiario(snapshot); });
+    if (recuperado.obtenerCantidadTotal() != cantidad ||
+        resultado.registrosAplicados != cantidad + cambios) {
+        std::fprintf(stderr, "recuperados %zu articulos y %zu registros\n", recuperado.obtenerCantidadTotal(),
+                     resultado.registrosAplicados);
+        return 1;
+    }
+    const double compactar = Medicion::segundos([&] {
+        recuperado.compactarDiario();
+        recuperado.cerrarDiario();  // espera al snapshot en segundo plano
+    });
+    Inventario reabierto;
+    const double apertura = Medicion::segundos([&] { reabierto.abrirDiario(snapshot); });
+    reabierto.cerrarDiario();
+
+    std::printf("%zu articulos, %zu cambios de estado\n", cantidad, cambios);
+    std::printf("  altas con diario            %8.3f s\n", altas);
+    std::printf("  SetStatus sin diario        %8.1f ns/cambio\n", sinDiario / static_cast<double>(cambios) * 1e9);
+    std::printf("  SetStatus con diario        %8.1f ns/cambio\n", conDiario / static_cast<double>(cambios) * 1e9);
+    std::printf("  confirmar pendientes        %8.3f s   (diario de %.1f MB)\n", confirmar, megasDiario);
+    std::printf("  recuperacion                %8.3f s   (%.2f M registros/s)\n", recuperacion,
+                static_cast<double>(resultado.registrosAplicados) / recuperacion / 1e6);
+    std::printf("  compactar y cerrar          %8.3f s\n", compactar);
+    std::printf("  apertura tras compactar     %8.3f s\n", apertura);
+
+    std::filesystem::remove_all(carpeta);
+    return 0;
+}
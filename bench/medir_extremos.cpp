@@ -0,0 +1,69 @@
+/**
+ * @file medir_extremos.cpp
+ * @brief Fused min/max/argmin/argmax kernel against the three-pass standard algorithms
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Uso: medir_extremos [elementos]   (por defecto 1000000)
+ */
+
+#include "medicion.hpp"
+#include "kernels_costos.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    // Lo que hacía obtenerResumenCostos antes del kernel: una pasada por resultado
+    ExtremosCostos tresPasadas(const std::vector<double>& costos) {
+        const auto minimo = std::min_element(costos.begin(), costos.end());
+        const auto maximo = std::max_element(costos.begin(), costos.end());
+        ExtremosCostos r;
+        r.minimo = *minimo;
+        r.maximo = *maximo;
+        r.indiceMinimo = static_cast<std::size_t>(minimo - costos.begin());
+        r.indiceMaximo = static_cast<std::size_t>(maximo - costos.begin());
+        return r;
+    }
+
+    bool iguales(const ExtremosCostos& a, const ExtremosCostos& b) {
+        return a.minimo == b.minimo && a.maximo == b.maximo && a.indiceMinimo == b.indiceMinimo &&
+               a.indiceMaximo == b.indiceMaximo;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t cantidad = Medicion::tamano(argc, argv, 1000000);
+    if (cantidad == 0) return 1;
+    // Costos con dos decimales y muchos repetidos: los empates importan
+    std::vector<double> costos(cantidad);
+    std::mt19937 aleatorio(1);
+    for (double& costo : costos) costo = static_cast<double>(aleatorio() % 100000) / 100.0;
+
+    const ExtremosCostos esperado = tresPasadas(costos);
+    if (!iguales(KernelsCostos::calcularExtremos(costos.data(), cantidad), esperado) ||
+        !iguales(KernelsCostos::calcularExtremosEscalar(costos.data(), cantidad), esperado)) {
+        std::fprintf(stderr, "el kernel no coincide con std::min_element/max_element\n");
+        return 1;
+    }
+
+    constexpr int REPETICIONES = 50;
+    // La escritura volátil impide que el compilador descarte las pasadas
+    volatile std::size_t sumidero = 0;
+    const auto usar = [&sumidero](const ExtremosCostos& r) { sumidero = r.indiceMinimo + r.indiceMaximo; };
+    const double base = Medicion::mejorDe(REPETICIONES, [&] { usar(tresPasadas(costos)); });
+    const double escalar = Medicion::mejorDe(REPETICIONES, [&] {
+        usar(KernelsCostos::calcularExtremosEscalar(costos.data(), cantidad));
+    });
+    const double kernel = Medicion::mejorDe(REPETICIONES, [&] {
+        usar(KernelsCostos::calcularExtremos(costos.data(), cantidad));
+    });
+
+    std::printf("%zu costos\n", cantidad);
+    std::printf("  min_element + max_element   %8.3f ms\n", base * 1e3);
+    std::printf("  una pasada escalar          %8.3f ms  (x%.2f)\n", escalar * 1e3, base / escalar);
+    std::printf("  una pasada %-16s %8.3f ms  (x%.2f)\n", KernelsCostos::varianteActiva(), kernel * 1e3,
+                base / kernel);
+    return 0;
+}
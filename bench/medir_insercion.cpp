@@ -0,0 +1,69 @@
+/**
+ * @file medir_insercion.cpp
+ * @brief Insert and lookup throughput of Inventario at 10k, 100k and 1M articles
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Uso: medir_insercion [maximo]   (por defecto 1000000)
+ *
+ * Los artículos se construyen antes de medir: solo cuenta agregarArticulo
+ * (chequeo de duplicado en el índice de códigos, pools, columnas e
+ * índices secundarios).
+ */
+
+#include "inventario.hpp"
+#include "medicion.hpp"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+int main(int argc, char** argv) {
+    const std::size_t maximo = Medicion::tamano(argc, argv, 1000000);
+    std::printf("%10s %12s %14s %14s\n", "articulos", "alta (s)", "altas/s", "busquedas/s");
+    for (std::size_t cantidad = 10000; cantidad <= maximo; cantidad *= 10) {
+        std::vector<EquipoMedico> equipos;
+        std::vector<MobiliarioClinico> mobiliario;
+        equipos.reserve(cantidad);
+        mobiliario.reserve(cantidad);
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            if (i % 3 != 0) {
+                equipos.emplace_back(Medicion::codigo("EQ", i), "01/02/2020", ArticleStatus::OPERATIONAL,
+                                     100.0 + static_cast<double>(i % 1000), MarcaEquipo::GE, 5,
+                                     "Tecnico " + std::to_string(i % 50), AreaUso::PEDIATRIA);
+            } else {
+                mobiliario.emplace_back(Medicion::codigo("MB", i), "01/02/2020", ArticleStatus::DAMAGED,
+                                        100.0 + static_cast<double>(i % 1000), "Acero", AreaUbicacion::CONSULTA);
+            }
+        }
+
+        Inventario inventario;
+        const double alta = Medicion::segundos([&] {
+            for (EquipoMedico& equipo : equipos) inventario.agregarArticulo(std::move(equipo));
+            for (MobiliarioClinico& mueble : mobiliario) inventario.agregarArticulo(std::move(mueble));
+        });
+        if (inventario.obtenerCantidadTotal() != cantidad) {
+            std::fprintf(stderr, "se esperaban %zu articulos y hay %zu\n", cantidad, inventario.obtenerCantidadTotal());
+            return 1;
+        }
+
+        // Búsquedas aleatorias, la mitad de códigos inexistentes
+        std::mt19937 azar(7);
+        std::vector<std::string> codigos(100000);
+        for (std::size_t i = 0; i < codigos.size(); ++i) {
+            const std::size_t n = azar() % (2 * cantidad);
+            codigos[i] = Medicion::codigo(n % 3 != 0 ? "EQ" : "MB", n);
+        }
+        std::size_t encontrados = 0;
+        const double busqueda = Medicion::mejorDe(3, [&] {
+            encontrados = 0;
+            for (const std::string& codigo : codigos) encontrados += inventario.existeCodigo(codigo) ? 1 : 0;
+        });
+
+        std::printf("%10zu %12.3f %14.0f %14.0f   (%zu encontrados)\n", cantidad, alta,
+                    static_cast<double>(cantidad) / alta, static_cast<double>(codigos.size()) / busqueda,
+                    encontrados);
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file agregacion_paralela.hpp
+ * @brief Chunked parallel reduction with a deterministic merge order
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef AGREGACION_PARALELA_HPP
+#define AGREGACION_PARALELA_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Splits a slot range into fixed blocks and reduces them in parallel
+ *
+ * Block boundaries depend only on the element count, never on the number
+ * of threads, and partial results are merged in block order. A reduction
+ * therefore yields bit-identical floating point results whether it runs
+ * on one core or on many; ranges below the threshold simply run the same
+ * blocks inline.
+ */
+class AgregadorParalelo {
+public:
+    static constexpr std::size_t ELEMENTOS_POR_BLOQUE = 16384;
+    static constexpr std::size_t UMBRAL_POR_DEFECTO = 131072;
+
+    std::size_t umbral() const noexcept { return m_umbral; }
+
+    /**
+     * @brief Minimum element count for which worker threads are used
+     *
+     * Zero forces the parallel path, SIZE_MAX disables it.
+     */
+    void configurarUmbral(const std::size_t umbral) noexcept { m_umbral = umbral; }
+
+    /**
+     * @brief Reduce [0, cantidad) into a single partial
+     *
+     * @param acumular Called as acumular(Parcial&, desde, hasta) on a fresh
+     *        value-initialized partial for every block
+     * @param combinar Called as combinar(Parcial& total, Parcial&& bloque)
+     *        once per block, in ascending block order
+     */
+    template <typename Parcial, typename Acumular, typename Combinar>
+    Parcial reducir(const std::size_t cantidad, Acumular&& acumular, Combinar&& combinar) const {
+        Parcial total{};
+        const std::size_t bloques = (cantidad + ELEMENTOS_POR_BLOQUE - 1) / ELEMENTOS_POR_BLOQUE;
+        const auto procesar = [&](Parcial& parcial, const std::size_t bloque) {
+            const std::size_t desde = bloque * ELEMENTOS_POR_BLOQUE;
+            acumular(parcial, desde, std::min(cantidad, desde + ELEMENTOS_POR_BLOQUE));
+        };
+
+        if (!usarHilos(cantidad, bloques)) {
+            for (std::size_t bloque = 0; bloque < bloques; ++bloque) {
+                Parcial parcial{};
+                procesar(parcial, bloque);
+                combinar(total, std::move(parcial));
+            }
+            return total;
+        }
+
+        std::vector<Parcial> parciales(bloques);
+        repartir(bloques, [&](const std::size_t bloque) { procesar(parciales[bloque], bloque); });
+        for (Parcial& parcial : parciales) {
+            combinar(total, std::move(parcial));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Run procesar(desde, hasta) over every block of [0, cantidad)
+     *
+     * For independent per-slot work that writes disjoint rows.
+     */
+    template <typename Procesar>
+    void paraBloques(const std::size_t cantidad, Procesar&& procesar) const {
+        const std::size_t bloques = (cantidad + ELEMENTOS_POR_BLOQUE - 1) / ELEMENTOS_POR_BLOQUE;
+        const auto procesarBloque = [&](const std::size_t bloque) {
+            const std::size_t desde = bloque * ELEMENTOS_POR_BLOQUE;
+            procesar(desde, std::min(cantidad, desde + ELEMENTOS_POR_BLOQUE));
+        };
+        if (!usarHilos(cantidad, bloques)) {
+            for (std::size_t bloque = 0; bloque < bloques; ++bloque) procesarBloque(bloque);
+            return;
+        }
+        repartir(bloques, procesarBloque);
+    }
+
+    /**
+     * @brief Run tarea(i) for every i in [0, tareas), several at a time
+     *
+     * For coarse independent tasks (one per input chunk); the size
+     * threshold does not apply.
+     */
+    template <typename Tarea>
+    void ejecutar(const std::size_t tareas, Tarea&& tarea) const {
+        if (tareas > 1 && std::thread::hardware_concurrency() > 1) {
+            repartir(tareas, tarea);
+            return;
+        }
+        for (std::size_t i = 0; i < tareas; ++i) tarea(i);
+    }
+
+private:
+    std::size_t m_umbral = UMBRAL_POR_DEFECTO;
+
+    bool usarHilos(const std::size_t cantidad, const std::size_t bloques) const noexcept {
+        return cantidad >= m_umbral && bloques > 1 && std::thread::hardware_concurrency() > 1;
+    }
+
+    // Los hilos toman bloques de un contador compartido; el hilo llamante
+    // también trabaja. La primera excepción se relanza tras el join.
+    template <typename Tarea>
+    static void repartir(const std::size_t bloques, Tarea&& tarea) {
+        std::atomic<std::size_t> siguiente{0};
+        std::exception_ptr error;
+        std::mutex mutexError;
+        const auto trabajar = [&]() noexcept {
+            for (std::size_t bloque = siguiente.fetch_add(1); bloque < bloques; bloque = siguiente.fetch_add(1)) {
+                try {
+                    tarea(bloque);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutexError);
+                    if (!error) error = std::current_exception();
+                    siguiente.store(bloques);
+                }
+            }
+        };
+
+        const std::size_t hilos = std::min<std::size_t>(std::thread::hardware_concurrency(), bloques);
+        std::vector<std::thread> trabajadores;
+        trabajadores.reserve(hilos - 1);
+        for (std::size_t i = 1; i < hilos; ++i) {
+            try {
+                trabajadores.emplace_back(trabajar);
+            } catch (const std::system_error&) {
+                break;  // Sin más hilos: los bloques restantes los cubren los ya creados
+            }
+        }
+        trabajar();
+        for (std::thread& hilo : trabajadores) hilo.join();
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+#endif // AGREGACION_PARALELA_HPP
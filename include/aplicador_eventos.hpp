@@ -0,0 +1,123 @@
+/**
+ * @file aplicador_eventos.hpp
+ * @brief Background thread that applies queued events to an inventory in batches
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef APLICADOR_EVENTOS_HPP
+#define APLICADOR_EVENTOS_HPP
+
+#include "cola_mpsc.hpp"
+#include "evento_inventario.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Inventario;
+class InventarioConcurrente;
+
+struct EstadisticasAplicador {
+    std::uint64_t aplicados = 0;     ///< Events whose article was found
+    std::uint64_t desconocidos = 0;  ///< Events for codes not in the inventory
+    std::uint64_t lotes = 0;
+    std::uint64_t rechazados = 0;    ///< publicar() calls that found the queue full
+};
+
+/**
+ * @brief Many threads report changes, one thread applies them
+ *
+ * Producers (scanner and nurse-station handlers) call publicar(), which
+ * only claims a slot in a bounded lock-free queue. A single applier thread
+ * drains up to @c tamanoLote events at a time and applies the batch in one
+ * pass: on an Inventario through Inventario::aplicarEventos(), which keeps
+ * its indexes, counters and journal up to date; on an InventarioConcurrente
+ * as one published version, so readers see whole batches.
+ *
+ * While the applier runs it is the only thread that may touch an
+ * Inventario (an InventarioConcurrente stays readable from any thread).
+ * Events from one producer are applied in the order it published them.
+ * If applying a batch throws, the applier stops and vaciar() or detener()
+ * rethrow the exception.
+ */
+class AplicadorEventos {
+public:
+    static constexpr std::size_t CAPACIDAD_POR_DEFECTO = 65536;
+    static constexpr std::size_t LOTE_POR_DEFECTO = 512;
+
+    explicit AplicadorEventos(Inventario& inventario, std::size_t capacidad = CAPACIDAD_POR_DEFECTO,
+                              std::size_t tamanoLote = LOTE_POR_DEFECTO);
+    explicit AplicadorEventos(InventarioConcurrente& inventario, std::size_t capacidad = CAPACIDAD_POR_DEFECTO,
+                              std::size_t tamanoLote = LOTE_POR_DEFECTO);
+
+    /**
+     * Applies what is still queued and joins the thread; errors are dropped.
+     */
+    ~AplicadorEventos();
+
+    AplicadorEventos(const AplicadorEventos&) = delete;
+    AplicadorEventos& operator=(const AplicadorEventos&) = delete;
+
+    /**
+     * @brief Queue an event without blocking
+     * @return false if the queue is full or the applier stopped
+     */
+    bool publicar(const EventoInventario& evento) noexcept;
+
+    /**
+     * @brief Queue an event, yielding while the queue is full
+     * @return false only if the applier stopped
+     */
+    bool publicarEsperando(const EventoInventario& evento) noexcept;
+
+    /**
+     * @brief Wait until every event published before the call was applied
+     * @throws whatever the applier threw while applying a batch
+     */
+    void vaciar();
+
+    /**
+     * @brief Apply the remaining events and stop the thread
+     *
+     * Events published concurrently with the call may be dropped.
+     * @throws whatever the applier threw while applying a batch
+     */
+    void detener();
+
+    EstadisticasAplicador obtenerEstadisticas() const;
+
+private:
+    using Aplicar = std::function<std::size_t(const std::vector<EventoInventario>&)>;
+
+    AplicadorEventos(Aplicar aplicar, std::size_t capacidad, std::size_t tamanoLote);
+
+    ColaMPSC<EventoInventario> m_cola;
+    Aplicar m_aplicar;
+    std::size_t m_tamanoLote;
+
+    std::atomic<std::uint64_t> m_rechazados{0};
+    std::atomic<bool> m_detener{false};
+    std::atomic<bool> m_detenido{false};
+    std::atomic<bool> m_esperando{false};  // el aplicador duerme: hay que despertarlo
+
+    mutable std::mutex m_mutex;  // contadores del aplicador, error y esperas
+    std::condition_variable m_hayEventos;
+    std::condition_variable m_vaciado;
+    std::uint64_t m_procesados = 0;
+    std::uint64_t m_aplicados = 0;
+    std::uint64_t m_lotes = 0;
+    std::exception_ptr m_error;
+    std::thread m_hilo;
+
+    void bucle();
+    void despertar() noexcept;
+    void lanzarError();
+};
+
+#endif // APLICADOR_EVENTOS_HPP
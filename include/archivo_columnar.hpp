@@ -0,0 +1,275 @@
+/**
+ * @file archivo_columnar.hpp
+ * @brief Compressed column-oriented archive of the inventory
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef ARCHIVO_COLUMNAR_HPP
+#define ARCHIVO_COLUMNAR_HPP
+
+#include "articulo.hpp"
+#include "archivo_mapeado.hpp"
+#include "contadores_inventario.hpp"
+#include "equipo_medico.hpp"
+#include "kernels_costos.hpp"
+#include "mobiliario_clinico.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * File layout (little-endian):
+ *
+ *   CabeceraColumnar                         40 bytes
+ *   DescriptorColumna[cantidadColumnas]      32 bytes each
+ *   column payloads, in directory order
+ *
+ * Every column holds one value per article, in slot order, and has its
+ * own checksum. Inside a payload each section is prefixed by its length
+ * as a varint. Integer sections use the block codec: values are cut into
+ * blocks of FILAS_POR_BLOQUE and each block is stored as its minimum
+ * (varint), a bit width and the packed offsets from that minimum. A
+ * block of equal values therefore takes two bytes.
+ *
+ * Per-column encodings (CodificacionColumna):
+ *   DICCIONARIO_ENTEROS  varint size, section of distinct values, section of codes
+ *   DICCIONARIO_TEXTOS   varint size, section of lengths, section of bytes, section of codes
+ *   PREFIJOS             shared-prefix lengths, suffix lengths, suffix bytes
+ *   DELTA                zigzag differences with the previous row
+ *   CENTESIMAS           zigzag cost in hundredths (fixed point)
+ *   IEEE                 raw bits of the double, when a cost has no exact
+ *                        fixed-point form
+ *
+ * Signed values are zigzag-mapped before packing.
+ */
+namespace FormatoColumnar {
+    constexpr char FIRMA[8] = {'H', 'I', 'N', 'V', 'C', 'O', 'L', '1'};
+    constexpr std::uint32_t VERSION = 1;
+    constexpr std::size_t FILAS_POR_BLOQUE = 128;
+}
+
+enum class ColumnaArchivo : std::uint8_t {
+    CODIGO,
+    TIPO,
+    ESTADO,
+    MARCA,       ///< Zero for furniture
+    AREA,        ///< Usage area of equipment, location of furniture
+    VIDA_UTIL,   ///< Zero for furniture
+    COSTO,       ///< Unit cost
+    FECHA,       ///< Entry date as a day number
+    TEXTO        ///< Technician of equipment, material of furniture
+};
+
+enum class CodificacionColumna : std::uint8_t {
+    DICCIONARIO_ENTEROS = 1,
+    DICCIONARIO_TEXTOS,
+    PREFIJOS,
+    DELTA,
+    CENTESIMAS,
+    IEEE
+};
+
+namespace FormatoColumnar {
+    constexpr std::size_t COLUMNAS = 9;
+
+    using Mascara = std::uint32_t;  ///< Set of columns, one bit per ColumnaArchivo
+
+    constexpr Mascara mascara(const ColumnaArchivo columna) noexcept {
+        return Mascara{1} << static_cast<unsigned>(columna);
+    }
+
+    constexpr Mascara TODAS = (Mascara{1} << COLUMNAS) - 1;
+}
+
+struct CabeceraColumnar {
+    char firma[8];
+    std::uint32_t version;
+    std::uint32_t marcaOrden;
+    std::uint64_t cantidadArticulos;
+    std::uint32_t cantidadColumnas;
+    std::uint32_t reservado;
+    std::uint64_t sumaDirectorio;  ///< Checksum of the descriptors
+};
+
+struct DescriptorColumna {
+    std::uint8_t columna;        ///< ColumnaArchivo
+    std::uint8_t codificacion;   ///< CodificacionColumna
+    std::uint16_t reservado;
+    std::uint32_t reservado2;
+    std::uint64_t desplazamiento;
+    std::uint64_t bytes;
+    std::uint64_t sumaVerificacion;
+};
+
+static_assert(sizeof(CabeceraColumnar) == 40, "Cabecera columnar con relleno inesperado");
+static_assert(sizeof(DescriptorColumna) == 32, "Descriptor de columna con relleno inesperado");
+
+/**
+ * @brief Collects articles column by column and writes them encoded
+ */
+class EscritorColumnar {
+public:
+    explicit EscritorColumnar(std::size_t cantidadEstimada = 0);
+
+    void agregar(const Articulo& articulo);
+
+    /**
+     * @brief Encode every column and replace @p ruta atomically
+     * @throws std::runtime_error on I/O failure; the old file is left intact
+     */
+    void escribir(const std::string& ruta) const;
+
+private:
+    // Códigos en codificación de prefijos, ya comprimidos al agregar
+    std::vector<std::uint64_t> m_prefijos;
+    std::vector<std::uint64_t> m_longitudesSufijo;
+    std::string m_sufijos;
+    std::string m_codigoAnterior;
+
+    std::vector<std::uint8_t> m_tipos;
+    std::vector<std::uint8_t> m_estados;
+    std::vector<std::uint8_t> m_marcas;
+    std::vector<std::uint8_t> m_areas;
+    std::vector<std::int32_t> m_vidasUtiles;
+    std::vector<double> m_costos;
+    std::vector<std::int32_t> m_dias;
+    std::vector<TablaSimbolos::Id> m_textos;
+};
+
+/**
+ * @brief One block of decoded rows
+ *
+ * Only the columns requested from the cursor are filled. Codes view a
+ * buffer of the cursor and are valid until its next call; @c texto holds
+ * dictionary entries resolved with LectorColumnar::texto().
+ */
+struct BloqueColumnar {
+    static constexpr std::size_t FILAS = FormatoColumnar::FILAS_POR_BLOQUE;
+
+    std::size_t primeraFila = 0;
+    std::size_t cantidad = 0;
+    std::array<std::string_view, FILAS> codigo;
+    std::array<std::uint8_t, FILAS> tipo;
+    std::array<std::uint8_t, FILAS> estado;
+    std::array<std::uint8_t, FILAS> marca;
+    std::array<std::uint8_t, FILAS> area;
+    std::array<std::int32_t, FILAS> vidaUtilAnios;
+    std::array<double, FILAS> costoUnitario;
+    std::array<std::int32_t, FILAS> diaIngreso;
+    std::array<std::uint32_t, FILAS> texto;
+};
+
+class CursorColumnar;
+
+/**
+ * @brief Maps an archive and answers aggregates straight from its columns
+ *
+ * The constructor checks signature, version, byte order, the directory
+ * and every column checksum, and loads the dictionaries. Scans decode
+ * only the columns they use, one block at a time, and never build
+ * Articulo objects; malformed column contents found while decoding throw
+ * std::runtime_error.
+ *
+ * Costs in the aggregates are unit (acquisition) costs, which unlike the
+ * depreciated value do not depend on the date the archive is read.
+ */
+class LectorColumnar {
+public:
+    /**
+     * @throws std::runtime_error if the file is missing, truncated or corrupt
+     */
+    explicit LectorColumnar(const std::string& ruta);
+
+    std::size_t size() const noexcept { return m_cantidad; }
+    const std::string& ruta() const noexcept { return m_ruta; }
+
+    /**
+     * @brief Technician or material behind a BloqueColumnar::texto entry
+     */
+    std::string_view texto(const std::uint32_t entrada) const noexcept { return m_textos[entrada]; }
+    std::size_t cantidadTextos() const noexcept { return m_textos.size(); }
+
+    /**
+     * @brief Counts and unit-cost sums per type and per status
+     */
+    ContadoresInventario resumirPorTipoYEstado() const;
+
+    std::map<std::string, int> contarEquiposPorTecnico() const;
+    std::map<AreaUso, int> contarEquiposPorArea() const;
+    std::map<AreaUbicacion, int> contarMobiliarioPorArea() const;
+    std::map<MarcaEquipo, int> contarEquiposPorMarca() const;
+
+    /**
+     * @brief Articles whose entry day lies in [diaDesde, diaHasta]
+     */
+    std::size_t contarIngresosEntre(std::int32_t diaDesde, std::int32_t diaHasta) const;
+
+    /**
+     * @brief Lowest and highest unit cost and the first row holding each
+     *
+     * An archive has no cost index, so this scans the COSTO column with
+     * KernelsCostos::calcularExtremos block by block. Zeros if empty.
+     */
+    ExtremosCostos obtenerExtremosCostos() const;
+
+private:
+    friend class CursorColumnar;
+
+    struct Seccion {
+        const unsigned char* datos = nullptr;
+        std::size_t bytes = 0;
+    };
+
+    struct Columna {
+        CodificacionColumna codificacion{};
+        Seccion filas;        ///< Per-row values or dictionary codes (prefix lengths for CODIGO)
+        Seccion longitudes;   ///< Suffix lengths of CODIGO
+        Seccion bytes;        ///< Suffix bytes of CODIGO
+    };
+
+    std::string m_ruta;
+    ArchivoMapeado m_archivo;
+    std::size_t m_cantidad = 0;
+    std::array<Columna, FormatoColumnar::COLUMNAS> m_columnas{};
+    std::array<std::vector<std::int64_t>, FormatoColumnar::COLUMNAS> m_diccionarios;  ///< Integer columns
+    std::vector<std::string_view> m_textos;  ///< Dictionary of the TEXTO column, viewing the mapping
+
+    std::array<int, 256> contarPorValor(ColumnaArchivo columna, MedicalInventory::Domain::ArticleType tipo) const;
+};
+
+/**
+ * @brief Sequential block decoder over a subset of columns
+ *
+ * Asking for AREA, MARCA, VIDA_UTIL or TEXTO also decodes TIPO, which
+ * tells how to read them.
+ */
+class CursorColumnar {
+public:
+    CursorColumnar(const LectorColumnar& lector, FormatoColumnar::Mascara columnas);
+    ~CursorColumnar();
+
+    CursorColumnar(const CursorColumnar&) = delete;
+    CursorColumnar& operator=(const CursorColumnar&) = delete;
+
+    /**
+     * @brief Decode the next rows; false once every row was returned
+     * @throws std::runtime_error if a column is malformed
+     */
+    bool siguiente(BloqueColumnar& bloque);
+
+private:
+    struct Estado;
+
+    const LectorColumnar& m_lector;
+    FormatoColumnar::Mascara m_columnas;
+    std::size_t m_fila = 0;
+    std::unique_ptr<Estado> m_estado;  // decodificadores de cada columna pedida
+};
+
+#endif // ARCHIVO_COLUMNAR_HPP
@@ -0,0 +1,45 @@
+/**
+ * @file archivo_mapeado.hpp
+ * @brief Read-only memory-mapped file
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef ARCHIVO_MAPEADO_HPP
+#define ARCHIVO_MAPEADO_HPP
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Maps a whole file read-only for the lifetime of the object
+ *
+ * Uses mmap on POSIX systems and CreateFileMapping/MapViewOfFile on
+ * Windows. An empty file maps to a null pointer with size 0.
+ */
+class ArchivoMapeado {
+public:
+    ArchivoMapeado() = default;
+
+    /**
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit ArchivoMapeado(const std::string& ruta);
+    ~ArchivoMapeado();
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+    ArchivoMapeado(ArchivoMapeado&& otro) noexcept;
+    ArchivoMapeado& operator=(ArchivoMapeado&& otro) noexcept;
+
+    const unsigned char* datos() const noexcept { return m_datos; }
+    std::size_t size() const noexcept { return m_tamano; }
+
+private:
+    const unsigned char* m_datos = nullptr;
+    std::size_t m_tamano = 0;
+
+    void liberar() noexcept;
+};
+
+#endif // ARCHIVO_MAPEADO_HPP
@@ -0,0 +1,95 @@
+/**
+ * @file archivo_secuencial.hpp
+ * @brief Append-only file with explicit durability points
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef ARCHIVO_SECUENCIAL_HPP
+#define ARCHIVO_SECUENCIAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+/**
+ * @brief Unbuffered sequential writer over an OS file handle
+ *
+ * Unlike std::ofstream it can force written data to stable storage
+ * (fsync on POSIX, FlushFileBuffers on Windows) and truncate the file,
+ * which the journal needs to drop a torn tail after a crash.
+ */
+class ArchivoSecuencial {
+public:
+    enum class Modo {
+        CREAR,   ///< Create or truncate
+        ANEXAR   ///< Open or create, writing at the end
+    };
+
+    struct Tramo {
+        const void* datos;
+        std::size_t bytes;
+    };
+
+    ArchivoSecuencial() = default;
+
+    /**
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    ArchivoSecuencial(const std::string& ruta, Modo modo);
+    ~ArchivoSecuencial();
+
+    ArchivoSecuencial(const ArchivoSecuencial&) = delete;
+    ArchivoSecuencial& operator=(const ArchivoSecuencial&) = delete;
+    ArchivoSecuencial(ArchivoSecuencial&& otro) noexcept;
+    ArchivoSecuencial& operator=(ArchivoSecuencial&& otro) noexcept;
+
+    bool abierto() const noexcept;
+    std::uint64_t size() const noexcept { return m_tamano; }
+
+    /**
+     * @throws std::runtime_error on a short or failed write
+     */
+    void escribir(const void* datos, std::size_t bytes);
+
+    /**
+     * @brief Block until everything written so far is on stable storage
+     */
+    void sincronizar();
+
+    /**
+     * @brief Cut the file to @p tamano bytes; later writes append there
+     */
+    void truncar(std::uint64_t tamano);
+
+    void cerrar() noexcept;
+
+    /**
+     * @brief Make a rename or creation inside the directory of @p ruta durable
+     *
+     * No-op on Windows, where metadata updates are journaled by NTFS.
+     */
+    static void sincronizarDirectorio(const std::string& ruta);
+
+    /**
+     * @brief Write @p tramos to @p ruta + ".tmp", sync it and rename it over @p ruta
+     *
+     * After a power loss either the previous file or the complete new one
+     * is found, never a partial one.
+     *
+     * @throws std::runtime_error on I/O failure; the previous file is left intact
+     */
+    static void reemplazar(const std::string& ruta, std::initializer_list<Tramo> tramos);
+
+private:
+    std::string m_ruta;
+#ifdef _WIN32
+    void* m_handle = nullptr;
+#else
+    int m_descriptor = -1;
+#endif
+    std::uint64_t m_tamano = 0;
+};
+
+#endif // ARCHIVO_SECUENCIAL_HPP
@@ -8,9 +8,16 @@
 #ifndef ARTICULO_HPP
 #define ARTICULO_HPP
 
+#include "tabla_simbolos.hpp"
+#include "fecha.hpp"
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <stdexcept>
+#include <cstdint>
+#include <utility>
+
+class Articulo;
 
 namespace MedicalInventory {
     namespace Domain {
@@ -31,6 +38,37 @@ namespace MedicalInventory {
             DAMAGED
         };
 
+        constexpr std::size_t ARTICLE_TYPE_COUNT = 2;    ///< Values of ArticleType
+        constexpr std::size_t ARTICLE_STATUS_COUNT = 3;  ///< Values of ArticleStatus
+
+        /**
+         * @brief Kind of mutation reported to an ArticleObserver
+         */
+        enum class ArticleChange : std::uint8_t {
+            STATUS,
+            COST,
+            LOCATION,
+            USEFUL_LIFE,
+            TECHNICIAN,
+            MATERIAL
+        };
+
+        /**
+         * @brief Receives notifications when an owned article is mutated
+         *
+         * Implemented by containers that keep derived state (indexes,
+         * columns, counters) about the articles they own. Notifications
+         * are delivered after the article has been updated. An observer
+         * that throws (e.g. std::bad_alloc while growing an index) must
+         * leave its own state as it was; the setter then restores the
+         * previous value and rethrows, so a failed setter changes nothing.
+         */
+        class ArticleObserver {
+        public:
+            virtual ~ArticleObserver() = default;
+            virtual void OnArticleChanged(const Articulo& article, ArticleChange change) = 0;
+        };
+
         namespace Validation {
             /**
              * @brief Validation constants
@@ -53,13 +91,18 @@ class Articulo {
 public:
     using ArticleType = MedicalInventory::Domain::ArticleType;
     using ArticleStatus = MedicalInventory::Domain::ArticleStatus;
+    using ArticleChange = MedicalInventory::Domain::ArticleChange;
+    using ArticleObserver = MedicalInventory::Domain::ArticleObserver;
 
 protected:
     std::string m_code;              ///< Unique article identifier
     ArticleType m_type;              ///< Type of article (equipment/furniture)
-    std::string m_entryDate;         ///< Date of entry into inventory
+    TablaSimbolos::Id m_entryDateId; ///< Interned date of entry into inventory
+    std::int32_t m_entryDay;         ///< Entry date as a day number (parsed once)
     ArticleStatus m_status;          ///< Current operational status
     double m_unitCost;               ///< Base unit cost
+    ArticleObserver* m_observer = nullptr;  ///< Owning container, if any
+    std::uint32_t m_slot = 0;        ///< Position assigned by the owner
 
 public:
     /**
@@ -71,9 +114,9 @@ public:
      * @param unitCost Base unit cost
      * @throws std::invalid_argument if parameters are invalid
      */
-    Articulo(const std::string& code, 
+    Articulo(std::string_view code, 
              ArticleType type, 
-             const std::string& entryDate,
+             std::string_view entryDate,
              ArticleStatus status, 
              double unitCost);
     
@@ -86,9 +129,24 @@ public:
     Articulo(const Articulo&) = delete;
     Articulo& operator=(const Articulo&) = delete;
     
-    // Enable move semantics
-    Articulo(Articulo&&) = default;
-    Articulo& operator=(Articulo&&) = default;
+    /**
+     * @brief Move the article's data; the new object starts detached
+     *
+     * The observer and slot belong to the object the container owns, so
+     * they are not carried over: a copy moved out of an inventory does not
+     * report its changes to that inventory's slot.
+     */
+    Articulo(Articulo&& otro) noexcept
+        : m_code(std::move(otro.m_code)),
+          m_type(otro.m_type),
+          m_entryDateId(otro.m_entryDateId),
+          m_entryDay(otro.m_entryDay),
+          m_status(otro.m_status),
+          m_unitCost(otro.m_unitCost) {}
+
+    // Overwriting an owned article in place would bypass the indexes its
+    // container keeps on the code and fields
+    Articulo& operator=(Articulo&&) = delete;
     
     // Accessor methods (const-correct)
     /**
@@ -107,7 +165,19 @@ public:
      * @brief Get entry date
      * @return Date string in DD/MM/YYYY format
      */
-    const std::string& GetEntryDate() const noexcept { return m_entryDate; }
+    const std::string& GetEntryDate() const noexcept { return TablaSimbolos::global().texto(m_entryDateId); }
+    
+    /**
+     * @brief Get interned id of the entry date
+     * @return Id in TablaSimbolos::global()
+     */
+    TablaSimbolos::Id GetEntryDateId() const noexcept { return m_entryDateId; }
+    
+    /**
+     * @brief Get entry date as a compact day number
+     * @return Days since 01/01/1970 (see Fecha::diasDesdeCivil)
+     */
+    std::int32_t GetEntryDay() const noexcept { return m_entryDay; }
     
     /**
      * @brief Get current status
@@ -121,17 +191,35 @@ public:
      */
     double GetUnitCost() const noexcept { return m_unitCost; }
     
+    /**
+     * @brief Get the position assigned by the owning container
+     * @return Slot index (meaningful only while an observer is attached)
+     */
+    std::uint32_t GetSlot() const noexcept { return m_slot; }
+    
+    /**
+     * @brief Attach the container that must be told about mutations
+     * @param observer Observer to notify (nullptr detaches)
+     * @param slot Position of this article inside the observer
+     */
+    void AttachObserver(ArticleObserver* observer, std::uint32_t slot) noexcept {
+        m_observer = observer;
+        m_slot = slot;
+    }
+    
     // Mutator methods with validation
     /**
      * @brief Set article status
      * @param newStatus New status to set
+     * @throws whatever the observer throws; the status is then left unchanged
      */
-    void SetStatus(ArticleStatus newStatus) noexcept { m_status = newStatus; }
+    void SetStatus(ArticleStatus newStatus) { AssignAndNotify(m_status, newStatus, ArticleChange::STATUS); }
     
     /**
      * @brief Set unit cost with validation
      * @param newCost New unit cost
-     * @throws std::invalid_argument if cost is invalid
+     * @throws std::invalid_argument if cost is invalid, or whatever the
+     *         observer throws; the cost is then left unchanged
      */
     void SetUnitCost(double newCost);
     
@@ -164,20 +252,32 @@ public:
     static std::string StatusToString(ArticleStatus status);
     
     /**
-     * @brief Convert string to article type
+     * @brief Display name of an article type, without allocating
+     * @return View of static storage
+     */
+    static std::string_view TypeName(ArticleType type) noexcept;
+    
+    /**
+     * @brief Display name of an article status, without allocating
+     * @return View of static storage
+     */
+    static std::string_view StatusName(ArticleStatus status) noexcept;
+    
+    /**
+     * @brief Convert string to article type (Spanish or English spelling, any case)
      * @param str String representation
      * @return Article type enumeration
      * @throws std::invalid_argument if string is invalid
      */
-    static ArticleType StringToType(const std::string& str);
+    static ArticleType StringToType(std::string_view str);
     
     /**
-     * @brief Convert string to article status
+     * @brief Convert string to article status (Spanish or English spelling, any case)
      * @param str String representation
      * @return Article status enumeration
      * @throws std::invalid_argument if string is invalid
      */
-    static ArticleStatus StringToStatus(const std::string& str);
+    static ArticleStatus StringToStatus(std::string_view str);
     
     // Validation methods
     /**
@@ -185,14 +285,14 @@ public:
      * @param code Code to validate
      * @return true if valid, false otherwise
      */
-    static bool IsValidCode(const std::string& code);
+    static bool IsValidCode(std::string_view code) noexcept;
     
     /**
      * @brief Validate date format (DD/MM/YYYY)
      * @param date Date string to validate
      * @return true if valid, false otherwise
      */
-    static bool IsValidDate(const std::string& date);
+    static bool IsValidDate(std::string_view date) noexcept;
     
     /**
      * @brief Validate cost value
@@ -246,6 +346,33 @@ public:
     [[deprecated("Use StringToStatus() instead")]]
     static ArticleStatus stringToEstado(const std::string& str) { return StringToStatus(str); }
 
+protected:
+    /**
+     * @brief Tell the attached observer (if any) that this article changed
+     * @param change Kind of mutation that was applied
+     */
+    void NotifyChange(ArticleChange change) const {
+        if (m_observer) m_observer->OnArticleChanged(*this, change);
+    }
+
+    /**
+     * @brief Set a field and notify; if the observer throws, restore it and rethrow
+     * @param field Member to update
+     * @param value New value
+     * @param change Kind of mutation to report
+     */
+    template <typename Field>
+    void AssignAndNotify(Field& field, Field value, ArticleChange change) {
+        const Field previous = field;
+        field = value;
+        try {
+            NotifyChange(change);
+        } catch (...) {
+            field = previous;
+            throw;
+        }
+    }
+
 private:
     /**
      * @brief Validate constructor parameters
@@ -254,8 +381,8 @@ private:
      * @param unitCost Unit cost
      * @throws std::invalid_argument if any parameter is invalid
      */
-    void ValidateParameters(const std::string& code, 
-                           const std::string& entryDate, 
+    void ValidateParameters(std::string_view code, 
+                           std::string_view entryDate, 
                            double unitCost) const;
 };
 
@@ -0,0 +1,225 @@
+/**
+ * @file codec_enums.hpp
+ * @brief Table-driven text codec for the inventory enumerations
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef CODEC_ENUMS_HPP
+#define CODEC_ENUMS_HPP
+
+#include "articulo.hpp"
+#include "equipo_medico.hpp"
+#include "mobiliario_clinico.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * @brief Display names and alias parsing for one enumeration
+ *
+ * nombre() is a table lookup returning a view of static storage. parsear()
+ * matches the registered aliases either exactly or case-insensitively,
+ * as chosen per codec. When folding, ASCII letters and the UTF-8 Latin-1
+ * capitals (Á, É, Í, Ó, Ú, Ñ...) are folded byte by byte while hashing,
+ * so the input is never copied. The alias table is a perfect hash whose
+ * seed is searched at compile time; a lookup is one hash, one slot and
+ * one comparison.
+ *
+ * @tparam Enum Enumeration with consecutive values starting at 0
+ * @tparam VALORES Number of enumerators
+ * @tparam ALIAS Number of accepted spellings (stored already folded when
+ *         the codec ignores case)
+ */
+template <typename Enum, std::size_t VALORES, std::size_t ALIAS>
+class CodecEnum {
+public:
+    struct Alias {
+        std::string_view texto;
+        Enum valor;
+    };
+
+    /// Whether parsear() folds case or requires the exact spelling
+    enum class Mayusculas { IGNORAR, DISTINGUIR };
+
+    constexpr CodecEnum(const std::array<std::string_view, VALORES>& nombres,
+                        const std::string_view desconocido,
+                        const Mayusculas mayusculas,
+                        const std::array<Alias, ALIAS>& alias)
+        : m_nombres(nombres), m_desconocido(desconocido), m_tabla{},
+          m_plegar(mayusculas == Mayusculas::IGNORAR) {
+        // Primera semilla sin colisiones entre alias
+        for (std::uint32_t semilla = 0; semilla < MAX_SEMILLAS; ++semilla) {
+            if (colocar(alias, semilla)) {
+                m_semilla = semilla;
+                return;
+            }
+        }
+        throw std::logic_error("[CodecEnum] Alias duplicados o tabla demasiado pequeña");
+    }
+
+    /**
+     * @brief Number of enumerators (valid values are 0..cantidad()-1)
+     */
+    static constexpr std::size_t cantidad() noexcept { return VALORES; }
+
+    constexpr std::string_view nombre(const Enum valor) const noexcept {
+        const auto indice = static_cast<std::size_t>(valor);
+        return indice < VALORES ? m_nombres[indice] : m_desconocido;
+    }
+
+    /**
+     * @brief Parse any alias (ignoring case if the codec was built so)
+     * @return false (and @p valor untouched) if the text is not an alias
+     */
+    constexpr bool parsear(const std::string_view texto, Enum& valor) const noexcept {
+        if (texto.empty()) return false;
+        const Alias& candidato = m_tabla[ranura(texto, m_semilla, m_plegar)];
+        if (!igualPlegado(texto, candidato.texto, m_plegar)) return false;
+        valor = candidato.valor;
+        return true;
+    }
+
+private:
+    static constexpr std::size_t RANURAS = [] {
+        std::size_t n = 8;
+        while (n < 4 * ALIAS) n *= 2;
+        return n;
+    }();
+    static constexpr std::uint32_t MAX_SEMILLAS = 4096;
+
+    std::array<std::string_view, VALORES> m_nombres;
+    std::string_view m_desconocido;
+    std::array<Alias, RANURAS> m_tabla;
+    std::uint32_t m_semilla = 0;
+    bool m_plegar;
+
+    // Minúscula ASCII y, tras el prefijo UTF-8 0xC3, de À..Þ (salvo ×) a à..þ
+    static constexpr unsigned char plegar(const unsigned char anterior, const unsigned char c,
+                                          const bool activo) noexcept {
+        if (!activo) return c;
+        if (c >= 'A' && c <= 'Z') return static_cast<unsigned char>(c + 0x20);
+        if (anterior == 0xC3 && c >= 0x80 && c <= 0x9E && c != 0x97) return static_cast<unsigned char>(c + 0x20);
+        return c;
+    }
+
+    static constexpr std::size_t ranura(const std::string_view texto, const std::uint32_t semilla,
+                                        const bool activo) noexcept {
+        std::uint32_t hash = 2166136261u ^ (semilla * 0x9E3779B9u);
+        unsigned char anterior = 0;
+        for (const char c : texto) {
+            const auto byte = static_cast<unsigned char>(c);
+            hash = (hash ^ plegar(anterior, byte, activo)) * 16777619u;
+            anterior = byte;
+        }
+        return (hash ^ (hash >> 15)) & (RANURAS - 1);
+    }
+
+    static constexpr bool igualPlegado(const std::string_view texto, const std::string_view plegado,
+                                       const bool activo) noexcept {
+        if (texto.size() != plegado.size()) return false;
+        unsigned char anterior = 0;
+        for (std::size_t i = 0; i < texto.size(); ++i) {
+            const auto byte = static_cast<unsigned char>(texto[i]);
+            if (plegar(anterior, byte, activo) != static_cast<unsigned char>(plegado[i])) return false;
+            anterior = byte;
+        }
+        return true;
+    }
+
+    constexpr bool colocar(const std::array<Alias, ALIAS>& alias, const std::uint32_t semilla) noexcept {
+        m_tabla = {};
+        for (const Alias& a : alias) {
+            Alias& destino = m_tabla[ranura(a.texto, semilla, m_plegar)];
+            if (!destino.texto.empty()) return false;
+            destino = a;
+        }
+        return true;
+    }
+};
+
+/**
+ * Codecs shared by Articulo, EquipoMedico and MobiliarioClinico, and by
+ * the import/export paths. Display names are the ones the reports have
+ * always shown. Aliases are the spellings the previous parsers accepted,
+ * plus the display name, its unaccented form and the enumerator name
+ * where those were missing. Types and statuses were always compared in
+ * lower case; brands and areas were matched exactly and still are.
+ */
+namespace CodecEnums {
+    using MedicalInventory::Domain::ArticleStatus;
+    using MedicalInventory::Domain::ArticleType;
+
+    inline constexpr CodecEnum<ArticleType, 2, 12> TIPO{
+        {"Medical Equipment", "Clinical Furniture"},
+        "Unknown Type",
+        CodecEnum<ArticleType, 2, 12>::Mayusculas::IGNORAR,
+        {{{"medical equipment", ArticleType::MEDICAL_EQUIPMENT},
+          {"medical_equipment", ArticleType::MEDICAL_EQUIPMENT},
+          {"equipment", ArticleType::MEDICAL_EQUIPMENT},
+          {"equipo_medico", ArticleType::MEDICAL_EQUIPMENT},
+          {"equipo médico", ArticleType::MEDICAL_EQUIPMENT},
+          {"equipo medico", ArticleType::MEDICAL_EQUIPMENT},
+          {"clinical furniture", ArticleType::CLINICAL_FURNITURE},
+          {"clinical_furniture", ArticleType::CLINICAL_FURNITURE},
+          {"furniture", ArticleType::CLINICAL_FURNITURE},
+          {"mobiliario_clinico", ArticleType::CLINICAL_FURNITURE},
+          {"mobiliario clínico", ArticleType::CLINICAL_FURNITURE},
+          {"mobiliario clinico", ArticleType::CLINICAL_FURNITURE}}}};
+
+    inline constexpr CodecEnum<ArticleStatus, 3, 10> ESTADO{
+        {"Operational", "Under Review", "Damaged"},
+        "Unknown Status",
+        CodecEnum<ArticleStatus, 3, 10>::Mayusculas::IGNORAR,
+        {{{"operational", ArticleStatus::OPERATIONAL},
+          {"operativo", ArticleStatus::OPERATIONAL},
+          {"under review", ArticleStatus::UNDER_REVIEW},
+          {"under_review", ArticleStatus::UNDER_REVIEW},
+          {"en revisión", ArticleStatus::UNDER_REVIEW},
+          {"en revision", ArticleStatus::UNDER_REVIEW},
+          {"en_revision", ArticleStatus::UNDER_REVIEW},
+          {"damaged", ArticleStatus::DAMAGED},
+          {"dañado", ArticleStatus::DAMAGED},
+          {"danado", ArticleStatus::DAMAGED}}}};
+
+    inline constexpr CodecEnum<MarcaEquipo, 4, 7> MARCA{
+        {"Philips", "GE", "Mindray", "Otros"},
+        "Desconocido",
+        CodecEnum<MarcaEquipo, 4, 7>::Mayusculas::DISTINGUIR,
+        {{{"Philips", MarcaEquipo::PHILIPS},
+          {"PHILIPS", MarcaEquipo::PHILIPS},
+          {"GE", MarcaEquipo::GE},
+          {"Mindray", MarcaEquipo::MINDRAY},
+          {"MINDRAY", MarcaEquipo::MINDRAY},
+          {"Otros", MarcaEquipo::OTROS},
+          {"OTROS", MarcaEquipo::OTROS}}}};
+
+    inline constexpr CodecEnum<AreaUso, 3, 8> AREA_USO{
+        {"Emergencia", "Pediatría", "Quirófano"},
+        "Desconocido",
+        CodecEnum<AreaUso, 3, 8>::Mayusculas::DISTINGUIR,
+        {{{"Emergencia", AreaUso::EMERGENCIA},
+          {"EMERGENCIA", AreaUso::EMERGENCIA},
+          {"Pediatría", AreaUso::PEDIATRIA},
+          {"Pediatria", AreaUso::PEDIATRIA},
+          {"PEDIATRIA", AreaUso::PEDIATRIA},
+          {"Quirófano", AreaUso::QUIROFANO},
+          {"Quirofano", AreaUso::QUIROFANO},
+          {"QUIROFANO", AreaUso::QUIROFANO}}}};
+
+    inline constexpr CodecEnum<AreaUbicacion, 3, 7> AREA_UBICACION{
+        {"Consulta", "Emergencia", "Quirófano"},
+        "Desconocido",
+        CodecEnum<AreaUbicacion, 3, 7>::Mayusculas::DISTINGUIR,
+        {{{"Consulta", AreaUbicacion::CONSULTA},
+          {"CONSULTA", AreaUbicacion::CONSULTA},
+          {"Emergencia", AreaUbicacion::EMERGENCIA},
+          {"EMERGENCIA", AreaUbicacion::EMERGENCIA},
+          {"Quirófano", AreaUbicacion::QUIROFANO},
+          {"Quirofano", AreaUbicacion::QUIROFANO},
+          {"QUIROFANO", AreaUbicacion::QUIROFANO}}}};
+}
+
+#endif // CODEC_ENUMS_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file cola_mpsc.hpp
+ * @brief Bounded lock-free queue for many producers and one consumer
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef COLA_MPSC_HPP
+#define COLA_MPSC_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @brief Ring of sequenced cells: producers claim a position with one CAS
+ *
+ * Each cell carries a sequence number that tells whether it is free for
+ * the lap a producer is on or holds a value for the consumer, so neither
+ * side ever waits on a lock and a full queue is reported instead of
+ * blocking. Only one thread may call intentarDesencolar() and vacia().
+ */
+template <typename T>
+class ColaMPSC {
+    static_assert(std::is_nothrow_copy_assignable<T>::value && std::is_nothrow_default_constructible<T>::value,
+                  "Los valores se copian a las celdas sin poder lanzar");
+
+public:
+    /**
+     * @param capacidad Rounded up to a power of two
+     */
+    explicit ColaMPSC(std::size_t capacidad) {
+        std::size_t tamano = 2;
+        while (tamano < capacidad) tamano *= 2;
+        m_celdas = std::make_unique<Celda[]>(tamano);
+        m_mascara = tamano - 1;
+        for (std::size_t i = 0; i < tamano; ++i) m_celdas[i].secuencia.store(i, std::memory_order_relaxed);
+    }
+
+    ColaMPSC(const ColaMPSC&) = delete;
+    ColaMPSC& operator=(const ColaMPSC&) = delete;
+
+    std::size_t capacidad() const noexcept { return m_mascara + 1; }
+
+    /**
+     * @return false if the queue is full
+     */
+    bool intentarEncolar(const T& valor) noexcept {
+        std::size_t posicion = m_cola.load(std::memory_order_relaxed);
+        for (;;) {
+            Celda& celda = m_celdas[posicion & m_mascara];
+            const std::size_t secuencia = celda.secuencia.load(std::memory_order_acquire);
+            const auto diferencia = static_cast<std::intptr_t>(secuencia) - static_cast<std::intptr_t>(posicion);
+            if (diferencia == 0) {
+                if (m_cola.compare_exchange_weak(posicion, posicion + 1, std::memory_order_relaxed)) {
+                    celda.valor = valor;
+                    celda.secuencia.store(posicion + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diferencia < 0) {
+                return false;  // la celda aún guarda un valor de la vuelta anterior
+            } else {
+                posicion = m_cola.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @return false if no value is ready
+     */
+    bool intentarDesencolar(T& valor) noexcept {
+        Celda& celda = m_celdas[m_cabeza & m_mascara];
+        if (celda.secuencia.load(std::memory_order_acquire) != m_cabeza + 1) return false;
+        valor = celda.valor;
+        celda.secuencia.store(m_cabeza + m_mascara + 1, std::memory_order_release);
+        ++m_cabeza;
+        return true;
+    }
+
+    bool vacia() const noexcept {
+        return m_celdas[m_cabeza & m_mascara].secuencia.load(std::memory_order_acquire) != m_cabeza + 1;
+    }
+
+    /**
+     * @brief Positions claimed by producers so far (any thread)
+     */
+    std::uint64_t encolados() const noexcept { return m_cola.load(std::memory_order_acquire); }
+
+private:
+    struct alignas(64) Celda {
+        std::atomic<std::size_t> secuencia{0};
+        T valor{};
+    };
+
+    std::unique_ptr<Celda[]> m_celdas;
+    std::size_t m_mascara = 0;
+    alignas(64) std::atomic<std::size_t> m_cola{0};  // siguiente posición de los productores
+    alignas(64) std::size_t m_cabeza = 0;             // solo el consumidor
+};
+
+#endif // COLA_MPSC_HPP
@@ -0,0 +1,61 @@
+/**
+ * @file columnas_articulos.hpp
+ * @brief Structure-of-arrays shadow copy of the fields used by aggregates
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef COLUMNAS_ARTICULOS_HPP
+#define COLUMNAS_ARTICULOS_HPP
+
+#include "articulo.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Dense per-slot columns mirroring the owned articles
+ *
+ * Row @c i describes the article stored at slot @c i of the inventory.
+ * Reports scan these arrays instead of dereferencing each article and
+ * making a virtual call. The owner keeps the rows in sync through
+ * agregar() on insert, actualizar() after every mutation and quitar()
+ * on removal.
+ */
+struct ColumnasArticulos {
+    static constexpr std::uint8_t SIN_VALOR = 0xFF;  ///< Brand of furniture
+
+    std::vector<double> costoUnitario;
+    std::vector<double> costoTotal;      ///< CalculateTotalCost(corte) at last sync
+    std::vector<std::uint8_t> estado;    ///< ArticleStatus
+    std::vector<std::uint8_t> tipo;      ///< ArticleType
+    std::vector<std::uint8_t> marca;     ///< MarcaEquipo or SIN_VALOR
+    std::vector<std::uint8_t> area;      ///< AreaUso or AreaUbicacion, by type
+    std::vector<std::uint32_t> tecnico;  ///< Technician symbol id or TablaSimbolos::SIN_ID
+    std::vector<std::int32_t> diaIngreso; ///< Entry date as a day number
+
+    /**
+     * @brief Append the row of a newly inserted article
+     * @param corte Reference date for the total-cost column
+     *
+     * Either every column gains the row or, if growing them fails, none does.
+     */
+    void agregar(const Articulo& articulo, const FechaCorte& corte);
+
+    /**
+     * @brief Re-read every field of the article stored at @p slot
+     * @param corte Reference date for the total-cost column
+     */
+    void actualizar(std::uint32_t slot, const Articulo& articulo, const FechaCorte& corte) noexcept;
+
+    /**
+     * @brief Drop the row at @p slot, moving the last row into its place
+     */
+    void quitar(std::uint32_t slot) noexcept;
+
+    void reservar(std::size_t cantidad);
+    void limpiar() noexcept;
+    std::size_t size() const noexcept { return costoUnitario.size(); }
+};
+
+#endif // COLUMNAS_ARTICULOS_HPP
@@ -0,0 +1,62 @@
+/**
+ * @file contadores_inventario.hpp
+ * @brief Running per-type and per-status counters and cost totals
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef CONTADORES_INVENTARIO_HPP
+#define CONTADORES_INVENTARIO_HPP
+
+#include "articulo.hpp"
+#include "suma_compensada.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Article counts and total-cost sums kept up to date in O(1)
+ *
+ * The owner calls agregar() with the row of every inserted article and,
+ * on a mutation, quitar() with the previous row followed by agregar()
+ * with the new one.
+ */
+struct ContadoresInventario {
+    static constexpr std::size_t TIPOS = MedicalInventory::Domain::ARTICLE_TYPE_COUNT;
+    static constexpr std::size_t ESTADOS = MedicalInventory::Domain::ARTICLE_STATUS_COUNT;
+
+    std::array<std::size_t, TIPOS> cantidadPorTipo{};
+    std::array<std::size_t, ESTADOS> cantidadPorEstado{};
+    std::array<SumaCompensada, TIPOS> costoPorTipo{};
+    std::array<SumaCompensada, ESTADOS> costoPorEstado{};
+
+    void agregar(const std::uint8_t tipo, const std::uint8_t estado, const double costoTotal) noexcept {
+        ++cantidadPorTipo[tipo];
+        ++cantidadPorEstado[estado];
+        costoPorTipo[tipo].sumar(costoTotal);
+        costoPorEstado[estado].sumar(costoTotal);
+    }
+
+    void quitar(const std::uint8_t tipo, const std::uint8_t estado, const double costoTotal) noexcept {
+        --cantidadPorTipo[tipo];
+        --cantidadPorEstado[estado];
+        costoPorTipo[tipo].restar(costoTotal);
+        costoPorEstado[estado].restar(costoTotal);
+    }
+
+    /**
+     * @brief Fold in the counters of another range of slots
+     */
+    void combinar(const ContadoresInventario& otro) noexcept {
+        for (std::size_t t = 0; t < TIPOS; ++t) {
+            cantidadPorTipo[t] += otro.cantidadPorTipo[t];
+            costoPorTipo[t].sumar(otro.costoPorTipo[t].valor());
+        }
+        for (std::size_t e = 0; e < ESTADOS; ++e) {
+            cantidadPorEstado[e] += otro.cantidadPorEstado[e];
+            costoPorEstado[e].sumar(otro.costoPorEstado[e].valor());
+        }
+    }
+};
+
+#endif // CONTADORES_INVENTARIO_HPP
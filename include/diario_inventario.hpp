@@ -0,0 +1,219 @@
+/**
+ * @file diario_inventario.hpp
+ * @brief Write-ahead journal of inventory mutations with group commit
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef DIARIO_INVENTARIO_HPP
+#define DIARIO_INVENTARIO_HPP
+
+#include "articulo.hpp"
+#include "archivo_mapeado.hpp"
+#include "archivo_secuencial.hpp"
+#include "snapshot_inventario.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+/**
+ * File layout (little-endian):
+ *
+ *   CabeceraDiario                       24 bytes
+ *   { CabeceraRegistroDiario, cuerpo }   repeated until the end of file
+ *
+ * Each body starts with its OperacionDiario byte followed by the slot
+ * and the new value; the record checksum covers the body. A journal of
+ * generation g applies on top of the snapshot of generation g. Records
+ * are only ever appended, so a crash can at worst leave a torn last
+ * record, which recovery detects by its checksum and cuts off.
+ */
+namespace FormatoDiario {
+    constexpr char FIRMA[8] = {'H', 'I', 'N', 'V', 'W', 'A', 'L', '1'};
+    constexpr std::uint32_t VERSION = 1;
+    constexpr std::uint32_t MAX_CUERPO = 1u << 24;  ///< Larger lengths are treated as corruption
+}
+
+enum class OperacionDiario : std::uint8_t {
+    ALTA = 1,      ///< Whole article appended at @c slot
+    ESTADO,
+    COSTO,
+    UBICACION,     ///< Usage area of equipment, location of furniture
+    VIDA_UTIL,
+    TECNICO,
+    MATERIAL,
+    BAJA           ///< Article at @c slot removed; the last slot moves into it
+};
+
+struct CabeceraDiario {
+    char firma[8];
+    std::uint32_t version;
+    std::uint32_t marcaOrden;
+    std::uint32_t generacion;
+    std::uint32_t sumaCabecera;  ///< Checksum of the preceding 20 bytes
+};
+
+struct CabeceraRegistroDiario {
+    std::uint32_t longitud;  ///< Bytes of the body
+    std::uint32_t suma;      ///< Low half of sumaVerificacion(body)
+};
+
+static_assert(sizeof(CabeceraDiario) == 24, "Cabecera de diario con relleno inesperado");
+static_assert(sizeof(CabeceraRegistroDiario) == 8, "Cabecera de registro con relleno inesperado");
+
+/**
+ * @brief One decoded journal record
+ *
+ * Only the fields of @c operacion are meaningful; views point into the
+ * mapped journal and live as long as the LectorDiario.
+ */
+struct RegistroDiario {
+    OperacionDiario operacion{};
+    std::uint32_t slot = 0;
+    std::uint8_t tipo = 0;
+    std::uint8_t estado = 0;
+    std::uint8_t marca = 0;
+    std::uint8_t area = 0;
+    std::int32_t vidaUtilAnios = 0;
+    double costoUnitario = 0.0;
+    std::string_view codigo;
+    std::string_view fechaIngreso;
+    std::string_view texto;  ///< Technician or material
+};
+
+/**
+ * @brief Sequential reader used by recovery
+ *
+ * Stops at the end of the file or at the first record whose length or
+ * checksum does not match; bytesValidos() then marks where the intact
+ * prefix ends.
+ */
+class LectorDiario {
+public:
+    /**
+     * @throws std::runtime_error if the file is missing or its header is invalid
+     */
+    explicit LectorDiario(const std::string& ruta);
+
+    std::uint32_t generacion() const noexcept { return m_generacion; }
+    bool siguiente(RegistroDiario& registro) noexcept;
+    std::uint64_t bytesValidos() const noexcept { return m_posicion; }
+    std::uint64_t size() const noexcept { return m_archivo.size(); }
+
+private:
+    ArchivoMapeado m_archivo;
+    std::uint32_t m_generacion = 0;
+    std::size_t m_posicion = 0;
+};
+
+struct OpcionesDiario {
+    std::chrono::milliseconds intervaloGrupo{5};      ///< Longest a record waits for its fsync
+    std::size_t bytesPorGrupo = std::size_t{1} << 18;  ///< Pending bytes that trigger an early fsync
+};
+
+/**
+ * @brief Appends mutation records and makes them durable in groups
+ *
+ * registrar*() only encode the record into a memory buffer. A writer
+ * thread drains that buffer with one write and one fsync per group: the
+ * first record of a group waits at most intervaloGrupo, or less once
+ * bytesPorGrupo have piled up or someone calls confirmar(). Hundreds of
+ * status updates therefore share a single fsync.
+ *
+ * Compaction folds the journal into a new snapshot: the journal is
+ * rotated to @c rutaSnapshot + ".wal.old" and a fresh one of the next
+ * generation is started, then a background thread writes the snapshot
+ * and deletes the old journal. A crash at any point leaves files that
+ * recovery can combine.
+ *
+ * Registering is noexcept because it runs from article observers; an
+ * encoding or I/O failure is kept and rethrown by confirmar().
+ */
+class DiarioInventario {
+public:
+    static std::string rutaDiario(const std::string& rutaSnapshot) { return rutaSnapshot + ".wal"; }
+    static std::string rutaDiarioAnterior(const std::string& rutaSnapshot) { return rutaSnapshot + ".wal.old"; }
+
+    /**
+     * @param generacion Generation of the journal to write
+     * @param bytesValidos Intact prefix of the existing journal as found by
+     *        LectorDiario, which is kept and appended to; 0 starts a new file
+     * @throws std::runtime_error if the journal cannot be opened
+     */
+    DiarioInventario(std::string rutaSnapshot, std::uint32_t generacion, std::uint64_t bytesValidos,
+                     OpcionesDiario opciones = {});
+    ~DiarioInventario();
+
+    DiarioInventario(const DiarioInventario&) = delete;
+    DiarioInventario& operator=(const DiarioInventario&) = delete;
+
+    std::uint32_t generacion() const noexcept { return m_generacion; }
+
+    void registrarAlta(const Articulo& articulo, std::uint32_t slot) noexcept;
+    void registrarCambio(const Articulo& articulo, MedicalInventory::Domain::ArticleChange cambio) noexcept;
+    void registrarBaja(std::uint32_t slot) noexcept;
+
+    /**
+     * @brief Block until every record registered so far is on disk
+     * @throws std::runtime_error if a record could not be written
+     */
+    void confirmar();
+
+    /**
+     * @brief Rotate the journal and write @p estado as the next snapshot in the background
+     *
+     * @p estado must hold the inventory exactly as of the last registered
+     * record. If an earlier compaction did not finish, this one runs
+     * synchronously instead.
+     */
+    void compactar(EscritorSnapshot&& estado);
+
+    /**
+     * @brief Wait for a running compaction
+     * @throws std::runtime_error if it failed (the next compactar() repairs it)
+     */
+    void esperarCompactacion();
+
+    /**
+     * @brief Synchronous compaction: snapshot, fresh journal, old journal removed
+     */
+    void puntoDeControl(const EscritorSnapshot& estado);
+
+private:
+    std::string m_rutaSnapshot;
+    OpcionesDiario m_opciones;
+    std::uint32_t m_generacion;
+
+    std::mutex m_mutex;                    // protege buffer, contadores y error
+    std::condition_variable m_hayTrabajo;  // despierta al hilo escritor
+    std::condition_variable m_persistido;  // despierta a confirmar()
+    std::string m_pendiente;               // registros aún no escritos
+    std::string m_lote;                    // grupo que escribe el hilo escritor
+    std::chrono::steady_clock::time_point m_inicioGrupo;
+    std::uint64_t m_registrados = 0;       // bytes anexados desde la apertura
+    std::uint64_t m_persistidos = 0;       // de ellos, ya sincronizados
+    bool m_urgente = false;
+    bool m_cerrando = false;
+    std::exception_ptr m_error;
+
+    std::mutex m_mutexArchivo;  // serializa el uso de m_archivo
+    ArchivoSecuencial m_archivo;
+    std::thread m_escritor;
+
+    std::thread m_compactador;
+    std::exception_ptr m_errorCompactacion;
+
+    template <typename Codificar>
+    void anexar(Codificar&& codificar) noexcept;
+    void escribirGrupos() noexcept;
+    void vaciarPendiente();
+    void crearDiario(std::uint32_t generacion);
+};
+
+#endif // DIARIO_INVENTARIO_HPP
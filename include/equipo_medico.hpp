@@ -24,11 +24,11 @@ enum class AreaUso {
     QUIROFANO
 };
 
-class EquipoMedico : public Articulo {
+class EquipoMedico final : public Articulo {
 private:
     MarcaEquipo marca;
     int vidaUtilAnios;
-    std::string tecnicoAsignado;
+    TablaSimbolos::Id tecnicoId;  // nombre internado en TablaSimbolos::global()
     AreaUso areaUso;
 
 public:
@@ -37,24 +37,27 @@ public:
     using ArticleType = Articulo::ArticleType;
 
     // Constructor - updated to use new enum names
-    EquipoMedico(const std::string& codigo, const std::string& fechaIngreso,
+    EquipoMedico(std::string_view codigo, std::string_view fechaIngreso,
                  ArticleStatus estado, double costoUnitario, MarcaEquipo marca,
-                 int vidaUtil, const std::string& tecnico, AreaUso area);
+                 int vidaUtil, std::string_view tecnico, AreaUso area);
     
     // Getters específicos
     MarcaEquipo getMarca() const { return marca; }
     int getVidaUtilAnios() const { return vidaUtilAnios; }
-    const std::string& getTecnicoAsignado() const { return tecnicoAsignado; }
+    const std::string& getTecnicoAsignado() const noexcept { return TablaSimbolos::global().texto(tecnicoId); }
+    TablaSimbolos::Id getTecnicoId() const { return tecnicoId; }
     AreaUso getAreaUso() const { return areaUso; }
     
-    // Setters específicos
+    // Setters específicos: si el inventario no puede reflejar el cambio
+    // (p. ej. std::bad_alloc) el valor anterior se restaura
     void setTecnicoAsignado(const std::string& tecnico);
-    void setAreaUso(AreaUso area) { areaUso = area; }
-    void setVidaUtilAnios(int anios) { vidaUtilAnios = anios; }
+    void setAreaUso(AreaUso area) { AssignAndNotify(areaUso, area, ArticleChange::LOCATION); }
+    void setVidaUtilAnios(int anios);  // std::invalid_argument si anios <= 0, como el constructor
     
     // New interface methods (override virtual methods from base)
     std::string GetDetailedInfo() const override;
     double CalculateTotalCost() const override;
+    double CalculateTotalCost(const FechaCorte& corte) const;
     
     // Legacy methods for compatibility (deprecated)
     [[deprecated("Use GetDetailedInfo() instead")]]
@@ -66,12 +69,19 @@ public:
     // Funciones auxiliares estáticas
     static std::string marcaToString(MarcaEquipo marca);
     static std::string areaToString(AreaUso area);
-    static MarcaEquipo stringToMarca(const std::string& str);
-    static AreaUso stringToArea(const std::string& str);
+    static std::string_view nombreMarca(MarcaEquipo marca) noexcept;  // sin asignar memoria
+    static std::string_view nombreArea(AreaUso area) noexcept;
+    static MarcaEquipo stringToMarca(std::string_view str);  // grafía exacta; las demás son OTROS
+    static AreaUso stringToArea(std::string_view str);        // grafía exacta; las demás son EMERGENCIA
     
-    // Métodos específicos
+    // Métodos específicos (sin argumento consultan el reloj; los lotes
+    // deben obtener una FechaCorte una sola vez y pasarla a cada equipo)
     double calcularDepreciacion() const;
+    double calcularDepreciacion(const FechaCorte& corte) const;
+    static double depreciacion(double costoUnitario, int vidaUtilAnios, std::int32_t diaIngreso,
+                               const FechaCorte& corte) noexcept;  // sin el objeto, p. ej. desde un snapshot
     double calcularAniosTranscurridos() const;
+    double calcularAniosTranscurridos(const FechaCorte& corte) const;
     bool necesitaMantenimiento() const;
 };
 
@@ -0,0 +1,44 @@
+/**
+ * @file evento_inventario.hpp
+ * @brief Fixed-size mutation event reported by scanners and stations
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef EVENTO_INVENTARIO_HPP
+#define EVENTO_INVENTARIO_HPP
+
+#include "articulo.hpp"
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief One change to apply to the article with a given code
+ *
+ * The code is stored inline, so events copy without allocating and fit
+ * a lock-free queue cell. The factories validate code and value, which
+ * lets the applier assume every queued event is well formed.
+ */
+struct EventoInventario {
+    enum class Tipo : std::uint8_t { ESTADO, COSTO };
+
+    Tipo tipo = Tipo::ESTADO;
+    std::uint8_t longitudCodigo = 0;
+    char codigoArticulo[MedicalInventory::Domain::Validation::MAX_CODE_LENGTH] = {};
+    EstadoArticulo estado = EstadoArticulo::OPERATIONAL;
+    double costo = 0.0;
+
+    /**
+     * @throws std::invalid_argument if @p codigo is not a valid article code
+     */
+    static EventoInventario cambioEstado(std::string_view codigo, EstadoArticulo estado);
+
+    /**
+     * @throws std::invalid_argument if @p codigo or @p costo are not valid
+     */
+    static EventoInventario cambioCosto(std::string_view codigo, double costo);
+
+    std::string_view codigo() const noexcept { return {codigoArticulo, longitudCodigo}; }
+};
+
+#endif // EVENTO_INVENTARIO_HPP
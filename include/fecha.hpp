@@ -0,0 +1,106 @@
+/**
+ * @file fecha.hpp
+ * @brief Compact calendar dates and the "as of" date used for depreciation
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef FECHA_HPP
+#define FECHA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Fecha {
+    /**
+     * @brief Days since 01/01/1970 of a civil (proleptic Gregorian) date
+     */
+    constexpr std::int32_t diasDesdeCivil(int anio, const unsigned mes, const unsigned dia) noexcept {
+        anio -= mes <= 2 ? 1 : 0;
+        const int era = (anio >= 0 ? anio : anio - 399) / 400;
+        const unsigned anioEra = static_cast<unsigned>(anio - era * 400);
+        const unsigned diaAnio = (153 * (mes + (mes > 2 ? -3 : 9)) + 2) / 5 + dia - 1;
+        const unsigned diaEra = anioEra * 365 + anioEra / 4 - anioEra / 100 + diaAnio;
+        return era * 146097 + static_cast<std::int32_t>(diaEra) - 719468;
+    }
+
+    struct Civil {
+        int anio;
+        unsigned mes;
+        unsigned dia;
+    };
+
+    /**
+     * @brief Civil date of a day number produced by diasDesdeCivil()
+     */
+    constexpr Civil civilDeDias(std::int32_t dias) noexcept {
+        dias += 719468;
+        const int era = (dias >= 0 ? dias : dias - 146096) / 146097;
+        const unsigned diaEra = static_cast<unsigned>(dias - era * 146097);
+        const unsigned anioEra = (diaEra - diaEra / 1460 + diaEra / 36524 - diaEra / 146096) / 365;
+        const unsigned diaAnio = diaEra - (365 * anioEra + anioEra / 4 - anioEra / 100);
+        const unsigned mesPrima = (5 * diaAnio + 2) / 153;
+        const unsigned mes = mesPrima < 10 ? mesPrima + 3 : mesPrima - 9;
+        return Civil{static_cast<int>(anioEra) + era * 400 + (mes <= 2 ? 1 : 0), mes,
+                     diaAnio - (153 * mesPrima + 2) / 5 + 1};
+    }
+
+    /**
+     * @brief Calendar year of a day number produced by diasDesdeCivil()
+     */
+    constexpr int anioDeDias(const std::int32_t dias) noexcept {
+        return civilDeDias(dias).anio;
+    }
+
+    /**
+     * @brief Day number of a date already validated as DD/MM/YYYY
+     */
+    constexpr std::int32_t diasDesdeTexto(const std::string_view ddmmyyyy) noexcept {
+        const auto digito = [ddmmyyyy](const std::size_t i) { return static_cast<unsigned>(ddmmyyyy[i] - '0'); };
+        const unsigned dia = digito(0) * 10 + digito(1);
+        const unsigned mes = digito(3) * 10 + digito(4);
+        const int anio = static_cast<int>(digito(6) * 1000 + digito(7) * 100 + digito(8) * 10 + digito(9));
+        return diasDesdeCivil(anio, mes, dia);
+    }
+
+    /**
+     * @brief Inverse of diasDesdeTexto() for years 0000 to 9999
+     */
+    constexpr void textoDeDias(const std::int32_t dias, char (&ddmmyyyy)[10]) noexcept {
+        const Civil fecha = civilDeDias(dias);
+        const unsigned anio = static_cast<unsigned>(fecha.anio);
+        const unsigned campos[] = {fecha.dia / 10, fecha.dia % 10, fecha.mes / 10, fecha.mes % 10,
+                                   anio / 1000, anio / 100 % 10, anio / 10 % 10, anio % 10};
+        const std::size_t posiciones[] = {0, 1, 3, 4, 6, 7, 8, 9};
+        for (std::size_t i = 0; i < 8; ++i) ddmmyyyy[posiciones[i]] = static_cast<char>('0' + campos[i]);
+        ddmmyyyy[2] = ddmmyyyy[5] = '/';
+    }
+
+    constexpr std::int32_t PRIMER_DIA = diasDesdeCivil(0, 1, 1);      ///< 01/01/0000
+    constexpr std::int32_t ULTIMO_DIA = diasDesdeCivil(9999, 12, 31); ///< 31/12/9999
+
+    /**
+     * @brief Today's day number in local time (one libc call)
+     */
+    std::int32_t hoy();
+}
+
+/**
+ * @brief Reference date for age-dependent valuations
+ *
+ * Depreciation depends on the current year. A report fetches the clock
+ * once, builds a FechaCorte and passes it to every item, so a batch does
+ * no per-item clock or calendar work and all items agree on "today".
+ */
+struct FechaCorte {
+    std::int32_t dia = 0;  ///< Day number (see Fecha::diasDesdeCivil)
+    int anio = 1970;
+
+    static FechaCorte Hoy() { return Desde(Fecha::hoy()); }
+    static constexpr FechaCorte Desde(const std::int32_t dia) noexcept {
+        return FechaCorte{dia, Fecha::anioDeDias(dia)};
+    }
+};
+
+#endif // FECHA_HPP
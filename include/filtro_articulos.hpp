@@ -0,0 +1,179 @@
+/**
+ * @file filtro_articulos.hpp
+ * @brief Composable article predicates evaluated in a single column scan
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef FILTRO_ARTICULOS_HPP
+#define FILTRO_ARTICULOS_HPP
+
+#include "columnas_articulos.hpp"
+#include "equipo_medico.hpp"
+#include "fecha.hpp"
+#include "mobiliario_clinico.hpp"
+#include "tabla_simbolos.hpp"
+#include "validacion.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Predicates read one row of ColumnasArticulos and combine with &&, ||
+ * and ! into a single expression type, e.g.
+ *
+ *     Filtro::estado(EstadoArticulo::DAMAGED) && Filtro::marca(MarcaEquipo::GE) &&
+ *     Filtro::costoUnitarioEntre(500, 2000)
+ *
+ * Inventario::filtrar() runs the whole expression per slot in one pass;
+ * every operator is a template with a non-virtual call operator, so the
+ * compiler inlines the combined test into the loop.
+ */
+namespace Filtro {
+    using Dia = std::int32_t;
+
+    /**
+     * @brief CRTP base that marks a type as a predicate for the operators
+     */
+    template <typename Derivado>
+    struct Predicado {
+        const Derivado& derivado() const noexcept { return static_cast<const Derivado&>(*this); }
+    };
+
+    // Predicado sobre una columna de enteros pequeños
+    template <typename Valor, std::vector<Valor> ColumnasArticulos::*Columna>
+    struct Igual : Predicado<Igual<Valor, Columna>> {
+        Valor valor;
+        explicit Igual(const Valor v) noexcept : valor(v) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            return (columnas.*Columna)[slot] == valor;
+        }
+    };
+
+    using Estado = Igual<std::uint8_t, &ColumnasArticulos::estado>;
+    using Tipo = Igual<std::uint8_t, &ColumnasArticulos::tipo>;
+    using Marca = Igual<std::uint8_t, &ColumnasArticulos::marca>;
+
+    // El valor de área solo tiene sentido junto al tipo de artículo
+    struct Area : Predicado<Area> {
+        std::uint8_t tipo;
+        std::uint8_t area;
+        Area(const TipoArticulo t, const std::uint8_t a) noexcept : tipo(static_cast<std::uint8_t>(t)), area(a) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            return columnas.area[slot] == area && columnas.tipo[slot] == tipo;
+        }
+    };
+
+    // Intervalo cerrado [minimo, maximo] sobre una columna
+    template <typename Valor, std::vector<Valor> ColumnasArticulos::*Columna>
+    struct Entre : Predicado<Entre<Valor, Columna>> {
+        Valor minimo;
+        Valor maximo;
+        Entre(const Valor desde, const Valor hasta) noexcept : minimo(desde), maximo(hasta) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            const Valor valor = (columnas.*Columna)[slot];
+            return valor >= minimo && valor <= maximo;
+        }
+    };
+
+    using CostoUnitarioEntre = Entre<double, &ColumnasArticulos::costoUnitario>;
+    using CostoTotalEntre = Entre<double, &ColumnasArticulos::costoTotal>;
+    using IngresoEntre = Entre<Dia, &ColumnasArticulos::diaIngreso>;
+
+    struct Tecnico : Predicado<Tecnico> {
+        TablaSimbolos::Id id;  ///< SIN_ID if the name was never assigned: matches nothing
+        explicit Tecnico(const TablaSimbolos::Id i) noexcept : id(i) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            return id != TablaSimbolos::SIN_ID && columnas.tecnico[slot] == id;
+        }
+    };
+
+    template <typename A, typename B>
+    struct Y : Predicado<Y<A, B>> {
+        A a;
+        B b;
+        Y(const A& izquierda, const B& derecha) : a(izquierda), b(derecha) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            return a(columnas, slot) && b(columnas, slot);
+        }
+    };
+
+    template <typename A, typename B>
+    struct O : Predicado<O<A, B>> {
+        A a;
+        B b;
+        O(const A& izquierda, const B& derecha) : a(izquierda), b(derecha) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            return a(columnas, slot) || b(columnas, slot);
+        }
+    };
+
+    template <typename A>
+    struct No : Predicado<No<A>> {
+        A a;
+        explicit No(const A& operando) : a(operando) {}
+        bool operator()(const ColumnasArticulos& columnas, const std::size_t slot) const noexcept {
+            return !a(columnas, slot);
+        }
+    };
+
+    template <typename A, typename B>
+    Y<A, B> operator&&(const Predicado<A>& a, const Predicado<B>& b) { return {a.derivado(), b.derivado()}; }
+
+    template <typename A, typename B>
+    O<A, B> operator||(const Predicado<A>& a, const Predicado<B>& b) { return {a.derivado(), b.derivado()}; }
+
+    template <typename A>
+    No<A> operator!(const Predicado<A>& a) { return No<A>(a.derivado()); }
+
+    // Constructores de los predicados básicos
+
+    inline Estado estado(const EstadoArticulo valor) noexcept { return Estado(static_cast<std::uint8_t>(valor)); }
+    inline Tipo tipo(const TipoArticulo valor) noexcept { return Tipo(static_cast<std::uint8_t>(valor)); }
+    inline Marca marca(const MarcaEquipo valor) noexcept { return Marca(static_cast<std::uint8_t>(valor)); }
+
+    inline Area area(const AreaUso valor) noexcept {
+        return Area(TipoArticulo::MEDICAL_EQUIPMENT, static_cast<std::uint8_t>(valor));
+    }
+    inline Area area(const AreaUbicacion valor) noexcept {
+        return Area(TipoArticulo::CLINICAL_FURNITURE, static_cast<std::uint8_t>(valor));
+    }
+
+    inline CostoUnitarioEntre costoUnitarioEntre(const double minimo, const double maximo) noexcept {
+        return CostoUnitarioEntre(minimo, maximo);
+    }
+
+    /**
+     * @brief Total cost as of the inventory's FechaCorte
+     */
+    inline CostoTotalEntre costoTotalEntre(const double minimo, const double maximo) noexcept {
+        return CostoTotalEntre(minimo, maximo);
+    }
+
+    /**
+     * @brief Equipment assigned to @p nombre; the name is resolved once here
+     */
+    inline Tecnico tecnico(const std::string_view nombre) {
+        return Tecnico(TablaSimbolos::global().buscar(nombre));
+    }
+
+    inline IngresoEntre ingresoEntre(const Dia desde, const Dia hasta) noexcept { return IngresoEntre(desde, hasta); }
+
+    /**
+     * @brief Entry dates between two DD/MM/YYYY dates, both included
+     * @throws std::invalid_argument if a date is not valid
+     */
+    inline IngresoEntre ingresoEntre(const std::string_view desde, const std::string_view hasta) {
+        for (const std::string_view fecha : {desde, hasta}) {
+            if (!Validacion::fechaValida(fecha)) {
+                throw std::invalid_argument("[Filtro] Fecha inválida: '" + std::string(fecha) + "'");
+            }
+        }
+        return IngresoEntre(Fecha::diasDesdeTexto(desde), Fecha::diasDesdeTexto(hasta));
+    }
+}
+
+#endif // FILTRO_ARTICULOS_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file gestor_epocas.hpp
+ * @brief Epoch-based reclamation for structures read without locks
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef GESTOR_EPOCAS_HPP
+#define GESTOR_EPOCAS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Defers freeing unpublished objects until no reader can see them
+ *
+ * A reader calls entrar() before loading a published pointer and keeps the
+ * returned Guarda for as long as it uses what it reached; entering only
+ * announces the current epoch in a free slot, so readers never wait on a
+ * writer. A writer first publishes the new structure, then retires what it
+ * replaced and calls avanzar(), which frees every retired object older
+ * than the oldest epoch still announced.
+ *
+ * retirar() and avanzar() belong to the writer side and must not run
+ * concurrently with each other (callers hold their own writer lock).
+ * Destroying the manager frees everything retired; no Guarda may remain.
+ */
+class GestorEpocas {
+public:
+    static constexpr std::size_t MAX_LECTORES = 128;  ///< Concurrent guards; more wait for a free slot
+
+    class Guarda {
+    public:
+        Guarda(Guarda&& otra) noexcept : m_ranura(otra.m_ranura) { otra.m_ranura = nullptr; }
+        Guarda& operator=(Guarda&& otra) noexcept;
+        Guarda(const Guarda&) = delete;
+        Guarda& operator=(const Guarda&) = delete;
+        ~Guarda() { salir(); }
+
+    private:
+        friend class GestorEpocas;
+
+        explicit Guarda(std::atomic<std::uint64_t>* ranura) noexcept : m_ranura(ranura) {}
+        void salir() noexcept;
+
+        std::atomic<std::uint64_t>* m_ranura;
+    };
+
+    GestorEpocas() = default;
+    ~GestorEpocas();
+
+    GestorEpocas(const GestorEpocas&) = delete;
+    GestorEpocas& operator=(const GestorEpocas&) = delete;
+
+    /**
+     * @brief Pin the current epoch for the calling reader
+     */
+    Guarda entrar() noexcept;
+
+    /**
+     * @brief Free @p objeto once every reader that could have reached it left
+     *
+     * Call only after @p objeto was unlinked from every published structure.
+     */
+    template <typename T>
+    void retirar(const T* objeto) {
+        if (!objeto) return;
+        m_retirados.push_back({m_epoca.load(), objeto,
+                               [](const void* puntero) noexcept { delete static_cast<const T*>(puntero); }});
+    }
+
+    /**
+     * @brief Make room to retire @p cantidad more objects without allocating
+     */
+    void reservar(const std::size_t cantidad) { m_retirados.reserve(m_retirados.size() + cantidad); }
+
+    /**
+     * @brief Close the current epoch and free what no reader can still see
+     */
+    void avanzar() noexcept;
+
+    std::size_t pendientes() const noexcept { return m_retirados.size(); }  ///< Writer side only
+
+private:
+    struct alignas(64) Ranura {
+        std::atomic<std::uint64_t> epoca{0};  ///< Announced epoch; zero when free
+    };
+
+    struct Retirado {
+        std::uint64_t epoca;
+        const void* objeto;
+        void (*liberar)(const void*) noexcept;
+    };
+
+    std::array<Ranura, MAX_LECTORES> m_ranuras;
+    alignas(64) std::atomic<std::uint64_t> m_epoca{1};
+    std::vector<Retirado> m_retirados;
+};
+
+#endif // GESTOR_EPOCAS_HPP
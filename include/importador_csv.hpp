@@ -0,0 +1,75 @@
+/**
+ * @file importador_csv.hpp
+ * @brief Streaming CSV import of procurement exports into an inventory
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef IMPORTADOR_CSV_HPP
+#define IMPORTADOR_CSV_HPP
+
+#include "inventario.hpp"
+#include "agregacion_paralela.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+struct OpcionesImportacion {
+    char separador = ',';
+    std::size_t tamanoBloque = std::size_t{1} << 20;   ///< Bytes of rows parsed per task
+    std::size_t bloquesPorLote = 16;                   ///< Blocks in memory at once
+    std::size_t maxErroresDetallados = 1000;           ///< Further errors are only counted
+    std::size_t maxTamanoFila = std::size_t{1} << 20;  ///< A longer row aborts the import
+};
+
+struct ErrorImportacion {
+    std::size_t linea;  ///< 1-based physical line where the row starts
+    std::string mensaje;
+};
+
+struct ResultadoImportacion {
+    std::size_t filasLeidas = 0;
+    std::size_t importadas = 0;
+    std::size_t rechazadas = 0;  ///< Malformed or invalid rows
+    std::size_t duplicadas = 0;  ///< Code already in the inventory or earlier in the file
+    std::vector<ErrorImportacion> errores;
+};
+
+/**
+ * @brief Reads a CSV export in bounded memory and adds its rows to an inventory
+ *
+ * The first row is a header naming the columns, in any order and case:
+ *
+ *   tipo, codigo, fecha_ingreso, estado, costo_unitario, area,
+ *   marca, vida_util, tecnico   (medical equipment)
+ *   material                    (clinical furniture)
+ *
+ * Enum columns accept every alias of CodecEnums. Fields may be quoted
+ * (RFC 4180, including embedded separators, quotes and newlines).
+ *
+ * The input is read in blocks cut at row boundaries. Each batch of
+ * blocks is split, parsed and validated on worker threads; the rows are
+ * then committed on the calling thread in file order, so duplicate codes
+ * are detected exactly as a sequential load would. At most
+ * bloquesPorLote blocks are held at a time, whatever the file size.
+ * Invalid rows are skipped and reported; I/O failures throw.
+ */
+class ImportadorCSV {
+public:
+    explicit ImportadorCSV(Inventario& inventario, OpcionesImportacion opciones = {});
+
+    /**
+     * @throws std::runtime_error if the file cannot be read, the header is
+     *         missing required columns or a row exceeds maxTamanoFila
+     */
+    ResultadoImportacion importar(const std::string& ruta);
+    ResultadoImportacion importar(std::istream& entrada);
+
+private:
+    Inventario& m_inventario;
+    OpcionesImportacion m_opciones;
+    AgregadorParalelo m_agregador;
+};
+
+#endif // IMPORTADOR_CSV_HPP
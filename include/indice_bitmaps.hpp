@@ -0,0 +1,77 @@
+/**
+ * @file indice_bitmaps.hpp
+ * @brief Compressed bitmap of slots for every status, type, brand and area value
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef INDICE_BITMAPS_HPP
+#define INDICE_BITMAPS_HPP
+
+#include "codec_enums.hpp"
+#include "columnas_articulos.hpp"
+#include "mapa_bits.hpp"
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Bitmap index over the low-cardinality article columns
+ *
+ * Each enumerator owns the MapaBits of the slots that currently hold it.
+ * A conjunction such as "damaged Philips equipment in the operating room"
+ * is the AND of three bitmaps; its size is a popcount and only the slots
+ * left are materialized. Usage areas and furniture locations are indexed
+ * separately, and furniture has no brand.
+ *
+ * The owner reports inserts, removals and status or area changes with the
+ * rows of its ColumnasArticulos, before removing a row from them. Every
+ * change that adds slots either completes or throws leaving the index as
+ * it was; removals never throw.
+ */
+class IndiceBitmaps {
+public:
+    void agregar(const ColumnasArticulos& columnas, std::uint32_t slot);
+    void quitar(const ColumnasArticulos& columnas, std::uint32_t slot) noexcept;
+
+    /**
+     * @brief The row of @p slot is removed and the row of @p ultimo moves into it
+     *
+     * @p slot is first added where the moved row needs it; only when that
+     * succeeds are the old entries of both slots dropped.
+     */
+    void reemplazar(const ColumnasArticulos& columnas, std::uint32_t slot, std::uint32_t ultimo);
+
+    /**
+     * @brief The row of @p slot now holds new values; it had @p estadoAnterior and @p areaAnterior
+     *
+     * As in reemplazar, the new maps gain @p slot before the old ones lose it.
+     */
+    void actualizar(const ColumnasArticulos& columnas, std::uint32_t slot, std::uint8_t estadoAnterior,
+                    std::uint8_t areaAnterior);
+
+    void limpiar() noexcept;
+
+    const MapaBits& estado(EstadoArticulo valor) const noexcept { return m_estado[static_cast<std::size_t>(valor)]; }
+    const MapaBits& tipo(TipoArticulo valor) const noexcept { return m_tipo[static_cast<std::size_t>(valor)]; }
+    const MapaBits& marca(MarcaEquipo valor) const noexcept { return m_marca[static_cast<std::size_t>(valor)]; }
+    const MapaBits& area(AreaUso valor) const noexcept { return m_areaUso[static_cast<std::size_t>(valor)]; }
+    const MapaBits& area(AreaUbicacion valor) const noexcept {
+        return m_areaUbicacion[static_cast<std::size_t>(valor)];
+    }
+
+private:
+    std::array<MapaBits, CodecEnums::ESTADO.cantidad()> m_estado;
+    std::array<MapaBits, CodecEnums::TIPO.cantidad()> m_tipo;
+    std::array<MapaBits, CodecEnums::MARCA.cantidad()> m_marca;
+    std::array<MapaBits, CodecEnums::AREA_USO.cantidad()> m_areaUso;
+    std::array<MapaBits, CodecEnums::AREA_UBICACION.cantidad()> m_areaUbicacion;
+
+    // Los mapas de una fila: estado, tipo, marca (nullptr en mobiliario) y área
+    using MapasFila = std::array<MapaBits*, 4>;
+
+    MapaBits& mapaArea(std::uint8_t tipo, std::uint8_t area) noexcept;
+    MapasFila mapasDe(const ColumnasArticulos& columnas, std::uint32_t fila) noexcept;
+    static void cambiarMapas(const MapasFila& anteriores, const MapasFila& nuevos, std::uint32_t slot);
+};
+
+#endif // INDICE_BITMAPS_HPP
@@ -0,0 +1,102 @@
+/**
+ * @file indice_codigos.hpp
+ * @brief Open-addressing hash index from article code to inventory slot
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef INDICE_CODIGOS_HPP
+#define INDICE_CODIGOS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Hash index (linear probing) that maps an article code to its slot
+ *
+ * The index does not own the codes: each entry keeps the 32-bit hash and the
+ * slot, and lookups confirm a candidate by asking the caller for the code
+ * stored at that slot. Growing the table only rehashes the stored hashes, so
+ * it never touches the articles.
+ */
+class IndiceCodigos {
+public:
+    static constexpr std::uint32_t SIN_SLOT = UINT32_MAX;
+
+    IndiceCodigos() = default;
+
+    /**
+     * @brief Find the slot of a code
+     * @param codigo Code to look up
+     * @param codigoDeSlot Callable returning the code stored at a slot
+     * @return Slot of the article or SIN_SLOT if the code is not indexed
+     */
+    template <typename CodigoDeSlot>
+    std::uint32_t buscar(std::string_view codigo, CodigoDeSlot&& codigoDeSlot) const;
+
+    /**
+     * @brief Index a code that is known not to be present yet
+     * @param codigo Article code
+     * @param slot Slot of the article in the inventory
+     */
+    void insertar(std::string_view codigo, std::uint32_t slot);
+
+    /**
+     * @brief Drop the entry of a code stored at @p slot
+     *
+     * Later entries of the probe run are shifted back, so lookups never
+     * need tombstones.
+     */
+    void eliminar(std::string_view codigo, std::uint32_t slot) noexcept;
+
+    /**
+     * @brief Point the entry of a code from slot @p anterior to slot @p nuevo
+     */
+    void reubicar(std::string_view codigo, std::uint32_t anterior, std::uint32_t nuevo) noexcept;
+
+    /**
+     * @brief Make room for at least @p cantidad codes without rehashing
+     */
+    void reservar(std::size_t cantidad);
+
+    void limpiar() noexcept;
+    std::size_t size() const noexcept { return m_cantidad; }
+
+    /**
+     * @brief FNV-1a hash of a code
+     */
+    static std::uint32_t hashCodigo(std::string_view codigo) noexcept;
+
+private:
+    struct Entrada {
+        std::uint32_t hash;
+        std::uint32_t slot;
+    };
+
+    static constexpr std::size_t CAPACIDAD_MINIMA = 16;
+
+    std::vector<Entrada> m_tabla;   ///< Power-of-two table, load factor <= 1/2
+    std::size_t m_cantidad = 0;
+
+    void redimensionar(std::size_t capacidad);
+    void colocar(Entrada entrada) noexcept;
+    std::size_t posicion(std::uint32_t hash, std::uint32_t slot) const noexcept;
+};
+
+template <typename CodigoDeSlot>
+std::uint32_t IndiceCodigos::buscar(const std::string_view codigo, CodigoDeSlot&& codigoDeSlot) const {
+    if (m_tabla.empty()) return SIN_SLOT;
+    const std::uint32_t hash = hashCodigo(codigo);
+    const std::size_t mascara = m_tabla.size() - 1;
+    for (std::size_t i = hash & mascara;; i = (i + 1) & mascara) {
+        const Entrada& entrada = m_tabla[i];
+        if (entrada.slot == SIN_SLOT) return SIN_SLOT;
+        if (entrada.hash == hash && std::string_view(codigoDeSlot(entrada.slot)) == codigo) {
+            return entrada.slot;
+        }
+    }
+}
+
+#endif // INDICE_CODIGOS_HPP
@@ -0,0 +1,170 @@
+/**
+ * @file indice_ordenado.hpp
+ * @brief Slots ordered by a numeric column (costs, entry days) for range, top-K and rank queries
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef INDICE_ORDENADO_HPP
+#define INDICE_ORDENADO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief (value, slot) pairs kept sorted in a two-level B+tree
+ *
+ * Entries live in sorted leaf blocks of at most 2 * TAMANO_BLOQUE; the
+ * last entry of every block routes searches and a Fenwick tree over the
+ * block sizes turns a position into a rank and back. Insertions and
+ * removals therefore move at most one block, and range bounds, counts
+ * and the k-th entry cost O(log n). Entries are ordered by value and
+ * then by slot.
+ *
+ * The owner reports every value change and slot move; reconstruir()
+ * rebuilds the index in O(n log n) when the whole column changes.
+ * agregar() either inserts or throws leaving the index unchanged, and
+ * quitar() never throws, so an owner can add first and remove last.
+ */
+class IndiceOrdenado {
+public:
+    static constexpr std::size_t TAMANO_BLOQUE = 128;
+
+    struct Entrada {
+        double valor;
+        std::uint32_t slot;
+    };
+
+    void agregar(double valor, std::uint32_t slot);
+    void quitar(double valor, std::uint32_t slot) noexcept;
+
+    /**
+     * @brief Index valores[slot] for every slot, dropping the previous entries
+     */
+    template <typename Valor>
+    void reconstruir(const std::vector<Valor>& valores);
+    void limpiar() noexcept;
+
+    std::size_t size() const noexcept { return m_cantidad; }
+    bool vacio() const noexcept { return m_cantidad == 0; }
+
+    /**
+     * @brief Entry of rank @p posicion in ascending order (0 is the minimum)
+     * @pre posicion < size()
+     */
+    const Entrada& enPosicion(std::size_t posicion) const;
+
+    /**
+     * @brief Highest value, with its lowest slot if several share it
+     * @pre !vacio()
+     */
+    const Entrada& maximo() const;
+
+    /**
+     * @brief Number of entries with minimo <= valor <= maximo (0 if either bound is NaN)
+     */
+    std::size_t contarEntre(double minimo, double maximo) const;
+
+    /**
+     * @brief Call funcion(slot) in ascending order for minimo <= valor <= maximo
+     *        (none if either bound is NaN)
+     */
+    template <typename Funcion>
+    void paraCadaEntre(double minimo, double maximo, Funcion&& funcion) const;
+
+    /**
+     * @brief Call funcion(slot) from the lowest value up while it returns true
+     */
+    template <typename Funcion>
+    void recorrerAscendente(Funcion&& funcion) const;
+
+    /**
+     * @brief Call funcion(slot) from the highest value down while it returns
+     *        true; equal values still come in ascending slot order
+     */
+    template <typename Funcion>
+    void recorrerDescendente(Funcion&& funcion) const;
+
+private:
+    struct Posicion {
+        std::size_t bloque;
+        std::size_t indice;
+    };
+
+    std::vector<std::vector<Entrada>> m_bloques;
+    std::vector<Entrada> m_ultimos;    ///< Last entry of every block
+    std::vector<std::size_t> m_arbol;  ///< Fenwick tree of block sizes (1-based)
+    std::size_t m_cantidad = 0;
+
+    static bool antes(const Entrada& a, const Entrada& b) noexcept {
+        return a.valor < b.valor || (a.valor == b.valor && a.slot < b.slot);
+    }
+
+    Posicion buscar(const Entrada& clave) const noexcept;
+    std::size_t rango(const Entrada& clave) const noexcept;
+    std::size_t prefijo(std::size_t bloque) const noexcept;
+    void sumarEnArbol(std::size_t bloque, bool suma) noexcept;
+    void rehacerArbol();
+    void reconstruir(std::vector<Entrada>&& entradas);
+    void dividir(std::size_t bloque);
+    bool fusionar(std::size_t bloque) noexcept;
+};
+
+template <typename Valor>
+void IndiceOrdenado::reconstruir(const std::vector<Valor>& valores) {
+    std::vector<Entrada> entradas(valores.size());
+    for (std::size_t slot = 0; slot < valores.size(); ++slot) {
+        entradas[slot] = {static_cast<double>(valores[slot]), static_cast<std::uint32_t>(slot)};
+    }
+    reconstruir(std::move(entradas));
+}
+
+template <typename Funcion>
+void IndiceOrdenado::paraCadaEntre(const double minimo, const double maximo, Funcion&& funcion) const {
+    // Como contarEntre: un rango vacío o con NaN no visita nada
+    if (!(minimo <= maximo)) return;
+    Posicion p = buscar({minimo, 0});
+    for (; p.bloque < m_bloques.size(); ++p.bloque, p.indice = 0) {
+        const std::vector<Entrada>& bloque = m_bloques[p.bloque];
+        for (; p.indice < bloque.size(); ++p.indice) {
+            if (bloque[p.indice].valor > maximo) return;
+            funcion(bloque[p.indice].slot);
+        }
+    }
+}
+
+template <typename Funcion>
+void IndiceOrdenado::recorrerAscendente(Funcion&& funcion) const {
+    for (const std::vector<Entrada>& bloque : m_bloques) {
+        for (const Entrada& entrada : bloque) {
+            if (!funcion(entrada.slot)) return;
+        }
+    }
+}
+
+template <typename Funcion>
+void IndiceOrdenado::recorrerDescendente(Funcion&& funcion) const {
+    // Cada grupo de valores iguales se guarda y se entrega al revés
+    std::vector<std::uint32_t> empatados;
+    const auto entregar = [&empatados, &funcion]() {
+        for (auto slot = empatados.rbegin(); slot != empatados.rend(); ++slot) {
+            if (!funcion(*slot)) return false;
+        }
+        empatados.clear();
+        return true;
+    };
+    double valor = 0.0;
+    for (std::size_t b = m_bloques.size(); b-- > 0;) {
+        const std::vector<Entrada>& bloque = m_bloques[b];
+        for (std::size_t i = bloque.size(); i-- > 0;) {
+            if (!empatados.empty() && bloque[i].valor != valor && !entregar()) return;
+            valor = bloque[i].valor;
+            empatados.push_back(bloque[i].slot);
+        }
+    }
+    entregar();
+}
+
+#endif // INDICE_ORDENADO_HPP
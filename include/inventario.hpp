@@ -4,22 +4,129 @@
 #include "articulo.hpp"
 #include "equipo_medico.hpp"
 #include "mobiliario_clinico.hpp"
+#include "indice_codigos.hpp"
+#include "columnas_articulos.hpp"
+#include "indice_bitmaps.hpp"
+#include "indice_ordenado.hpp"
+#include "contadores_inventario.hpp"
+#include "ranking_tecnicos.hpp"
+#include "pool_articulos.hpp"
+#include "agregacion_paralela.hpp"
+#include "diario_inventario.hpp"
+#include "seguimiento_cambios.hpp"
+#include "evento_inventario.hpp"
+#include "filtro_articulos.hpp"
+#include <array>
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
+#include <string_view>
 
-class Inventario {
+// Columna de costo sobre la que se calculan los extremos
+enum class CriterioCosto { UNITARIO, TOTAL };
+
+// Extremos de costo y los artículos que los alcanzan
+struct ResumenCostos {
+    double minimo = 0.0;
+    double maximo = 0.0;
+    Articulo* masBarato = nullptr;
+    Articulo* masCaro = nullptr;
+};
+
+// Agrupación temporal de las estadísticas de ingreso
+enum class PeriodoIngreso { DIA, SEMANA, MES, ANIO };
+
+// Artículos ingresados en un periodo
+struct IngresosPeriodo {
+    std::int32_t inicio = 0;  // primer día del periodo (ver Fecha::diasDesdeCivil)
+    size_t cantidad = 0;
+    double costo = 0.0;       // suma de sus costos unitarios
+};
+
+// Lo que hizo abrirDiario al recuperar snapshot y diarios
+struct ResultadoRecuperacion {
+    size_t registrosAplicados = 0;
+    std::uint64_t bytesDescartados = 0;  // registro final a medias tras una caída
+};
+
+class Inventario : private MedicalInventory::Domain::ArticleObserver {
 private:
-    std::vector<std::unique_ptr<Articulo>> articulos;
+    // Cada tipo concreto vive en su propio pool (direcciones estables);
+    // 'articulos' conserva el orden de inserción y define el slot
+    PoolArticulos<EquipoMedico> equipos;
+    PoolArticulos<MobiliarioClinico> mobiliarios;
+    std::vector<Articulo*> articulos;
+    IndiceCodigos indiceCodigos;    // código -> posición en 'articulos'
+    ColumnasArticulos columnas;     // copia columnar para los agregados
+    IndiceBitmaps bitmaps;          // slots por valor de estado, tipo, marca y área
+    IndiceOrdenado ordenUnitario;   // slots por costo unitario
+    IndiceOrdenado ordenTotal;      // slots por costo total a la fecha de corte
+    IndiceOrdenado ordenIngreso;    // slots por día de ingreso
+    ContadoresInventario contadores; // cantidades y costos por tipo/estado
+    RankingTecnicos rankingTecnicos; // carga de equipos por técnico
+    FechaCorte fechaCorte = FechaCorte::Hoy();  // "hoy" para depreciaciones
+    AgregadorParalelo agregador;     // recorridos por bloques en varios hilos
+    std::unique_ptr<DiarioInventario> diario;  // write-ahead de cambios, si está abierto
+    SeguimientoCambios cambios;      // slots modificados desde el snapshot base
+    SeguimientoCambios reubicados;   // slots cuyo artículo cambió de área
+    std::string archivoBase;         // snapshot al que se refiere 'cambios'
+    std::uint64_t sumaBase = 0;      // su suma de verificación
+    bool indicesDiferidos = false;   // carga masiva: los índices ordenados se rehacen al final
+    
+    std::uint32_t buscarSlot(std::string_view codigo) const;
+    std::array<int, 256> contarPorArea(MedicalInventory::Domain::ArticleType tipo) const;
+    void registrarArticulo(Articulo& articulo);
+    void quitarSlot(std::uint32_t slot);
+    void releerFila(std::uint32_t slot, const Articulo& articulo);
+    void reconstruirIndicesOrdenados();
+    const IndiceOrdenado& indiceCostos(CriterioCosto criterio) const noexcept {
+        return (criterio == CriterioCosto::TOTAL) ? ordenTotal : ordenUnitario;
+    }
+    void reenlazarArticulos() noexcept;
+    EscritorSnapshot crearSnapshot() const;
+    std::uint32_t cargarBase(const std::string& nombreArchivo);
+    void aplicarRegistro(const RegistroDiario& registro, const std::string& rutaDiario);
+    
+    // Mantiene índices y columnas al día cuando un artículo cambia; si
+    // falla deja todo como estaba y el setter restaura el artículo
+    void OnArticleChanged(const Articulo& articulo,
+                          MedicalInventory::Domain::ArticleChange cambio) override;
     
 public:
     // Constructor y destructor
     Inventario() = default;
-    ~Inventario() = default;
+    ~Inventario() override = default;
+    
+    // Los artículos apuntan a su inventario: mover implica reenlazarlos
+    Inventario(Inventario&& otro) noexcept;
+    Inventario& operator=(Inventario&& otro) noexcept;
+    Inventario(const Inventario&) = delete;
+    Inventario& operator=(const Inventario&) = delete;
     
     // Métodos principales del sistema
     void agregarArticulo(std::unique_ptr<Articulo> articulo);
+    void agregarArticulo(EquipoMedico&& equipo);
+    void agregarArticulo(MobiliarioClinico&& mobiliario);
+    void reservar(size_t cantidad);  // Preasignar para cargas masivas
+    
+    // Bajas: el último artículo ocupa el slot liberado. Devuelven false si
+    // el código no existe (o si ya existe en el destino del traslado)
+    bool eliminarArticulo(std::string_view codigo);
+    bool trasladarArticulo(std::string_view codigo, Inventario& destino);
+    
+    // Artículos cuya área o ubicación cambió desde la llamada anterior
+    // (puede incluir alguno que no cambió)
+    std::vector<Articulo*> extraerReubicados();
+    
+    // Aplica un lote de eventos en orden (ver AplicadorEventos); los códigos
+    // desconocidos se ignoran. Devuelve cuántos encontraron su artículo
+    size_t aplicarEventos(const std::vector<EventoInventario>& eventos);
+    
+    // Los recorridos completos usan varios hilos a partir de este tamaño;
+    // el resultado no depende del número de hilos
+    void configurarUmbralParalelo(size_t umbral) noexcept { agregador.configurarUmbral(umbral); }
+    size_t obtenerUmbralParalelo() const noexcept { return agregador.umbral(); }
     
     // a) Ingresar nuevos artículos - implementado con agregarArticulo
     
@@ -34,15 +141,33 @@ public:
     // d) Calcular costo total por categoría
     double calcularCostoTotalPorCategoria(TipoArticulo tipo) const;
     std::map<TipoArticulo, double> calcularCostosPorCategoria() const;
+    double calcularCostoTotalPorEstado(EstadoArticulo estado) const;
     
     // e) Calcular costo más alto y más bajo
     std::pair<double, double> obtenerCostosMinMax() const;
     Articulo* obtenerArticuloMasCaro() const;
     Articulo* obtenerArticuloMasBarato() const;
+    ResumenCostos obtenerResumenCostos(CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+    
+    // Consultas sobre el índice ordenado de costos, en O(log n) más el
+    // tamaño del resultado. Los empates salen en orden de slot
+    std::vector<Articulo*> obtenerArticulosEntreCostos(double minimo, double maximo,
+                                                       CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+    size_t contarArticulosEntreCostos(double minimo, double maximo,
+                                      CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+    std::vector<Articulo*> obtenerArticulosMasCaros(size_t k, CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+    std::vector<Articulo*> obtenerArticulosMasBaratos(size_t k, CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+    // Solo entre los slots de 'candidatos' (p. ej. obtenerIndiceBitmaps().estado(DAMAGED))
+    std::vector<Articulo*> obtenerArticulosMasCaros(size_t k, const MapaBits& candidatos,
+                                                    CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+    // Percentil por rango más cercano, 0 <= percentil <= 100 (lanza
+    // std::invalid_argument fuera de ese intervalo); 0 si está vacío
+    double obtenerPercentilCosto(double percentil, CriterioCosto criterio = CriterioCosto::UNITARIO) const;
     
     // f) Mostrar técnico con más equipos asignados
     std::string obtenerTecnicoConMasEquipos() const;
     std::map<std::string, int> contarEquiposPorTecnico() const;
+    std::vector<std::pair<std::string, int>> obtenerTecnicosConMasEquipos(size_t k) const;
     
     // g) Calcular valor con plus para cada mobiliario
     std::vector<std::pair<MobiliarioClinico*, double>> calcularValoresConPlus() const;
@@ -57,18 +182,55 @@ public:
     std::vector<Articulo*> filtrarPorEstado(EstadoArticulo estado) const;
     std::vector<Articulo*> filtrarPorTipo(TipoArticulo tipo) const;
     
+    // Predicados combinados (ver Filtro) en un solo recorrido de las columnas
+    template <typename Condicion>
+    std::vector<Articulo*> filtrar(const Filtro::Predicado<Condicion>& predicado) const;
+    template <typename Condicion>
+    size_t contar(const Filtro::Predicado<Condicion>& predicado) const;
+    
+    // Índice de bitmaps: las conjunciones de enumeraciones se resuelven con
+    // AND/OR de mapas (cardinalidad() da el conteo) y solo el resultado se
+    // convierte en artículos
+    const IndiceBitmaps& obtenerIndiceBitmaps() const noexcept { return bitmaps; }
+    std::vector<Articulo*> obtenerArticulos(const MapaBits& slots) const;
+    
+    // Fecha de referencia de las depreciaciones. A diferencia del antiguo
+    // CalculateTotalCost, que leía el reloj en cada llamada, las consultas
+    // usan la fecha fijada al construir o en la última actualización: un
+    // proceso que sigue abierto al cambiar de año debe llamar a
+    // refrescarFechaCorte (la GUI lo hace antes de cada comando)
+    const FechaCorte& obtenerFechaCorte() const { return fechaCorte; }
+    void actualizarFechaCorte(const FechaCorte& corte = FechaCorte::Hoy());
+    // Avanza la fecha de corte hasta 'hoy' si el reloj pasó de día; los
+    // costos totales solo se recalculan si cambió el año. Devuelve si cambió
+    bool refrescarFechaCorte(const FechaCorte& hoy = FechaCorte::Hoy());
+    
     // Estadísticas
     size_t obtenerCantidadTotal() const { return articulos.size(); }
     size_t obtenerCantidadPorTipo(TipoArticulo tipo) const;
     size_t obtenerCantidadPorEstado(EstadoArticulo estado) const;
     
     // Validación
-    bool existeCodigo(const std::string& codigo) const;
+    bool existeCodigo(std::string_view codigo) const;
     
     // Métodos adicionales de mejora
     std::vector<EquipoMedico*> obtenerEquiposQueNecesitanMantenimiento() const;
     std::map<std::string, double> calcularValorTotalPorTecnico() const;
     std::vector<Articulo*> obtenerArticulosRecientes(int dias = 30) const;
+    
+    // Consultas por fecha de ingreso sobre el índice ordenado: búsqueda
+    // binaria y recorrido contiguo, en orden cronológico. Los recientes son
+    // los ingresados como mucho 'dias' días antes de la fecha de corte
+    std::vector<Articulo*> obtenerArticulosIngresadosEntre(std::int32_t desde, std::int32_t hasta) const;
+    // Fechas DD/MM/YYYY; lanza std::invalid_argument si alguna no es válida
+    std::vector<Articulo*> obtenerArticulosIngresadosEntre(std::string_view desde, std::string_view hasta) const;
+    size_t contarArticulosIngresadosEntre(std::int32_t desde, std::int32_t hasta) const;
+    // Un elemento por periodo que toca [desde, hasta], también los vacíos;
+    // solo cuentan los ingresos dentro del intervalo. Meses y años son los
+    // del calendario y las semanas empiezan en 'desde'. El intervalo se
+    // recorta antes a [Fecha::PRIMER_DIA, Fecha::ULTIMO_DIA]
+    std::vector<IngresosPeriodo> obtenerIngresosPorPeriodo(PeriodoIngreso periodo, std::int32_t desde,
+                                                           std::int32_t hasta) const;
     double calcularDepreciacionTotal() const;
     std::map<AreaUso, int> contarEquiposPorArea() const;
     std::map<AreaUbicacion, int> contarMobiliarioPorArea() const;
@@ -79,7 +241,53 @@ public:
     
     // Persistencia (opcional para futuras mejoras)
     void guardarEnArchivo(const std::string& nombreArchivo) const;
-    void cargarDeArchivo(const std::string& nombreArchivo);
+    void cargarDeArchivo(const std::string& nombreArchivo);  // cierra el diario abierto
+    
+    // Archivo columnar comprimido para los históricos: ocupa una fracción
+    // del snapshot y LectorColumnar agrega sobre él sin crear artículos
+    void exportarColumnar(const std::string& nombreArchivo) const;
+    void importarColumnar(const std::string& nombreArchivo);  // cierra el diario abierto
+    
+    // Guardado incremental: solo los artículos modificados desde el último
+    // snapshot completo van a un segmento delta (nombreArchivo + ".delta"),
+    // que cargarDeArchivo aplica sobre la base. fusionarCambios reescribe
+    // la base completa y descarta el delta
+    void guardarCambios(const std::string& nombreArchivo);
+    void fusionarCambios(const std::string& nombreArchivo);
+    size_t obtenerCantidadModificados() const noexcept { return cambios.size(); }
+    
+    // Diario write-ahead: abrirDiario recupera snapshot + diario (sustituye
+    // el contenido) y desde ahí cada cambio se anexa al diario. Los cambios
+    // se sincronizan en grupo; confirmarCambios espera a que estén en disco
+    ResultadoRecuperacion abrirDiario(const std::string& rutaSnapshot, const OpcionesDiario& opciones = {});
+    void confirmarCambios();
+    void compactarDiario();  // nuevo snapshot en segundo plano, diario vacío
+    void cerrarDiario();
+    bool tieneDiario() const noexcept { return diario != nullptr; }
 };
 
+// Bloques en paralelo; cada uno conserva el orden de slot
+template <typename Condicion>
+std::vector<Articulo*> Inventario::filtrar(const Filtro::Predicado<Condicion>& predicado) const {
+    using Parcial = std::vector<Articulo*>;
+    const Condicion& condicion = predicado.derivado();
+    return agregador.reducir<Parcial>(columnas.size(),
+        [this, &condicion](Parcial& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                if (condicion(columnas, slot)) parcial.push_back(articulos[slot]);
+            }
+        },
+        [](Parcial& total, Parcial&& bloque) { total.insert(total.end(), bloque.begin(), bloque.end()); });
+}
+
+template <typename Condicion>
+size_t Inventario::contar(const Filtro::Predicado<Condicion>& predicado) const {
+    const Condicion& condicion = predicado.derivado();
+    return agregador.reducir<size_t>(columnas.size(),
+        [this, &condicion](size_t& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) parcial += condicion(columnas, slot) ? 1 : 0;
+        },
+        [](size_t& total, const size_t bloque) { total += bloque; });
+}
+
 #endif // INVENTARIO_HPP
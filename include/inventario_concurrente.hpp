@@ -0,0 +1,292 @@
+/**
+ * @file inventario_concurrente.hpp
+ * @brief Inventory with snapshot-isolated readers and copy-on-write writers
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef INVENTARIO_CONCURRENTE_HPP
+#define INVENTARIO_CONCURRENTE_HPP
+
+#include "articulo.hpp"
+#include "equipo_medico.hpp"
+#include "mobiliario_clinico.hpp"
+#include "indice_codigos.hpp"
+#include "contadores_inventario.hpp"
+#include "agregacion_paralela.hpp"
+#include "gestor_epocas.hpp"
+#include "evento_inventario.hpp"
+#include "fecha.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class Inventario;
+class LecturaInventario;
+class EscrituraInventario;
+
+/**
+ * @brief Article set shared by threads without blocking readers on writers
+ *
+ * Every published version is immutable. Articles live in chunks of
+ * ARTICULOS_POR_TROZO slots and the code index in TROZOS_INDICE hash
+ * partitions; a write copies only the chunks, partitions and articles it
+ * touches, builds a new version beside the current one and publishes it
+ * with a single atomic store. Readers call leer() and keep working on the
+ * version they got, however long their report runs, while writers go on
+ * publishing; replaced pieces are freed through GestorEpocas once no
+ * reader can reach them.
+ *
+ * Writers are serialized among themselves. Each modificar() call is one
+ * atomic batch: readers see all of it or none of it.
+ */
+class InventarioConcurrente {
+public:
+    static constexpr std::size_t ARTICULOS_POR_TROZO = 1024;
+    static constexpr std::size_t TROZOS_INDICE = 1024;
+
+    InventarioConcurrente();
+
+    /**
+     * @brief Copy every article of @p origen, keeping its slots and cutoff date
+     */
+    explicit InventarioConcurrente(const Inventario& origen);
+
+    /**
+     * No LecturaInventario may outlive the inventory.
+     */
+    ~InventarioConcurrente();
+
+    InventarioConcurrente(const InventarioConcurrente&) = delete;
+    InventarioConcurrente& operator=(const InventarioConcurrente&) = delete;
+
+    /**
+     * @brief Snapshot of the current version; never waits for writers
+     */
+    LecturaInventario leer() const noexcept;
+
+    /**
+     * @brief Apply cuerpo(EscrituraInventario&) and publish the result
+     *
+     * If cuerpo throws nothing is published and the exception propagates.
+     */
+    template <typename Cuerpo>
+    void modificar(Cuerpo&& cuerpo);
+
+    // Atajos de una sola escritura
+    bool agregarArticulo(EquipoMedico&& equipo);
+    bool agregarArticulo(MobiliarioClinico&& mobiliario);
+    bool actualizarEstado(std::string_view codigo, EstadoArticulo estado);
+    bool actualizarCosto(std::string_view codigo, double costo);
+    void actualizarFechaCorte(const FechaCorte& corte = FechaCorte::Hoy());
+
+    /**
+     * @brief Apply a batch of events as one version, like Inventario::aplicarEventos
+     * @return Events whose article was found
+     */
+    std::size_t aplicarEventos(const std::vector<EventoInventario>& eventos);
+
+    /**
+     * @brief Retired pieces still waiting for readers to leave
+     */
+    std::size_t obtenerPendientesDeLiberar() const;
+
+private:
+    friend class LecturaInventario;
+    friend class EscrituraInventario;
+
+    struct TrozoArticulos {
+        std::uint64_t version = 0;  ///< Version that created the chunk
+        std::array<const Articulo*, ARTICULOS_POR_TROZO> articulos{};
+    };
+
+    struct TrozoIndice {
+        std::uint64_t version = 0;
+        IndiceCodigos indice;
+    };
+
+    struct DirectorioIndice {
+        std::uint64_t version = 0;
+        std::array<const TrozoIndice*, TROZOS_INDICE> trozos{};  ///< nullptr while empty
+    };
+
+    struct Version {
+        std::uint64_t numero = 0;
+        std::size_t cantidad = 0;
+        std::vector<const TrozoArticulos*> trozos;
+        const DirectorioIndice* indice = nullptr;
+        ContadoresInventario contadores;
+        FechaCorte fechaCorte = FechaCorte::Hoy();
+
+        const Articulo* articulo(const std::size_t slot) const noexcept {
+            return trozos[slot / ARTICULOS_POR_TROZO]->articulos[slot % ARTICULOS_POR_TROZO];
+        }
+        std::uint32_t buscarSlot(std::string_view codigo) const;
+    };
+
+    static std::size_t trozoDeCodigo(const std::string_view codigo) noexcept {
+        static_assert(TROZOS_INDICE == 1024, "La partición toma 10 bits del hash");
+        return IndiceCodigos::hashCodigo(codigo) >> 22;  // bits altos; la sonda usa los bajos
+    }
+
+    mutable GestorEpocas m_epocas;
+    std::atomic<const Version*> m_version;
+    mutable std::mutex m_escritura;  ///< Un escritor a la vez
+    std::uint64_t m_ultimaVersion = 1;
+
+    void publicar(EscrituraInventario& escritura);
+};
+
+/**
+ * @brief One immutable version of an InventarioConcurrente
+ *
+ * Queries mirror those of Inventario and return pointers to articles that
+ * stay valid and unchanged while the handle lives. Counts and costs per
+ * type and status come from counters kept with the version; the other
+ * aggregates scan it, in several threads from the usual threshold. A
+ * handle must not outlive its inventory.
+ */
+class LecturaInventario {
+public:
+    std::uint64_t obtenerNumeroVersion() const noexcept { return m_version->numero; }
+    std::size_t obtenerCantidadTotal() const noexcept { return m_version->cantidad; }
+
+    /**
+     * @throws std::out_of_range if @p slot is not below obtenerCantidadTotal()
+     */
+    const Articulo& articulo(std::size_t slot) const;
+
+    const Articulo* buscarPorCodigo(std::string_view codigo) const;
+    bool existeCodigo(std::string_view codigo) const { return buscarPorCodigo(codigo) != nullptr; }
+
+    /**
+     * @brief Call visitar(const Articulo&) for every article in slot order
+     */
+    template <typename Visitar>
+    void paraCada(Visitar&& visitar) const;
+
+    // Filtros y agrupaciones
+    std::vector<const Articulo*> filtrarPorEstado(EstadoArticulo estado) const;
+    std::vector<const Articulo*> filtrarPorTipo(TipoArticulo tipo) const;
+    std::vector<const Articulo*> obtenerArticulosDanados() const { return filtrarPorEstado(EstadoArticulo::DAMAGED); }
+    std::map<std::string, int> contarEquiposPorTecnico() const;
+    std::map<AreaUso, int> contarEquiposPorArea() const;
+    std::map<AreaUbicacion, int> contarMobiliarioPorArea() const;
+
+    // Cantidades y costos (valor a la fecha de corte de la versión)
+    std::size_t obtenerCantidadPorTipo(TipoArticulo tipo) const noexcept;
+    std::size_t obtenerCantidadPorEstado(EstadoArticulo estado) const noexcept;
+    double calcularCostoTotalPorCategoria(TipoArticulo tipo) const noexcept;
+    std::map<TipoArticulo, double> calcularCostosPorCategoria() const;
+    double calcularCostoTotalPorEstado(EstadoArticulo estado) const noexcept;
+    std::pair<double, double> obtenerCostosMinMax() const;  // costo unitario
+    double calcularDepreciacionTotal() const;
+
+    const FechaCorte& obtenerFechaCorte() const noexcept { return m_version->fechaCorte; }
+    void configurarUmbralParalelo(std::size_t umbral) noexcept { m_agregador.configurarUmbral(umbral); }
+
+private:
+    friend class InventarioConcurrente;
+
+    LecturaInventario(GestorEpocas::Guarda guarda, const InventarioConcurrente::Version* version) noexcept
+        : m_guarda(std::move(guarda)), m_version(version) {}
+
+    template <typename Predicado>
+    std::vector<const Articulo*> filtrar(Predicado&& predicado) const;
+    std::array<int, 256> contarPorArea(TipoArticulo tipo) const;
+
+    GestorEpocas::Guarda m_guarda;  // mantiene viva la versión
+    const InventarioConcurrente::Version* m_version;
+    AgregadorParalelo m_agregador;
+};
+
+/**
+ * @brief Draft of the next version, handed to InventarioConcurrente::modificar
+ *
+ * Reads see the draft, including its own earlier changes. editar() returns
+ * a private copy of the article that can be changed with its usual setters
+ * until modificar() publishes it; the code and type of an article cannot
+ * change.
+ */
+class EscrituraInventario {
+public:
+    EscrituraInventario(const EscrituraInventario&) = delete;
+    EscrituraInventario& operator=(const EscrituraInventario&) = delete;
+    ~EscrituraInventario();
+
+    std::size_t obtenerCantidadTotal() const noexcept { return m_borrador->cantidad; }
+    const Articulo* buscarPorCodigo(std::string_view codigo) const;
+
+    /**
+     * @brief Add an article unless its code already exists
+     * @return false if the code was already present (nothing is added)
+     */
+    bool agregarArticulo(EquipoMedico&& equipo);
+    bool agregarArticulo(MobiliarioClinico&& mobiliario);
+
+    /**
+     * @brief Writable copy of the article at @p slot, or of the one with @p codigo
+     * @throws std::out_of_range if @p slot is not below obtenerCantidadTotal()
+     */
+    Articulo& editar(std::size_t slot);
+    Articulo* editar(std::string_view codigo);
+
+    void actualizarFechaCorte(const FechaCorte& corte) noexcept;
+
+private:
+    friend class InventarioConcurrente;
+
+    struct Original {
+        std::uint8_t tipo;
+        std::uint8_t estado;
+        double costoTotal;
+    };
+
+    explicit EscrituraInventario(InventarioConcurrente& inventario);
+
+    InventarioConcurrente& m_inventario;
+    const InventarioConcurrente::Version* m_anterior;
+    std::unique_ptr<InventarioConcurrente::Version> m_borrador;
+    std::unique_ptr<InventarioConcurrente::DirectorioIndice> m_indice;  // copia, si se insertó algo
+
+    // Piezas nuevas (se liberan si no se publica) y piezas que sustituyen
+    std::vector<std::unique_ptr<InventarioConcurrente::TrozoArticulos>> m_trozosNuevos;
+    std::vector<std::unique_ptr<InventarioConcurrente::TrozoIndice>> m_indicesNuevos;
+    std::vector<std::unique_ptr<Articulo>> m_articulosNuevos;
+    std::vector<const InventarioConcurrente::TrozoArticulos*> m_trozosReemplazados;
+    std::vector<const InventarioConcurrente::TrozoIndice*> m_indicesReemplazados;
+    std::vector<const Articulo*> m_articulosReemplazados;
+
+    // Slots propios del borrador; los que ya existían guardan su fila original
+    std::unordered_map<std::uint32_t, std::optional<Original>> m_tocados;
+    bool m_fechaCambiada = false;
+
+    InventarioConcurrente::TrozoArticulos& trozoPropio(std::size_t slot);
+    InventarioConcurrente::TrozoIndice& indicePropio(std::size_t particion);
+    bool insertar(std::unique_ptr<Articulo> articulo);
+    bool hayCambios() const noexcept { return !m_tocados.empty() || m_fechaCambiada; }
+};
+
+template <typename Cuerpo>
+void InventarioConcurrente::modificar(Cuerpo&& cuerpo) {
+    std::lock_guard<std::mutex> bloqueo(m_escritura);
+    EscrituraInventario escritura(*this);
+    cuerpo(escritura);
+    publicar(escritura);
+}
+
+template <typename Visitar>
+void LecturaInventario::paraCada(Visitar&& visitar) const {
+    for (std::size_t slot = 0; slot < m_version->cantidad; ++slot) visitar(*m_version->articulo(slot));
+}
+
+#endif // INVENTARIO_CONCURRENTE_HPP
@@ -0,0 +1,165 @@
+/**
+ * @file inventario_por_areas.hpp
+ * @brief Inventory partitioned into one Inventario per hospital area
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef INVENTARIO_POR_AREAS_HPP
+#define INVENTARIO_POR_AREAS_HPP
+
+#include "inventario.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Hospital areas; equipment usage areas and furniture locations
+ *        with the same name share one
+ */
+enum class AreaHospital : std::uint8_t {
+    EMERGENCIA,
+    PEDIATRIA,
+    QUIROFANO,
+    CONSULTA
+};
+
+/**
+ * @brief One Inventario (storage, indexes and counters) per hospital area
+ *
+ * An article lives in the area given by its AreaUso or AreaUbicacion, so
+ * per-area reports only touch that area, and area counts come straight
+ * from its counters. Queries over the whole hospital run on every area
+ * and merge the results in area order. Codes are unique across areas.
+ * Once the inventory reaches the parallel threshold the areas run one
+ * per thread, unless some area reaches it by itself: its own queries
+ * already use every core, so the areas then run one after another.
+ *
+ * Sharding splits the data, not the locking. Like Inventario, this class
+ * is not safe for concurrent use and callers must serialize every call,
+ * reads included; there is no per-area lock and area() is read-only.
+ * Additions, removals and area changes look at every area (for code
+ * uniqueness and pending moves), so writers to different areas would not
+ * be independent anyway.
+ *
+ * Changing the area of an article moves it to its new area: a copy is
+ * added there and the original removed, at a cost independent of the
+ * inventory size. Pointers to a moved article become invalid. Changes
+ * made through cambiarArea() move the article at once; changes made
+ * directly on an article are picked up by the next call of a non-const
+ * member (or sincronizarAreas()), and until then the article is still
+ * reported in its old area.
+ */
+class InventarioPorAreas {
+public:
+    static constexpr std::size_t AREAS = 4;
+
+    static AreaHospital areaDe(AreaUso area) noexcept;
+    static AreaHospital areaDe(AreaUbicacion area) noexcept;
+    static AreaHospital areaDe(const Articulo& articulo) noexcept;
+
+    /**
+     * @brief Inventory of one area, for per-area queries
+     */
+    const Inventario& area(AreaHospital area) const noexcept { return m_areas[static_cast<std::size_t>(area)]; }
+
+    // Altas y bajas; un código ya presente en cualquier área se ignora
+    void agregarArticulo(std::unique_ptr<Articulo> articulo);
+    void agregarArticulo(EquipoMedico&& equipo);
+    void agregarArticulo(MobiliarioClinico&& mobiliario);
+    bool eliminarArticulo(std::string_view codigo);
+
+    /**
+     * @brief Change the area of an article and move it there
+     * @return false if the code does not exist
+     */
+    bool cambiarArea(std::string_view codigo, AreaUso area);
+    bool cambiarArea(std::string_view codigo, AreaUbicacion area);
+
+    /**
+     * @brief Move the articles whose area was changed directly on them
+     * @return Number of articles moved
+     */
+    std::size_t sincronizarAreas();
+
+    void configurarUmbralParalelo(std::size_t umbral) noexcept;
+    std::size_t obtenerUmbralParalelo() const noexcept { return m_agregador.umbral(); }
+
+    void actualizarFechaCorte(const FechaCorte& corte = FechaCorte::Hoy());
+    const FechaCorte& obtenerFechaCorte() const { return m_areas[0].obtenerFechaCorte(); }
+
+    // Consultas sobre todas las áreas
+    Articulo* buscarPorCodigo(std::string_view codigo) const;
+    bool existeCodigo(std::string_view codigo) const;
+    std::vector<Articulo*> obtenerTodosLosArticulos() const;
+    std::vector<Articulo*> filtrarPorEstado(EstadoArticulo estado) const;
+    std::vector<Articulo*> filtrarPorTipo(TipoArticulo tipo) const;
+    template <typename Condicion>
+    std::vector<Articulo*> filtrar(const Filtro::Predicado<Condicion>& predicado) const;
+    template <typename Condicion>
+    size_t contar(const Filtro::Predicado<Condicion>& predicado) const;
+
+    size_t obtenerCantidadTotal() const noexcept;
+    size_t obtenerCantidadPorTipo(TipoArticulo tipo) const;
+    size_t obtenerCantidadPorEstado(EstadoArticulo estado) const;
+    size_t obtenerCantidadPorArea(AreaHospital area) const noexcept { return this->area(area).obtenerCantidadTotal(); }
+    double calcularCostoTotalPorCategoria(TipoArticulo tipo) const;
+    double calcularCostoTotalPorEstado(EstadoArticulo estado) const;
+    double calcularDepreciacionTotal() const;
+    ResumenCostos obtenerResumenCostos(CriterioCosto criterio = CriterioCosto::UNITARIO) const;
+
+    std::string obtenerTecnicoConMasEquipos() const;
+    std::map<std::string, int> contarEquiposPorTecnico() const;
+    std::map<std::string, double> calcularValorTotalPorTecnico() const;
+    std::map<AreaUso, int> contarEquiposPorArea() const;
+    std::map<AreaUbicacion, int> contarMobiliarioPorArea() const;
+
+private:
+    std::array<Inventario, AREAS> m_areas;
+    AgregadorParalelo m_agregador;  // reparto de las consultas entre áreas
+
+    Inventario& inventarioDe(AreaHospital area) noexcept { return m_areas[static_cast<std::size_t>(area)]; }
+    std::size_t areaConCodigo(std::string_view codigo) const;
+    bool areasEnParalelo() const noexcept;
+
+    template <typename Resultado, typename Consulta>
+    std::array<Resultado, AREAS> consultarAreas(Consulta&& consulta) const;
+    static std::vector<Articulo*> concatenar(std::array<std::vector<Articulo*>, AREAS>&& partes);
+};
+
+// Cada área en su propio hilo si toca (ver areasEnParalelo); los
+// resultados quedan en orden de área
+template <typename Resultado, typename Consulta>
+std::array<Resultado, InventarioPorAreas::AREAS> InventarioPorAreas::consultarAreas(Consulta&& consulta) const {
+    std::array<Resultado, AREAS> resultados{};
+    const auto tarea = [&](const std::size_t area) { resultados[area] = consulta(m_areas[area]); };
+    if (areasEnParalelo()) {
+        m_agregador.ejecutar(AREAS, tarea);
+    } else {
+        for (std::size_t area = 0; area < AREAS; ++area) tarea(area);
+    }
+    return resultados;
+}
+
+template <typename Condicion>
+std::vector<Articulo*> InventarioPorAreas::filtrar(const Filtro::Predicado<Condicion>& predicado) const {
+    return concatenar(consultarAreas<std::vector<Articulo*>>(
+        [&predicado](const Inventario& inventario) { return inventario.filtrar(predicado); }));
+}
+
+template <typename Condicion>
+size_t InventarioPorAreas::contar(const Filtro::Predicado<Condicion>& predicado) const {
+    size_t total = 0;
+    for (const size_t parcial : consultarAreas<size_t>(
+             [&predicado](const Inventario& inventario) { return inventario.contar(predicado); })) {
+        total += parcial;
+    }
+    return total;
+}
+
+#endif // INVENTARIO_POR_AREAS_HPP
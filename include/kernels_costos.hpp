@@ -0,0 +1,56 @@
+/**
+ * @file kernels_costos.hpp
+ * @brief Vectorized scan kernels over contiguous cost columns
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef KERNELS_COSTOS_HPP
+#define KERNELS_COSTOS_HPP
+
+#include <cstddef>
+
+/**
+ * @brief Minimum, maximum and their positions in a cost array
+ *
+ * Positions follow std::min_element / std::max_element: the first
+ * occurrence wins on ties.
+ */
+struct ExtremosCostos {
+    double minimo = 0.0;
+    double maximo = 0.0;
+    std::size_t indiceMinimo = 0;
+    std::size_t indiceMaximo = 0;
+};
+
+namespace KernelsCostos {
+    /**
+     * @brief Fused min/max/argmin/argmax in a single pass
+     *
+     * For a full scan where no index exists: Inventario answers min/max
+     * from its ordered cost index, LectorColumnar has no index and runs
+     * this over the decoded cost blocks of an archive.
+     *
+     * On x86-64 the AVX or SSE2 loop is chosen once at run time
+     * from the CPU features (at build time with MSVC); other targets use
+     * the scalar loop. Costs are validated on entry to the inventory, so
+     * the input never contains NaN.
+     *
+     * @param costos Contiguous costs
+     * @param cantidad Number of elements (must be > 0)
+     */
+    ExtremosCostos calcularExtremos(const double* costos, std::size_t cantidad) noexcept;
+
+    /**
+     * @brief Portable reference implementation of calcularExtremos()
+     */
+    ExtremosCostos calcularExtremosEscalar(const double* costos, std::size_t cantidad) noexcept;
+
+    /**
+     * @brief Instruction set calcularExtremos() runs with: "avx", "sse2" or
+     *        "escalar"
+     */
+    const char* varianteActiva() noexcept;
+}
+
+#endif // KERNELS_COSTOS_HPP
@@ -0,0 +1,122 @@
+/**
+ * @file mapa_bits.hpp
+ * @brief Compressed bitmap of slots (roaring-style array and bitmap chunks)
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef MAPA_BITS_HPP
+#define MAPA_BITS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Set of 32-bit slots split into chunks of 65536 by the high half
+ *
+ * A chunk stores the low halves as a sorted array until it holds more
+ * than UMBRAL_ARREGLO members, then as a plain 8 KiB bitmap (and back to
+ * an array once removals leave it half that full). Sparse
+ * values therefore cost two bytes each and dense ones one bit, and AND /
+ * OR combine bitmap chunks a 64-bit word at a time. Every chunk keeps its
+ * cardinality, so counts never visit the members.
+ *
+ * agregar() either adds the value or throws leaving the set unchanged.
+ * quitar() never throws: if there is no memory to turn a chunk back into
+ * an array it stays a bitmap, which is valid at any cardinality.
+ */
+class MapaBits {
+public:
+    static constexpr std::size_t UMBRAL_ARREGLO = 4096;
+
+    void agregar(std::uint32_t valor);
+    void quitar(std::uint32_t valor) noexcept;
+    bool contiene(std::uint32_t valor) const noexcept;
+
+    std::size_t cardinalidad() const noexcept;
+    bool vacio() const noexcept { return m_claves.empty(); }
+    void limpiar() noexcept;
+
+    MapaBits& operator&=(const MapaBits& otro);
+    MapaBits& operator|=(const MapaBits& otro);
+    friend MapaBits operator&(const MapaBits& a, const MapaBits& b);
+
+    /**
+     * @brief Size of the intersection, by popcount, without building it
+     */
+    static std::size_t contarInterseccion(const MapaBits& a, const MapaBits& b) noexcept;
+
+    /**
+     * @brief Call funcion(valor) for every member in ascending order
+     */
+    template <typename Funcion>
+    void paraCada(Funcion&& funcion) const;
+
+    /**
+     * @brief Bytes held by the chunks (for sizing reports)
+     */
+    std::size_t memoriaUsada() const noexcept;
+
+private:
+    static constexpr std::size_t PALABRAS = 65536 / 64;
+
+    // Un contenedor por valor de los 16 bits altos: arreglo ordenado o mapa
+    struct Contenedor {
+        std::uint32_t cantidad = 0;
+        std::vector<std::uint16_t> arreglo;  ///< Used while cantidad <= UMBRAL_ARREGLO
+        std::vector<std::uint64_t> palabras; ///< PALABRAS words once denser
+
+        bool esMapa() const noexcept { return !palabras.empty(); }
+        bool contiene(std::uint16_t valor) const noexcept;
+        void agregar(std::uint16_t valor);
+        void quitar(std::uint16_t valor) noexcept;
+        void aMapa();
+        void aArreglo();
+        void ajustar();  // representación según la cantidad
+    };
+
+    std::vector<std::uint16_t> m_claves;  ///< Sorted high halves
+    std::vector<Contenedor> m_contenedores;
+
+    static Contenedor interseccion(const Contenedor& a, const Contenedor& b);
+    static void unir(Contenedor& destino, const Contenedor& otro);
+    static std::size_t contarInterseccion(const Contenedor& a, const Contenedor& b) noexcept;
+
+    static std::size_t contarCerosFinales(std::uint64_t palabra) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(palabra));
+#else
+        std::size_t n = 0;
+        while ((palabra & 1u) == 0) {
+            palabra >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+};
+
+MapaBits operator|(MapaBits a, const MapaBits& b);
+
+template <typename Funcion>
+void MapaBits::paraCada(Funcion&& funcion) const {
+    for (std::size_t i = 0; i < m_claves.size(); ++i) {
+        const std::uint32_t alto = static_cast<std::uint32_t>(m_claves[i]) << 16;
+        const Contenedor& contenedor = m_contenedores[i];
+        if (!contenedor.esMapa()) {
+            for (const std::uint16_t bajo : contenedor.arreglo) funcion(alto | bajo);
+            continue;
+        }
+        for (std::size_t p = 0; p < PALABRAS; ++p) {
+            std::uint64_t palabra = contenedor.palabras[p];
+            while (palabra != 0) {
+                const auto bit = static_cast<std::uint32_t>(contarCerosFinales(palabra));
+                palabra &= palabra - 1;
+                funcion(alto | static_cast<std::uint32_t>(p * 64 + bit));
+            }
+        }
+    }
+}
+
+#endif // MAPA_BITS_HPP
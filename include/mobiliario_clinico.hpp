@@ -17,9 +17,9 @@ enum class AreaUbicacion {
     QUIROFANO
 };
 
-class MobiliarioClinico : public Articulo {
+class MobiliarioClinico final : public Articulo {
 private:
-    std::string material;
+    TablaSimbolos::Id materialId;  // material internado en TablaSimbolos::global()
     AreaUbicacion areaUbicacion;
     static const double PLUS_CONSULTA;
     static const double PLUS_EMERGENCIA;
@@ -31,21 +31,23 @@ public:
     using ArticleType = Articulo::ArticleType;
 
     // Constructor - updated to use new enum names
-    MobiliarioClinico(const std::string& codigo, const std::string& fechaIngreso,
+    MobiliarioClinico(std::string_view codigo, std::string_view fechaIngreso,
                       ArticleStatus estado, double costoUnitario, 
-                      const std::string& material, AreaUbicacion area);
+                      std::string_view material, AreaUbicacion area);
     
     // Getters específicos
-    const std::string& getMaterial() const { return material; }
+    const std::string& getMaterial() const noexcept { return TablaSimbolos::global().texto(materialId); }
+    TablaSimbolos::Id getMaterialId() const { return materialId; }
     AreaUbicacion getAreaUbicacion() const { return areaUbicacion; }
     
     // Setters específicos
     void setMaterial(const std::string& nuevoMaterial);
-    void setAreaUbicacion(AreaUbicacion area) { areaUbicacion = area; }
+    void setAreaUbicacion(AreaUbicacion area) { AssignAndNotify(areaUbicacion, area, ArticleChange::LOCATION); }
     
     // New interface methods (override virtual methods from base)
     std::string GetDetailedInfo() const override;
     double CalculateTotalCost() const override;
+    double CalculateTotalCost(const FechaCorte&) const { return calcularValorConPlus(); }
     
     // Legacy methods for compatibility (deprecated)
     [[deprecated("Use GetDetailedInfo() instead")]]
@@ -60,7 +62,8 @@ public:
     
     // Funciones auxiliares estáticas
     static std::string areaUbicacionToString(AreaUbicacion area);
-    static AreaUbicacion stringToAreaUbicacion(const std::string& str);
+    static std::string_view nombreAreaUbicacion(AreaUbicacion area) noexcept;  // sin asignar memoria
+    static AreaUbicacion stringToAreaUbicacion(std::string_view str);  // grafía exacta o invalid_argument
     static double getPlusPorArea(AreaUbicacion area);
 };
 
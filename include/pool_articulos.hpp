@@ -0,0 +1,211 @@
+/**
+ * @file pool_articulos.hpp
+ * @brief Slab allocator that owns the concrete article objects of an inventory
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef POOL_ARTICULOS_HPP
+#define POOL_ARTICULOS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Pool of @c T objects carved out of large fixed-size blocks
+ *
+ * Objects never move once created, so raw pointers stay valid until the
+ * object is destroyed. Freed cells are reused (LIFO) before a new block is
+ * requested; the free list is threaded through the freed cells
+ * themselves, so it costs no memory and destruir() never allocates. A full
+ * inventory load therefore costs one allocation per OBJETOS_POR_BLOQUE
+ * articles, and teardown releases whole blocks.
+ *
+ * @tparam T Concrete article type (EquipoMedico or MobiliarioClinico)
+ */
+template <typename T>
+class PoolArticulos {
+public:
+    static constexpr std::size_t OBJETOS_POR_BLOQUE = 4096;
+    static_assert(sizeof(T) >= sizeof(std::size_t), "una celda libre guarda el índice de la siguiente");
+
+    PoolArticulos() = default;
+    ~PoolArticulos() { limpiar(); }
+
+    PoolArticulos(const PoolArticulos&) = delete;
+    PoolArticulos& operator=(const PoolArticulos&) = delete;
+
+    PoolArticulos(PoolArticulos&& otro) noexcept
+        : m_bloques(std::move(otro.m_bloques)),
+          m_porDireccion(std::move(otro.m_porDireccion)),
+          m_libre(otro.m_libre),
+          m_usadas(otro.m_usadas),
+          m_vivos(otro.m_vivos) {
+        otro.m_libre = SIN_CELDA;
+        otro.m_usadas = 0;
+        otro.m_vivos = 0;
+    }
+
+    PoolArticulos& operator=(PoolArticulos&& otro) noexcept {
+        if (this != &otro) {
+            limpiar();
+            m_bloques = std::move(otro.m_bloques);
+            m_porDireccion = std::move(otro.m_porDireccion);
+            m_libre = otro.m_libre;
+            m_usadas = otro.m_usadas;
+            m_vivos = otro.m_vivos;
+            otro.m_libre = SIN_CELDA;
+            otro.m_usadas = 0;
+            otro.m_vivos = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Construct a new object inside the pool
+     * @return Reference to the object (address stable until destruir())
+     */
+    template <typename... Args>
+    T& crear(Args&&... args) {
+        const bool reciclada = m_libre != SIN_CELDA;
+        const std::size_t celda = reciclada ? m_libre : m_usadas;
+        if (celda == m_bloques.size() * OBJETOS_POR_BLOQUE) agregarBloque();
+
+        Bloque& bloque = *m_bloques[celda / OBJETOS_POR_BLOQUE];
+        const std::size_t indice = celda % OBJETOS_POR_BLOQUE;
+        const std::size_t siguiente = reciclada ? bloque.siguienteLibre(indice) : SIN_CELDA;
+        T* objeto;
+        try {
+            objeto = ::new (bloque.direccion(indice)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            // El constructor pudo escribir en la celda antes de fallar
+            if (reciclada) bloque.enlazarLibre(indice, siguiente);
+            throw;
+        }
+        bloque.marcar(indice, true);
+        if (reciclada) m_libre = siguiente;
+        else ++m_usadas;
+        ++m_vivos;
+        return *objeto;
+    }
+
+    /**
+     * @brief Destroy an object created by this pool and recycle its cell
+     *
+     * Never allocates: the cell itself becomes the head of the free list.
+     */
+    void destruir(T& objeto) noexcept {
+        // Bloque con la mayor dirección inicial que no supere al objeto
+        const auto* direccion = reinterpret_cast<const unsigned char*>(&objeto);
+        auto it = std::upper_bound(m_porDireccion.begin(), m_porDireccion.end(), direccion,
+            [](const unsigned char* d, const auto& entrada) { return d < entrada.first; });
+        const std::size_t b = std::prev(it)->second;
+        Bloque& bloque = *m_bloques[b];
+        const std::size_t indice = bloque.indiceDe(&objeto);
+        objeto.~T();
+        bloque.enlazarLibre(indice, m_libre);
+        m_libre = b * OBJETOS_POR_BLOQUE + indice;
+        bloque.marcar(indice, false);
+        --m_vivos;
+    }
+
+    /**
+     * @brief Visit every live object in storage order
+     */
+    template <typename Funcion>
+    void paraCada(Funcion&& funcion) const {
+        for (const auto& bloque : m_bloques) {
+            for (std::size_t palabra = 0; palabra < PALABRAS_POR_BLOQUE; ++palabra) {
+                std::uint64_t vivos = bloque->vivos[palabra];
+                while (vivos != 0) {
+                    const std::size_t bit = contarCerosFinales(vivos);
+                    vivos &= vivos - 1;
+                    funcion(*bloque->objeto(palabra * 64 + bit));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Destroy every object and release all blocks at once
+     */
+    void limpiar() noexcept {
+        paraCada([](T& objeto) { objeto.~T(); });
+        m_bloques.clear();
+        m_porDireccion.clear();
+        m_libre = SIN_CELDA;
+        m_usadas = 0;
+        m_vivos = 0;
+    }
+
+    std::size_t size() const noexcept { return m_vivos; }
+    bool empty() const noexcept { return m_vivos == 0; }
+
+private:
+    static constexpr std::size_t PALABRAS_POR_BLOQUE = OBJETOS_POR_BLOQUE / 64;
+    static constexpr std::size_t SIN_CELDA = SIZE_MAX;
+
+    struct Bloque {
+        alignas(T) unsigned char datos[OBJETOS_POR_BLOQUE * sizeof(T)];
+        std::uint64_t vivos[PALABRAS_POR_BLOQUE] = {};  ///< Bit set per live cell
+
+        void* direccion(const std::size_t indice) noexcept { return datos + indice * sizeof(T); }
+        T* objeto(const std::size_t indice) const noexcept {
+            return std::launder(reinterpret_cast<T*>(const_cast<unsigned char*>(datos) + indice * sizeof(T)));
+        }
+        std::size_t indiceDe(const T* objeto) const noexcept {
+            return static_cast<std::size_t>(reinterpret_cast<const unsigned char*>(objeto) - datos) / sizeof(T);
+        }
+        // Una celda libre guarda en sus primeros bytes la siguiente celda libre
+        std::size_t siguienteLibre(const std::size_t indice) const noexcept {
+            std::size_t siguiente;
+            std::memcpy(&siguiente, datos + indice * sizeof(T), sizeof siguiente);
+            return siguiente;
+        }
+        void enlazarLibre(const std::size_t indice, const std::size_t siguiente) noexcept {
+            std::memcpy(direccion(indice), &siguiente, sizeof siguiente);
+        }
+        void marcar(const std::size_t indice, const bool vivo) noexcept {
+            const std::uint64_t bit = std::uint64_t{1} << (indice % 64);
+            if (vivo) vivos[indice / 64] |= bit;
+            else vivos[indice / 64] &= ~bit;
+        }
+    };
+
+    static std::size_t contarCerosFinales(std::uint64_t valor) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(valor));
+#else
+        std::size_t n = 0;
+        while ((valor & 1u) == 0) {
+            valor >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    // Si algo falla el pool queda como estaba
+    void agregarBloque() {
+        const std::size_t bloques = m_bloques.size() + 1;
+        m_porDireccion.reserve(bloques);
+        // Inicialización por defecto: la zona de objetos no se rellena con ceros
+        m_bloques.push_back(std::unique_ptr<Bloque>(new Bloque));
+        const std::pair<const unsigned char*, std::size_t> entrada{m_bloques.back()->datos, m_bloques.size() - 1};
+        m_porDireccion.insert(std::upper_bound(m_porDireccion.begin(), m_porDireccion.end(), entrada), entrada);
+    }
+
+    std::vector<std::unique_ptr<Bloque>> m_bloques;
+    std::vector<std::pair<const unsigned char*, std::size_t>> m_porDireccion;  ///< Ordered by address
+    std::size_t m_libre = SIN_CELDA;    ///< Head of the free list of recycled cells
+    std::size_t m_usadas = 0;           ///< Cells ever handed out (high-water mark)
+    std::size_t m_vivos = 0;
+};
+
+#endif // POOL_ARTICULOS_HPP
@@ -0,0 +1,74 @@
+/**
+ * @file ranking_tecnicos.hpp
+ * @brief Incrementally maintained technician workload leaderboard
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef RANKING_TECNICOS_HPP
+#define RANKING_TECNICOS_HPP
+
+#include "tabla_simbolos.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Indexed max-heap of technicians ordered by assigned equipment
+ *
+ * Technicians are identified by their TablaSimbolos id. The heap keeps
+ * the position of every id, so an assignment change is one O(log T)
+ * sift. Ties are broken alphabetically, matching the order std::map
+ * gives the legacy report.
+ */
+class RankingTecnicos {
+public:
+    static constexpr std::uint32_t SIN_TECNICO = TablaSimbolos::SIN_ID;
+
+    /**
+     * @brief Add a technician to the heap if it is not there yet
+     */
+    void registrar(TablaSimbolos::Id tecnico);
+
+    void incrementar(TablaSimbolos::Id tecnico) noexcept;
+    void decrementar(TablaSimbolos::Id tecnico) noexcept;
+
+    const std::string& nombre(TablaSimbolos::Id tecnico) const { return *m_nombres[tecnico]; }
+    int cantidad(TablaSimbolos::Id tecnico) const { return m_cantidades[tecnico]; }
+
+    /**
+     * @brief Technician with most equipment, or SIN_TECNICO if none has any
+     */
+    std::uint32_t primero() const noexcept;
+
+    /**
+     * @brief Top @p k technicians by load in O(K log K)
+     * @return (name, count) pairs, highest load first; zero loads are omitted
+     */
+    std::vector<std::pair<std::string, int>> mejores(std::size_t k) const;
+
+    /**
+     * @brief Every technician with at least one piece of equipment
+     */
+    std::vector<std::pair<std::string, int>> todos() const;
+
+    void limpiar() noexcept;
+
+private:
+    static constexpr std::size_t SIN_POSICION = SIZE_MAX;
+
+    // Indexados por id de símbolo; los ids que no son técnicos quedan vacíos
+    std::vector<const std::string*> m_nombres;  ///< Cached text for tie-breaks
+    std::vector<int> m_cantidades;
+    std::vector<std::size_t> m_posiciones;   ///< id -> position in m_monticulo
+    std::vector<std::uint32_t> m_monticulo;  ///< Max-heap of ids
+
+    bool antes(std::uint32_t a, std::uint32_t b) const noexcept;
+    void subir(std::size_t posicion) noexcept;
+    void bajar(std::size_t posicion) noexcept;
+    void intercambiar(std::size_t a, std::size_t b) noexcept;
+};
+
+#endif // RANKING_TECNICOS_HPP
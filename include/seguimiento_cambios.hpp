@@ -0,0 +1,73 @@
+/**
+ * @file seguimiento_cambios.hpp
+ * @brief Set of slots modified since the last full save
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef SEGUIMIENTO_CAMBIOS_HPP
+#define SEGUIMIENTO_CAMBIOS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Dirty-slot tracking with O(1) mark and O(1) reset
+ *
+ * Each slot remembers the epoch in which it was last marked; a slot is
+ * dirty when that equals the current epoch, so limpiar() just starts a
+ * new epoch. The dirty slots are also listed in marking order, which
+ * lets an incremental save visit only them.
+ */
+class SeguimientoCambios {
+public:
+    /**
+     * @brief Track a new slot (marked dirty unless @p marcado is false)
+     *        and make room so that marcar() never allocates
+     */
+    void agregarSlot(const std::uint32_t slot, const bool marcado = true) {
+        if (slot >= m_epocaSlot.size()) m_epocaSlot.resize(slot + std::size_t{1}, 0);
+        if (m_slots.capacity() < m_epocaSlot.capacity()) m_slots.reserve(m_epocaSlot.capacity());
+        if (marcado) marcar(slot);
+    }
+
+    /**
+     * @brief Mark a slot already passed to agregarSlot()
+     */
+    void marcar(const std::uint32_t slot) noexcept {
+        if (m_epocaSlot[slot] != m_epoca) {
+            m_epocaSlot[slot] = m_epoca;
+            m_slots.push_back(slot);
+        }
+    }
+
+    bool contiene(const std::uint32_t slot) const noexcept {
+        return slot < m_epocaSlot.size() && m_epocaSlot[slot] == m_epoca;
+    }
+
+    void limpiar() noexcept {
+        m_slots.clear();
+        if (++m_epoca == 0) {
+            // Tras 2^32 épocas las marcas viejas podrían coincidir
+            std::fill(m_epocaSlot.begin(), m_epocaSlot.end(), 0u);
+            m_epoca = 1;
+        }
+    }
+
+    void reservar(const std::size_t cantidad) {
+        m_epocaSlot.reserve(cantidad);
+        m_slots.reserve(cantidad);
+    }
+
+    const std::vector<std::uint32_t>& slots() const noexcept { return m_slots; }
+    std::size_t size() const noexcept { return m_slots.size(); }
+
+private:
+    std::vector<std::uint32_t> m_epocaSlot;  // época de la última marca de cada slot
+    std::vector<std::uint32_t> m_slots;      // slots marcados en la época actual
+    std::uint32_t m_epoca = 1;
+};
+
+#endif // SEGUIMIENTO_CAMBIOS_HPP
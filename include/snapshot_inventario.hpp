@@ -0,0 +1,277 @@
+/**
+ * @file snapshot_inventario.hpp
+ * @brief Versioned binary snapshot of the inventory articles
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef SNAPSHOT_INVENTARIO_HPP
+#define SNAPSHOT_INVENTARIO_HPP
+
+#include "articulo.hpp"
+#include "archivo_mapeado.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * File layout (little-endian, every section 8-byte aligned):
+ *
+ *   CabeceraSnapshot                      64 bytes
+ *   RegistroSnapshot[cantidadRegistros]   40 bytes each, in slot order
+ *   string heap                           UTF-8 bytes, no terminators
+ *   uint64 cantidadRanuras                code index (version 2), after
+ *   uint32 slot[cantidadRanuras]          padding the heap to 8 bytes
+ *
+ * Strings are referenced by (offset, length) into the heap. Technician,
+ * material and entry-date texts are written once per distinct value.
+ * The checksum covers everything after the header. @c generacion tells
+ * the journal which of its files are already folded into the snapshot
+ * (files written before it existed read back as generation 0).
+ *
+ * The code index is an open-addressing table with linear probing: the
+ * slot of a code lives at the first non-empty position from
+ * sumaVerificacion(code) modulo cantidadRanuras (a power of two, at
+ * least twice the record count). It lets a mapped snapshot answer
+ * lookups without building anything. Version 1 files have no index and
+ * are still read.
+ *
+ * A delta segment (same path + ".delta") holds only the records changed
+ * since the base was written:
+ *
+ *   CabeceraDelta                         64 bytes
+ *   RegistroSnapshot[cantidadRegistros]   new image of each changed slot
+ *   uint32 slot[cantidadRegistros]        padded to 8 bytes
+ *   string heap
+ *
+ * It names its base by the base checksum; a delta whose base was since
+ * rewritten is stale and ignored.
+ */
+namespace SnapshotInventario {
+    constexpr char FIRMA[8] = {'H', 'I', 'N', 'V', 'S', 'N', 'A', 'P'};
+    constexpr std::uint32_t VERSION = 2;
+    constexpr std::uint32_t MARCA_ORDEN = 0x01020304u;  ///< Reads back swapped on big-endian hosts
+    constexpr char FIRMA_DELTA[8] = {'H', 'I', 'N', 'V', 'D', 'E', 'L', 'T'};
+    constexpr std::uint32_t VERSION_DELTA = 1;
+    constexpr std::uint32_t SIN_SLOT = UINT32_MAX;  ///< Empty index position, code not found
+
+    inline std::string rutaDelta(const std::string& rutaBase) { return rutaBase + ".delta"; }
+}
+
+struct CabeceraSnapshot {
+    char firma[8];
+    std::uint32_t version;
+    std::uint32_t tamanoRegistro;
+    std::uint64_t cantidadRegistros;
+    std::uint64_t desplazamientoRegistros;
+    std::uint64_t desplazamientoHeap;
+    std::uint64_t tamanoHeap;
+    std::uint64_t sumaVerificacion;
+    std::uint32_t marcaOrden;
+    std::uint32_t generacion;
+};
+
+struct CabeceraDelta {
+    char firma[8];
+    std::uint32_t version;
+    std::uint32_t tamanoRegistro;
+    std::uint64_t cantidadRegistros;
+    std::uint64_t cantidadTotal;     ///< Articles after applying the delta
+    std::uint64_t sumaBase;          ///< sumaVerificacion of the base it applies to
+    std::uint64_t tamanoHeap;
+    std::uint64_t sumaVerificacion;
+    std::uint32_t marcaOrden;
+    std::uint32_t reservado;
+};
+
+struct RefTexto {
+    std::uint32_t desplazamiento;
+    std::uint32_t longitud;
+};
+
+/**
+ * @brief Fixed-width image of one article
+ *
+ * @c texto is the assigned technician for medical equipment and the
+ * material for clinical furniture; @c marca and @c vidaUtilAnios are
+ * zero for furniture.
+ */
+struct RegistroSnapshot {
+    double costoUnitario;
+    RefTexto codigo;
+    RefTexto fechaIngreso;
+    RefTexto texto;
+    std::int32_t vidaUtilAnios;
+    std::uint8_t tipo;
+    std::uint8_t estado;
+    std::uint8_t marca;
+    std::uint8_t area;
+};
+
+static_assert(sizeof(CabeceraSnapshot) == 64, "Cabecera de snapshot con relleno inesperado");
+static_assert(sizeof(CabeceraDelta) == 64, "Cabecera de delta con relleno inesperado");
+static_assert(sizeof(RegistroSnapshot) == 40, "Registro de snapshot con relleno inesperado");
+static_assert(std::is_trivially_copyable<RegistroSnapshot>::value, "El registro se copia byte a byte");
+
+/**
+ * @brief Builds a snapshot in memory and writes it in one go
+ */
+class EscritorSnapshot {
+public:
+    explicit EscritorSnapshot(std::size_t cantidadEstimada = 0);
+
+    void agregar(const Articulo& articulo);
+
+    /**
+     * @brief Write to a temporary file, sync it and rename it over @p ruta
+     *
+     * The new base supersedes any delta segment of @p ruta, which is removed.
+     *
+     * @return Checksum identifying the written snapshot
+     * @throws std::runtime_error on I/O failure; the old file is left intact
+     */
+    std::uint64_t escribir(const std::string& ruta, std::uint32_t generacion = 0) const;
+
+    /**
+     * @brief Write the added records as the delta segment of @p rutaBase
+     *
+     * @param slots Slot of each added record, in the same order
+     * @param cantidadTotal Article count once the delta is applied
+     * @param sumaBase Checksum of the base snapshot
+     */
+    void escribirDelta(const std::string& rutaBase, const std::vector<std::uint32_t>& slots,
+                       std::uint64_t cantidadTotal, std::uint64_t sumaBase) const;
+
+private:
+    std::vector<RegistroSnapshot> m_registros;
+    std::string m_heap;
+    std::vector<RefTexto> m_porSimbolo;  ///< Heap text already written per symbol id
+
+    RefTexto agregarTexto(std::string_view texto);
+    RefTexto agregarSimbolo(TablaSimbolos::Id id);
+};
+
+/**
+ * @brief Maps a snapshot file and validates it before any record is read
+ *
+ * With Verificacion::COMPLETA the constructor checks signature, version,
+ * byte order, section bounds, the checksum and every record's enum values
+ * and string references, so the accessors below never read outside the
+ * mapping. Verificacion::DIFERIDA stops after the header and the section
+ * bounds, which makes opening O(1); the caller must then pass each record
+ * through registroValido() before resolving its texts.
+ */
+class LectorSnapshot {
+public:
+    enum class Verificacion { COMPLETA, DIFERIDA };
+
+    /**
+     * @throws std::runtime_error if the file is missing, truncated or corrupt
+     */
+    explicit LectorSnapshot(const std::string& ruta, Verificacion verificacion = Verificacion::COMPLETA);
+
+    std::size_t size() const noexcept { return m_cantidad; }
+    std::uint32_t generacion() const noexcept { return m_generacion; }
+    std::uint64_t sumaVerificacion() const noexcept { return m_suma; }
+
+    /**
+     * @brief Known enum values and string references inside the heap
+     */
+    bool registroValido(const RegistroSnapshot& registro) const noexcept;
+
+    /**
+     * @brief Whether the file carries the code index (version 2)
+     */
+    bool tieneIndice() const noexcept { return m_ranuras != nullptr; }
+
+    /**
+     * @brief Slot of @p codigo via the code index, or SnapshotInventario::SIN_SLOT
+     *
+     * Requires tieneIndice(). Index entries pointing at invalid records are
+     * treated as misses.
+     */
+    std::uint32_t buscar(std::string_view codigo) const noexcept;
+
+    /**
+     * @brief Checksum stored in the header of @p ruta, or 0 if it is not a snapshot
+     *
+     * Reads only the header; used to tell whether a base changed on disk.
+     */
+    static std::uint64_t sumaDeArchivo(const std::string& ruta) noexcept;
+
+    RegistroSnapshot registro(const std::size_t indice) const noexcept {
+        RegistroSnapshot registro;
+        std::memcpy(&registro, m_registros + indice * sizeof(RegistroSnapshot), sizeof registro);
+        return registro;
+    }
+
+    std::string_view texto(const RefTexto ref) const noexcept {
+        return {reinterpret_cast<const char*>(m_heap) + ref.desplazamiento, ref.longitud};
+    }
+
+    std::string_view heap() const noexcept {
+        return {reinterpret_cast<const char*>(m_heap), static_cast<std::size_t>(m_tamanoHeap)};
+    }
+
+private:
+    ArchivoMapeado m_archivo;
+    const unsigned char* m_registros = nullptr;
+    const unsigned char* m_heap = nullptr;
+    const unsigned char* m_ranuras = nullptr;
+    std::size_t m_cantidad = 0;
+    std::size_t m_cantidadRanuras = 0;
+    std::uint64_t m_tamanoHeap = 0;
+    std::uint32_t m_generacion = 0;
+    std::uint64_t m_suma = 0;
+};
+
+/**
+ * @brief Maps and validates a delta segment like LectorSnapshot does a base
+ */
+class LectorDelta {
+public:
+    /**
+     * @throws std::runtime_error if the file is missing, truncated or corrupt
+     */
+    explicit LectorDelta(const std::string& ruta);
+
+    std::size_t size() const noexcept { return m_cantidad; }
+    std::uint64_t cantidadTotal() const noexcept { return m_cantidadTotal; }
+    std::uint64_t sumaBase() const noexcept { return m_sumaBase; }
+
+    std::uint32_t slot(const std::size_t indice) const noexcept {
+        std::uint32_t slot;
+        std::memcpy(&slot, m_slots + indice * sizeof slot, sizeof slot);
+        return slot;
+    }
+
+    RegistroSnapshot registro(const std::size_t indice) const noexcept {
+        RegistroSnapshot registro;
+        std::memcpy(&registro, m_registros + indice * sizeof(RegistroSnapshot), sizeof registro);
+        return registro;
+    }
+
+    std::string_view texto(const RefTexto ref) const noexcept {
+        return {reinterpret_cast<const char*>(m_heap) + ref.desplazamiento, ref.longitud};
+    }
+
+    std::string_view heap() const noexcept {
+        return {reinterpret_cast<const char*>(m_heap), static_cast<std::size_t>(m_tamanoHeap)};
+    }
+
+private:
+    ArchivoMapeado m_archivo;
+    const unsigned char* m_registros = nullptr;
+    const unsigned char* m_slots = nullptr;
+    const unsigned char* m_heap = nullptr;
+    std::size_t m_cantidad = 0;
+    std::uint64_t m_tamanoHeap = 0;
+    std::uint64_t m_cantidadTotal = 0;
+    std::uint64_t m_sumaBase = 0;
+};
+
+#endif // SNAPSHOT_INVENTARIO_HPP
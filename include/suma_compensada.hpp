@@ -0,0 +1,41 @@
+/**
+ * @file suma_compensada.hpp
+ * @brief Neumaier-compensated floating point accumulator
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef SUMA_COMPENSADA_HPP
+#define SUMA_COMPENSADA_HPP
+
+#include <cmath>
+
+/**
+ * @brief Running sum that carries the rounding error of each addition
+ *
+ * Used for totals that are updated incrementally (add the new value,
+ * subtract the old one) so that long mutation histories do not drift
+ * away from a fresh recomputation.
+ */
+class SumaCompensada {
+public:
+    void sumar(const double valor) noexcept {
+        const double t = m_suma + valor;
+        if (std::fabs(m_suma) >= std::fabs(valor)) {
+            m_compensacion += (m_suma - t) + valor;
+        } else {
+            m_compensacion += (valor - t) + m_suma;
+        }
+        m_suma = t;
+    }
+
+    void restar(const double valor) noexcept { sumar(-valor); }
+
+    double valor() const noexcept { return m_suma + m_compensacion; }
+
+private:
+    double m_suma = 0.0;
+    double m_compensacion = 0.0;
+};
+
+#endif // SUMA_COMPENSADA_HPP
@@ -0,0 +1,108 @@
+/**
+ * @file tabla_simbolos.hpp
+ * @brief Process-wide string interning for repeated article attributes
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef TABLA_SIMBOLOS_HPP
+#define TABLA_SIMBOLOS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Interns strings to dense 32-bit ids
+ *
+ * Technician names, materials and entry dates repeat across thousands of
+ * articles. Articles store the id and resolve the text on demand, and
+ * group-bys index arrays by id instead of hashing strings. Ids are never
+ * recycled, and the text behind an id never moves, so the references
+ * returned by texto() stay valid for the lifetime of the table.
+ *
+ * Texts are appended to blocks that double in size and are never
+ * reallocated, so texto() and size() take no lock: every row of every
+ * report resolves its ids without touching the mutex that serializes
+ * internar() and guards the lookup map. All members are thread-safe.
+ */
+class TablaSimbolos {
+public:
+    using Id = std::uint32_t;
+    static constexpr Id SIN_ID = UINT32_MAX;
+
+    TablaSimbolos() = default;
+    ~TablaSimbolos();
+    TablaSimbolos(const TablaSimbolos&) = delete;
+    TablaSimbolos& operator=(const TablaSimbolos&) = delete;
+
+    /**
+     * @brief Table shared by every inventory in the process
+     */
+    static TablaSimbolos& global();
+
+    /**
+     * @brief Id of @p texto, adding it on first use
+     */
+    Id internar(std::string_view texto);
+
+    /**
+     * @brief Id of @p texto or SIN_ID if it was never interned
+     */
+    Id buscar(std::string_view texto) const;
+
+    /**
+     * @brief Text of an id previously returned by internar()
+     *
+     * Lock-free. The id must have reached this thread through the same
+     * synchronization as the object that stores it (as any shared data).
+     */
+    const std::string& texto(Id id) const noexcept {
+        const Posicion posicion = ubicar(id);
+        return m_bloques[posicion.bloque].load(std::memory_order_acquire)[posicion.indice];
+    }
+
+    /**
+     * @brief Number of interned strings (ids are 0..size()-1)
+     */
+    std::size_t size() const noexcept { return m_cantidad.load(std::memory_order_acquire); }
+
+private:
+    // El bloque b guarda 2^(BITS_PRIMER_BLOQUE + b) textos: con 23 bloques
+    // caben todos los ids de 32 bits
+    static constexpr unsigned BITS_PRIMER_BLOQUE = 10;
+    static constexpr std::size_t BLOQUES = 32 - BITS_PRIMER_BLOQUE + 1;
+
+    struct Posicion {
+        std::size_t bloque;
+        std::size_t indice;
+    };
+
+    static Posicion ubicar(const Id id) noexcept {
+        const std::uint64_t n = std::uint64_t{id} + (std::uint64_t{1} << BITS_PRIMER_BLOQUE);
+        const unsigned alto = bitMasAlto(n);
+        return {alto - BITS_PRIMER_BLOQUE, static_cast<std::size_t>(n - (std::uint64_t{1} << alto))};
+    }
+
+    static unsigned bitMasAlto(std::uint64_t valor) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<unsigned>(__builtin_clzll(valor));
+#else
+        unsigned bit = 0;
+        while (valor >>= 1) ++bit;
+        return bit;
+#endif
+    }
+
+    mutable std::shared_mutex m_mutex;                ///< Serializes internar(), guards m_ids
+    std::array<std::atomic<std::string*>, BLOQUES> m_bloques{};  ///< Stable storage, indexed by id
+    std::atomic<std::size_t> m_cantidad{0};
+    std::unordered_map<std::string_view, Id> m_ids;   ///< Keys view the blocks
+};
+
+#endif // TABLA_SIMBOLOS_HPP
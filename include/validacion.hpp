@@ -0,0 +1,88 @@
+/**
+ * @file validacion.hpp
+ * @brief Allocation-free validators for article codes and entry dates
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef VALIDACION_HPP
+#define VALIDACION_HPP
+
+#include "articulo.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Hand-written equivalents of the patterns the article constructor used
+ * to check with std::regex:
+ *  - code: ^[A-Za-z0-9_-]+$ with MIN_CODE_LENGTH..MAX_CODE_LENGTH chars
+ *  - date: ^([0-2][0-9]|3[01])/(0[1-9]|1[0-2])/([12][0-9]{3})$ followed by
+ *    the 2000-2099 year window and the days-in-month check
+ */
+namespace Validacion {
+    constexpr bool esDigito(const char c) noexcept { return c >= '0' && c <= '9'; }
+
+    constexpr bool caracterDeCodigo(const char c) noexcept {
+        return esDigito(c) || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_' || c == '-';
+    }
+
+    constexpr bool codigoValido(const std::string_view codigo) noexcept {
+        if (codigo.size() < MedicalInventory::Domain::Validation::MIN_CODE_LENGTH ||
+            codigo.size() > MedicalInventory::Domain::Validation::MAX_CODE_LENGTH) {
+            return false;
+        }
+        for (const char c : codigo) {
+            if (!caracterDeCodigo(c)) return false;
+        }
+        return true;
+    }
+
+    constexpr int diasDelMes(const int mes, const int anio) noexcept {
+        if (mes == 2) {
+            const bool bisiesto = (anio % 4 == 0 && anio % 100 != 0) || (anio % 400 == 0);
+            return bisiesto ? 29 : 28;
+        }
+        return (mes == 4 || mes == 6 || mes == 9 || mes == 11) ? 30 : 31;
+    }
+
+    /**
+     * @brief Range checks of a DD/MM/YYYY string whose shape is already known
+     *
+     * Requires digits at 0-1, 3-4 and 6-9 and '/' at 2 and 5.
+     */
+    constexpr bool camposDeFechaValidos(const std::string_view fecha) noexcept {
+        const auto digito = [fecha](const std::size_t i) { return fecha[i] - '0'; };
+        const int dia = digito(0) * 10 + digito(1);
+        const int mes = digito(3) * 10 + digito(4);
+        const int anio = digito(6) * 1000 + digito(7) * 100 + digito(8) * 10 + digito(9);
+        if (mes < 1 || mes > 12 || anio < 2000 || anio > 2099) return false;
+        return dia >= 1 && dia <= diasDelMes(mes, anio);
+    }
+
+    constexpr bool fechaValida(const std::string_view fecha) noexcept {
+        if (fecha.size() != 10 || fecha[2] != '/' || fecha[5] != '/') return false;
+        for (const std::size_t i : {0u, 1u, 3u, 4u, 6u, 7u, 8u, 9u}) {
+            if (!esDigito(fecha[i])) return false;
+        }
+        return camposDeFechaValidos(fecha);
+    }
+
+    /**
+     * @brief Validate a column of codes, testing character classes 16 bytes at a time
+     * @param validos Receives 1 for each valid code and 0 otherwise
+     * @return Number of valid codes
+     */
+    std::size_t validarCodigos(const std::string_view* codigos, std::size_t cantidad,
+                               std::uint8_t* validos) noexcept;
+
+    /**
+     * @brief Validate a column of DD/MM/YYYY dates with one vector shape test each
+     * @param validos Receives 1 for each valid date and 0 otherwise
+     * @return Number of valid dates
+     */
+    std::size_t validarFechas(const std::string_view* fechas, std::size_t cantidad,
+                              std::uint8_t* validos) noexcept;
+}
+
+#endif // VALIDACION_HPP
@@ -0,0 +1,155 @@
+/**
+ * @file vista_inventario.hpp
+ * @brief Read-only inventory queries straight over a mapped snapshot
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef VISTA_INVENTARIO_HPP
+#define VISTA_INVENTARIO_HPP
+
+#include "snapshot_inventario.hpp"
+#include "equipo_medico.hpp"
+#include "mobiliario_clinico.hpp"
+#include "agregacion_paralela.hpp"
+#include "contadores_inventario.hpp"
+#include "fecha.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lightweight handle to one article of a VistaInventario
+ *
+ * Holds a copy of the fixed-width record; the texts are views into the
+ * mapping and live as long as the view. The getters mirror those of
+ * Articulo, EquipoMedico and MobiliarioClinico so report code can be
+ * written once for both. Type-specific getters are only meaningful for
+ * articles of that type.
+ */
+class ArticuloVista {
+public:
+    std::uint32_t GetSlot() const noexcept { return m_slot; }
+    std::string_view GetCode() const noexcept { return texto(m_registro.codigo); }
+    Articulo::ArticleType GetType() const noexcept { return static_cast<Articulo::ArticleType>(m_registro.tipo); }
+    Articulo::ArticleStatus GetStatus() const noexcept { return static_cast<Articulo::ArticleStatus>(m_registro.estado); }
+    std::string_view GetEntryDate() const noexcept { return texto(m_registro.fechaIngreso); }
+    std::int32_t GetEntryDay() const noexcept { return Fecha::diasDesdeTexto(GetEntryDate()); }
+    double GetUnitCost() const noexcept { return m_registro.costoUnitario; }
+    double CalculateTotalCost(const FechaCorte& corte) const noexcept;
+
+    bool esEquipo() const noexcept { return GetType() == Articulo::ArticleType::MEDICAL_EQUIPMENT; }
+
+    // Equipo médico
+    MarcaEquipo getMarca() const noexcept { return static_cast<MarcaEquipo>(m_registro.marca); }
+    int getVidaUtilAnios() const noexcept { return m_registro.vidaUtilAnios; }
+    std::string_view getTecnicoAsignado() const noexcept { return texto(m_registro.texto); }
+    AreaUso getAreaUso() const noexcept { return static_cast<AreaUso>(m_registro.area); }
+    double calcularDepreciacion(const FechaCorte& corte) const noexcept {
+        return EquipoMedico::depreciacion(GetUnitCost(), getVidaUtilAnios(), GetEntryDay(), corte);
+    }
+
+    // Mobiliario clínico
+    std::string_view getMaterial() const noexcept { return texto(m_registro.texto); }
+    AreaUbicacion getAreaUbicacion() const noexcept { return static_cast<AreaUbicacion>(m_registro.area); }
+    double calcularValorConPlus() const { return GetUnitCost() + MobiliarioClinico::getPlusPorArea(getAreaUbicacion()); }
+
+private:
+    friend class VistaInventario;
+
+    ArticuloVista(const RegistroSnapshot& registro, const std::string_view heap, const std::uint32_t slot) noexcept
+        : m_registro(registro), m_heap(heap), m_slot(slot) {}
+
+    std::string_view texto(const RefTexto ref) const noexcept {
+        return {m_heap.data() + ref.desplazamiento, ref.longitud};
+    }
+
+    RegistroSnapshot m_registro;
+    std::string_view m_heap;  // heap del archivo del que viene el registro
+    std::uint32_t m_slot;
+};
+
+/**
+ * @brief Read-only Inventario over a snapshot file, without loading it
+ *
+ * Opening maps the snapshot and checks only its header and section
+ * bounds, so it costs the same for ten articles as for ten million, and
+ * every process viewing the same file shares its pages in the OS cache.
+ * Each record is validated when it is read; a corrupt one throws
+ * std::runtime_error. The checksum is not verified: use LectorSnapshot
+ * for that. A current delta segment is applied on top, at a cost
+ * proportional to its size.
+ *
+ * Lookups use the code index of version 2 snapshots and fall back to a
+ * scan on older files. Queries mirror those of Inventario, with
+ * ArticuloVista in place of article pointers; full scans use several
+ * threads from the same threshold. The view keeps reading the file it
+ * opened even if the snapshot is replaced afterwards.
+ */
+class VistaInventario {
+public:
+    /**
+     * @throws std::runtime_error if the snapshot or its delta is missing, truncated or corrupt
+     */
+    explicit VistaInventario(const std::string& nombreArchivo);
+
+    size_t obtenerCantidadTotal() const noexcept { return m_cantidad; }
+
+    /**
+     * @throws std::out_of_range if @p slot is not below obtenerCantidadTotal()
+     */
+    ArticuloVista articulo(std::uint32_t slot) const;
+
+    std::optional<ArticuloVista> buscarPorCodigo(std::string_view codigo) const;
+    bool existeCodigo(std::string_view codigo) const { return buscarPorCodigo(codigo).has_value(); }
+
+    // Filtros y agrupaciones
+    std::vector<ArticuloVista> filtrarPorEstado(EstadoArticulo estado) const;
+    std::vector<ArticuloVista> filtrarPorTipo(TipoArticulo tipo) const;
+    std::vector<ArticuloVista> obtenerArticulosDanados() const { return filtrarPorEstado(EstadoArticulo::DAMAGED); }
+    std::map<std::pair<MarcaEquipo, AreaUso>, std::vector<ArticuloVista>> agruparEquiposPorMarcaYArea() const;
+    std::map<std::string, int> contarEquiposPorTecnico() const;
+    std::map<AreaUso, int> contarEquiposPorArea() const;
+    std::map<AreaUbicacion, int> contarMobiliarioPorArea() const;
+
+    // Cantidades y costos (valor a la fecha de corte, como en Inventario)
+    size_t obtenerCantidadPorTipo(TipoArticulo tipo) const;
+    size_t obtenerCantidadPorEstado(EstadoArticulo estado) const;
+    double calcularCostoTotalPorCategoria(TipoArticulo tipo) const;
+    std::map<TipoArticulo, double> calcularCostosPorCategoria() const;
+    double calcularCostoTotalPorEstado(EstadoArticulo estado) const;
+    std::pair<double, double> obtenerCostosMinMax() const;  // costo unitario
+    double calcularDepreciacionTotal() const;
+
+    const FechaCorte& obtenerFechaCorte() const noexcept { return m_fechaCorte; }
+    void actualizarFechaCorte(const FechaCorte& corte = FechaCorte::Hoy()) noexcept { m_fechaCorte = corte; }
+    void configurarUmbralParalelo(size_t umbral) noexcept { m_agregador.configurarUmbral(umbral); }
+
+private:
+    LectorSnapshot m_base;
+    std::optional<LectorDelta> m_delta;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_slotsDelta;  // (slot, registro del delta), por slot
+    std::unordered_map<std::string_view, std::uint32_t> m_codigosDelta;  // código -> slot de cada registro del delta
+    size_t m_cantidad = 0;
+    FechaCorte m_fechaCorte = FechaCorte::Hoy();
+    AgregadorParalelo m_agregador;
+
+    ArticuloVista deBase(std::uint32_t slot) const;
+    ArticuloVista deDelta(std::uint32_t registro, std::uint32_t slot) const;
+
+    template <typename Visitar>
+    void recorrer(size_t desde, size_t hasta, Visitar&& visitar) const;
+    template <typename Predicado>
+    std::vector<ArticuloVista> filtrar(Predicado&& predicado) const;
+    std::array<int, 256> contarPorArea(TipoArticulo tipo) const;
+    ContadoresInventario resumir() const;  // un recorrido completo
+};
+
+#endif // VISTA_INVENTARIO_HPP
@@ -236,6 +236,10 @@ LRESULT GuiMainFrame::HandleMessage(UINT uMsg, WPARAM wParam, LPARAM lParam) {
 LRESULT GuiMainFrame::HandleCommand(WPARAM wParam, LPARAM lParam) {
     UNREFERENCED_PARAMETER(lParam);
     
+    // La ventana puede seguir abierta al cambiar de año: las vistas deben
+    // depreciar con la fecha de hoy
+    m_inventory.refrescarFechaCorte();
+    
     switch (LOWORD(wParam)) {
         case MENU_FILE_ADD_ARTICLE:
             OnAddArticle();
@@ -544,9 +548,11 @@ void GuiMainFrame::ShowMinMaxCostsView() {
     AddListViewColumn("Costo", COLUMN_WIDTH_COST);
     
     if (m_inventory.obtenerCantidadTotal() > 0) {
-        auto [minCosto, maxCosto] = m_inventory.obtenerCostosMinMax();
-        auto* articuloMasCaro = m_inventory.obtenerArticuloMasCaro();
-        auto* articuloMasBarato = m_inventory.obtenerArticuloMasBarato();
+        const ResumenCostos resumen = m_inventory.obtenerResumenCostos();
+        const double minCosto = resumen.minimo;
+        const double maxCosto = resumen.maximo;
+        auto* articuloMasCaro = resumen.masCaro;
+        auto* articuloMasBarato = resumen.masBarato;
         
         if (articuloMasCaro) {
             std::vector<std::string> maxRow = {
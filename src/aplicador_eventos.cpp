@@ -0,0 +1,155 @@
+/**
+ * @file aplicador_eventos.cpp
+ * @brief Implementation of the batched event applier
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/aplicador_eventos.hpp"
+#include "../include/inventario.hpp"
+#include "../include/inventario_concurrente.hpp"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace {
+    // Respaldo por si un aviso se cruza con el aplicador a punto de dormir
+    constexpr std::chrono::milliseconds ESPERA_MAXIMA{1};
+}
+
+AplicadorEventos::AplicadorEventos(Inventario& inventario, const std::size_t capacidad, const std::size_t tamanoLote)
+    : AplicadorEventos([&inventario](const std::vector<EventoInventario>& lote) {
+          return inventario.aplicarEventos(lote);
+      }, capacidad, tamanoLote) {}
+
+AplicadorEventos::AplicadorEventos(InventarioConcurrente& inventario, const std::size_t capacidad,
+                                   const std::size_t tamanoLote)
+    : AplicadorEventos([&inventario](const std::vector<EventoInventario>& lote) {
+          return inventario.aplicarEventos(lote);
+      }, capacidad, tamanoLote) {}
+
+AplicadorEventos::AplicadorEventos(Aplicar aplicar, const std::size_t capacidad, const std::size_t tamanoLote)
+    : m_cola(capacidad), m_aplicar(std::move(aplicar)), m_tamanoLote(std::max<std::size_t>(1, tamanoLote)) {
+    m_hilo = std::thread(&AplicadorEventos::bucle, this);
+}
+
+AplicadorEventos::~AplicadorEventos() {
+    try {
+        detener();
+    } catch (...) {
+        // El error ya no tiene a quién llegar
+    }
+}
+
+bool AplicadorEventos::publicar(const EventoInventario& evento) noexcept {
+    if (m_detenido.load(std::memory_order_relaxed)) return false;
+    if (!m_cola.intentarEncolar(evento)) {
+        m_rechazados.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    despertar();
+    return true;
+}
+
+bool AplicadorEventos::publicarEsperando(const EventoInventario& evento) noexcept {
+    if (m_detenido.load(std::memory_order_relaxed)) return false;
+    while (!m_cola.intentarEncolar(evento)) {
+        if (m_detenido.load(std::memory_order_relaxed)) return false;
+        despertar();
+        std::this_thread::yield();
+    }
+    despertar();
+    return true;
+}
+
+// Solo se toma el mutex si el aplicador anunció que va a dormir; la barrera
+// ordena el encolado antes de leer el aviso (y al revés en bucle())
+void AplicadorEventos::despertar() noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_esperando.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> bloqueo(m_mutex);
+        m_hayEventos.notify_one();
+    }
+}
+
+void AplicadorEventos::bucle() {
+    std::vector<EventoInventario> lote;
+    lote.reserve(m_tamanoLote);
+    EventoInventario evento;
+    for (;;) {
+        while (lote.size() < m_tamanoLote && m_cola.intentarDesencolar(evento)) lote.push_back(evento);
+
+        if (!lote.empty()) {
+            std::size_t aplicados = 0;
+            try {
+                aplicados = m_aplicar(lote);
+            } catch (...) {
+                std::lock_guard<std::mutex> bloqueo(m_mutex);
+                m_error = std::current_exception();
+                m_detenido.store(true);
+                m_vaciado.notify_all();
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> bloqueo(m_mutex);
+                m_procesados += lote.size();
+                m_aplicados += aplicados;
+                ++m_lotes;
+            }
+            m_vaciado.notify_all();
+            lote.clear();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> bloqueo(m_mutex);
+        m_esperando.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_cola.vacia()) {
+            // Una posición reservada pero aún sin escribir todavía cuenta como pendiente
+            if (m_detener.load() && m_cola.encolados() == m_procesados) {
+                m_detenido.store(true);
+                m_esperando.store(false, std::memory_order_relaxed);
+                m_vaciado.notify_all();
+                return;
+            }
+            m_hayEventos.wait_for(bloqueo, ESPERA_MAXIMA);
+        }
+        m_esperando.store(false, std::memory_order_relaxed);
+    }
+}
+
+void AplicadorEventos::vaciar() {
+    const std::uint64_t objetivo = m_cola.encolados();
+    despertar();
+    std::unique_lock<std::mutex> bloqueo(m_mutex);
+    m_vaciado.wait(bloqueo, [&] { return m_procesados >= objetivo || m_detenido.load(); });
+    lanzarError();
+}
+
+void AplicadorEventos::detener() {
+    if (m_hilo.joinable()) {
+        m_detener.store(true);
+        {
+            std::lock_guard<std::mutex> bloqueo(m_mutex);
+            m_hayEventos.notify_one();
+        }
+        m_hilo.join();
+    }
+    std::lock_guard<std::mutex> bloqueo(m_mutex);
+    lanzarError();
+}
+
+// Se llama con m_mutex tomado; el error se entrega una sola vez
+void AplicadorEventos::lanzarError() {
+    if (m_error) std::rethrow_exception(std::exchange(m_error, nullptr));
+}
+
+EstadisticasAplicador AplicadorEventos::obtenerEstadisticas() const {
+    std::lock_guard<std::mutex> bloqueo(m_mutex);
+    EstadisticasAplicador estadisticas;
+    estadisticas.aplicados = m_aplicados;
+    estadisticas.desconocidos = m_procesados - m_aplicados;
+    estadisticas.lotes = m_lotes;
+    estadisticas.rechazados = m_rechazados.load(std::memory_order_relaxed);
+    return estadisticas;
+}
@@ -0,0 +1,693 @@
+/**
+ * @file archivo_columnar.cpp
+ * @brief Encoder, validating reader and block scans of the columnar archive
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/archivo_columnar.hpp"
+#include "../include/archivo_secuencial.hpp"
+#include "../include/codec_enums.hpp"
+#include "../include/fecha.hpp"
+#include "../include/snapshot_inventario.hpp"
+#include "../include/suma_verificacion.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+namespace {
+    using FormatoColumnar::FILAS_POR_BLOQUE;
+
+    [[noreturn]] void corrupto(const std::string& ruta, const char* motivo) {
+        throw std::runtime_error("[ArchivoColumnar] Archivo '" + ruta + "' inválido: " + motivo);
+    }
+
+    constexpr std::uint64_t zigzag(const std::int64_t valor) noexcept {
+        return (static_cast<std::uint64_t>(valor) << 1) ^ static_cast<std::uint64_t>(valor >> 63);
+    }
+
+    constexpr std::int64_t desZigzag(const std::uint64_t valor) noexcept {
+        return static_cast<std::int64_t>(valor >> 1) ^ -static_cast<std::int64_t>(valor & 1);
+    }
+
+    constexpr std::uint64_t mascaraBits(const unsigned bits) noexcept {
+        return bits >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+    }
+
+    void escribirVarint(std::string& salida, std::uint64_t valor) {
+        for (; valor >= 0x80; valor >>= 7) salida.push_back(static_cast<char>((valor & 0x7F) | 0x80));
+        salida.push_back(static_cast<char>(valor));
+    }
+
+    // Codec de bloques: mínimo, ancho en bits y desplazamientos desde el
+    // mínimo empaquetados desde el bit menos significativo
+    std::string empaquetar(const std::vector<std::uint64_t>& valores) {
+        std::string salida;
+        for (std::size_t inicio = 0; inicio < valores.size(); inicio += FILAS_POR_BLOQUE) {
+            const auto primero = valores.begin() + static_cast<std::ptrdiff_t>(inicio);
+            const auto ultimo = valores.begin() + static_cast<std::ptrdiff_t>(
+                                    std::min(valores.size(), inicio + FILAS_POR_BLOQUE));
+            const auto extremos = std::minmax_element(primero, ultimo);
+            const std::uint64_t base = *extremos.first;
+            unsigned ancho = 0;
+            for (std::uint64_t rango = *extremos.second - base; rango != 0; rango >>= 1) ++ancho;
+            escribirVarint(salida, base);
+            salida.push_back(static_cast<char>(ancho));
+
+            unsigned byte = 0;
+            unsigned ocupados = 0;
+            for (auto it = primero; it != ultimo; ++it) {
+                const std::uint64_t desplazamiento = *it - base;
+                for (unsigned escritos = 0; escritos < ancho;) {
+                    const unsigned tomados = std::min(ancho - escritos, 8 - ocupados);
+                    byte |= static_cast<unsigned>((desplazamiento >> escritos) & mascaraBits(tomados)) << ocupados;
+                    escritos += tomados;
+                    ocupados += tomados;
+                    if (ocupados == 8) {
+                        salida.push_back(static_cast<char>(byte));
+                        byte = 0;
+                        ocupados = 0;
+                    }
+                }
+            }
+            if (ocupados > 0) salida.push_back(static_cast<char>(byte));
+        }
+        return salida;
+    }
+
+    void agregarSeccion(std::string& columna, const std::string& seccion) {
+        escribirVarint(columna, seccion.size());
+        columna += seccion;
+    }
+
+    // Diccionario en orden de primera aparición
+    template <typename T>
+    std::string codificarDiccionario(const std::vector<T>& valores) {
+        std::unordered_map<T, std::uint64_t> codigoDe;
+        std::vector<std::uint64_t> diccionario;
+        std::vector<std::uint64_t> codigos;
+        codigos.reserve(valores.size());
+        for (const T valor : valores) {
+            const auto insertado = codigoDe.emplace(valor, diccionario.size());
+            if (insertado.second) diccionario.push_back(zigzag(valor));
+            codigos.push_back(insertado.first->second);
+        }
+        std::string columna;
+        escribirVarint(columna, diccionario.size());
+        agregarSeccion(columna, empaquetar(diccionario));
+        agregarSeccion(columna, empaquetar(codigos));
+        return columna;
+    }
+
+    /**
+     * Lectura acotada de varints y secciones dentro de una columna
+     */
+    class LectorSecciones {
+    public:
+        LectorSecciones(const unsigned char* datos, const std::size_t bytes, const std::string& ruta)
+            : m_cursor(datos), m_fin(datos + bytes), m_ruta(ruta) {}
+
+        std::uint64_t varint() {
+            std::uint64_t valor = 0;
+            for (unsigned desplazamiento = 0; desplazamiento < 64; desplazamiento += 7) {
+                if (m_cursor == m_fin) corrupto(m_ruta, "varint truncado");
+                const unsigned byte = *m_cursor++;
+                valor |= std::uint64_t{byte & 0x7Fu} << desplazamiento;
+                if ((byte & 0x80u) == 0) return valor;
+            }
+            corrupto(m_ruta, "varint demasiado largo");
+        }
+
+        const unsigned char* tomar(const std::uint64_t bytes) {
+            if (bytes > static_cast<std::uint64_t>(m_fin - m_cursor)) corrupto(m_ruta, "sección fuera de la columna");
+            const unsigned char* inicio = m_cursor;
+            m_cursor += bytes;
+            return inicio;
+        }
+
+        bool agotado() const noexcept { return m_cursor == m_fin; }
+
+    private:
+        const unsigned char* m_cursor;
+        const unsigned char* m_fin;
+        const std::string& m_ruta;
+    };
+
+    /**
+     * Decodificador secuencial del codec de bloques
+     */
+    class LectorBloques {
+    public:
+        LectorBloques(const unsigned char* datos, const std::size_t bytes, const std::size_t cantidad,
+                      const std::string& ruta)
+            : m_lector(datos, bytes, ruta), m_restantes(cantidad), m_ruta(&ruta) {}
+
+        // Los siguientes min(restantes, FILAS_POR_BLOQUE) valores
+        std::size_t siguiente(std::uint64_t* salida) {
+            const std::size_t cantidad = std::min(m_restantes, FILAS_POR_BLOQUE);
+            if (cantidad == 0) return 0;
+            const std::uint64_t base = m_lector.varint();
+            const unsigned ancho = *m_lector.tomar(1);
+            if (ancho > 64) corrupto(*m_ruta, "ancho de bloque inválido");
+            const unsigned char* byte = m_lector.tomar((cantidad * ancho + 7) / 8);
+
+            if (ancho == 0) {
+                std::fill(salida, salida + cantidad, base);
+            } else {
+                unsigned consumidos = 0;  // bits ya leídos de *byte
+                for (std::size_t i = 0; i < cantidad; ++i) {
+                    std::uint64_t valor = 0;
+                    for (unsigned leidos = 0; leidos < ancho;) {
+                        const unsigned tomados = std::min(ancho - leidos, 8 - consumidos);
+                        valor |= ((std::uint64_t{*byte} >> consumidos) & mascaraBits(tomados)) << leidos;
+                        leidos += tomados;
+                        consumidos += tomados;
+                        if (consumidos == 8) {
+                            ++byte;
+                            consumidos = 0;
+                        }
+                    }
+                    salida[i] = base + valor;
+                }
+            }
+            m_restantes -= cantidad;
+            return cantidad;
+        }
+
+    private:
+        LectorSecciones m_lector;
+        std::size_t m_restantes;
+        const std::string* m_ruta;
+    };
+
+    std::vector<std::uint64_t> decodificarTodo(const unsigned char* datos, const std::size_t bytes,
+                                               const std::size_t cantidad, const std::string& ruta) {
+        std::vector<std::uint64_t> valores(cantidad);
+        LectorBloques lector(datos, bytes, cantidad, ruta);
+        for (std::size_t hecho = 0; hecho < cantidad;) hecho += lector.siguiente(valores.data() + hecho);
+        return valores;
+    }
+
+    constexpr CodificacionColumna codificacionEsperada(const ColumnaArchivo columna) noexcept {
+        switch (columna) {
+            case ColumnaArchivo::CODIGO: return CodificacionColumna::PREFIJOS;
+            case ColumnaArchivo::FECHA: return CodificacionColumna::DELTA;
+            case ColumnaArchivo::TEXTO: return CodificacionColumna::DICCIONARIO_TEXTOS;
+            case ColumnaArchivo::COSTO: return CodificacionColumna::CENTESIMAS;  // o IEEE
+            default: return CodificacionColumna::DICCIONARIO_ENTEROS;
+        }
+    }
+
+    // Valor máximo admitido en cada columna de enumeración o entero
+    std::int64_t maximoColumna(const ColumnaArchivo columna) noexcept {
+        switch (columna) {
+            case ColumnaArchivo::TIPO: return static_cast<std::int64_t>(CodecEnums::TIPO.cantidad()) - 1;
+            case ColumnaArchivo::ESTADO: return static_cast<std::int64_t>(CodecEnums::ESTADO.cantidad()) - 1;
+            case ColumnaArchivo::MARCA: return static_cast<std::int64_t>(CodecEnums::MARCA.cantidad()) - 1;
+            case ColumnaArchivo::AREA:
+                return static_cast<std::int64_t>(std::max(CodecEnums::AREA_USO.cantidad(),
+                                                          CodecEnums::AREA_UBICACION.cantidad())) - 1;
+            default: return std::numeric_limits<std::int32_t>::max();
+        }
+    }
+
+    constexpr std::size_t indice(const ColumnaArchivo columna) noexcept {
+        return static_cast<std::size_t>(columna);
+    }
+
+    constexpr auto EQUIPO = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+}
+
+EscritorColumnar::EscritorColumnar(const std::size_t cantidadEstimada) {
+    m_prefijos.reserve(cantidadEstimada);
+    m_longitudesSufijo.reserve(cantidadEstimada);
+    m_tipos.reserve(cantidadEstimada);
+    m_estados.reserve(cantidadEstimada);
+    m_marcas.reserve(cantidadEstimada);
+    m_areas.reserve(cantidadEstimada);
+    m_vidasUtiles.reserve(cantidadEstimada);
+    m_costos.reserve(cantidadEstimada);
+    m_dias.reserve(cantidadEstimada);
+    m_textos.reserve(cantidadEstimada);
+}
+
+void EscritorColumnar::agregar(const Articulo& articulo) {
+    // Los códigos consecutivos suelen compartir prefijo ("EQ-0001", "EQ-0002")
+    const std::string& codigo = articulo.GetCode();
+    const std::size_t maximo = std::min(codigo.size(), m_codigoAnterior.size());
+    std::size_t prefijo = 0;
+    while (prefijo < maximo && codigo[prefijo] == m_codigoAnterior[prefijo]) ++prefijo;
+    m_prefijos.push_back(prefijo);
+    m_longitudesSufijo.push_back(codigo.size() - prefijo);
+    m_sufijos.append(codigo, prefijo, std::string::npos);
+    m_codigoAnterior = codigo;
+
+    m_tipos.push_back(static_cast<std::uint8_t>(articulo.GetType()));
+    m_estados.push_back(static_cast<std::uint8_t>(articulo.GetStatus()));
+    m_costos.push_back(articulo.GetUnitCost());
+    m_dias.push_back(articulo.GetEntryDay());
+    if (articulo.GetType() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
+        const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+        m_marcas.push_back(static_cast<std::uint8_t>(equipo.getMarca()));
+        m_areas.push_back(static_cast<std::uint8_t>(equipo.getAreaUso()));
+        m_vidasUtiles.push_back(equipo.getVidaUtilAnios());
+        m_textos.push_back(equipo.getTecnicoId());
+    } else {
+        const auto& mobiliario = static_cast<const MobiliarioClinico&>(articulo);
+        m_marcas.push_back(0);
+        m_areas.push_back(static_cast<std::uint8_t>(mobiliario.getAreaUbicacion()));
+        m_vidasUtiles.push_back(0);
+        m_textos.push_back(mobiliario.getMaterialId());
+    }
+}
+
+void EscritorColumnar::escribir(const std::string& ruta) const {
+    std::array<std::string, FormatoColumnar::COLUMNAS> columnas;
+    std::array<CodificacionColumna, FormatoColumnar::COLUMNAS> codificaciones{};
+    for (std::size_t c = 0; c < columnas.size(); ++c) {
+        codificaciones[c] = codificacionEsperada(static_cast<ColumnaArchivo>(c));
+    }
+
+    std::string& codigos = columnas[indice(ColumnaArchivo::CODIGO)];
+    agregarSeccion(codigos, empaquetar(m_prefijos));
+    agregarSeccion(codigos, empaquetar(m_longitudesSufijo));
+    agregarSeccion(codigos, m_sufijos);
+
+    columnas[indice(ColumnaArchivo::TIPO)] = codificarDiccionario(m_tipos);
+    columnas[indice(ColumnaArchivo::ESTADO)] = codificarDiccionario(m_estados);
+    columnas[indice(ColumnaArchivo::MARCA)] = codificarDiccionario(m_marcas);
+    columnas[indice(ColumnaArchivo::AREA)] = codificarDiccionario(m_areas);
+    columnas[indice(ColumnaArchivo::VIDA_UTIL)] = codificarDiccionario(m_vidasUtiles);
+
+    // Costo en centésimas si todos los valores lo permiten sin pérdida
+    std::vector<std::uint64_t> valores;
+    valores.reserve(m_costos.size());
+    bool exactos = true;
+    for (const double costo : m_costos) {
+        const double centesimas = std::round(costo * 100.0);
+        if (!(std::fabs(centesimas) < 9007199254740992.0) || centesimas / 100.0 != costo) {
+            exactos = false;
+            break;
+        }
+        valores.push_back(zigzag(static_cast<std::int64_t>(centesimas)));
+    }
+    if (!exactos) {
+        codificaciones[indice(ColumnaArchivo::COSTO)] = CodificacionColumna::IEEE;
+        valores.clear();
+        for (const double costo : m_costos) {
+            std::uint64_t bits;
+            std::memcpy(&bits, &costo, sizeof bits);
+            valores.push_back(bits);
+        }
+    }
+    agregarSeccion(columnas[indice(ColumnaArchivo::COSTO)], empaquetar(valores));
+
+    // Fechas agrupadas: la diferencia con la fila anterior ocupa pocos bits
+    valores.clear();
+    std::int64_t anterior = 0;
+    for (const std::int32_t dia : m_dias) {
+        valores.push_back(zigzag(dia - anterior));
+        anterior = dia;
+    }
+    agregarSeccion(columnas[indice(ColumnaArchivo::FECHA)], empaquetar(valores));
+
+    // Técnicos y materiales: diccionario de textos indexado por símbolo
+    std::vector<std::uint64_t> entradaDe;
+    std::vector<std::uint64_t> longitudes;
+    std::string textos;
+    valores.clear();
+    for (const TablaSimbolos::Id id : m_textos) {
+        if (id >= entradaDe.size()) entradaDe.resize(id + std::size_t{1}, std::numeric_limits<std::uint64_t>::max());
+        if (entradaDe[id] == std::numeric_limits<std::uint64_t>::max()) {
+            const std::string& texto = TablaSimbolos::global().texto(id);
+            entradaDe[id] = longitudes.size();
+            longitudes.push_back(texto.size());
+            textos += texto;
+        }
+        valores.push_back(entradaDe[id]);
+    }
+    std::string& columnaTexto = columnas[indice(ColumnaArchivo::TEXTO)];
+    escribirVarint(columnaTexto, longitudes.size());
+    agregarSeccion(columnaTexto, empaquetar(longitudes));
+    agregarSeccion(columnaTexto, textos);
+    agregarSeccion(columnaTexto, empaquetar(valores));
+
+    std::array<DescriptorColumna, FormatoColumnar::COLUMNAS> directorio{};
+    std::string datos;
+    std::uint64_t desplazamiento = sizeof(CabeceraColumnar) + sizeof directorio;
+    for (std::size_t c = 0; c < columnas.size(); ++c) {
+        DescriptorColumna& descriptor = directorio[c];
+        descriptor.columna = static_cast<std::uint8_t>(c);
+        descriptor.codificacion = static_cast<std::uint8_t>(codificaciones[c]);
+        descriptor.desplazamiento = desplazamiento;
+        descriptor.bytes = columnas[c].size();
+        descriptor.sumaVerificacion = sumaVerificacion(columnas[c].data(), columnas[c].size());
+        desplazamiento += columnas[c].size();
+        datos += columnas[c];
+    }
+
+    CabeceraColumnar cabecera{};
+    std::memcpy(cabecera.firma, FormatoColumnar::FIRMA, sizeof cabecera.firma);
+    cabecera.version = FormatoColumnar::VERSION;
+    cabecera.marcaOrden = SnapshotInventario::MARCA_ORDEN;
+    cabecera.cantidadArticulos = m_tipos.size();
+    cabecera.cantidadColumnas = static_cast<std::uint32_t>(FormatoColumnar::COLUMNAS);
+    cabecera.sumaDirectorio = sumaVerificacion(directorio.data(), sizeof directorio);
+
+    ArchivoSecuencial::reemplazar(ruta, {{&cabecera, sizeof cabecera},
+                                         {directorio.data(), sizeof directorio},
+                                         {datos.data(), datos.size()}});
+}
+
+LectorColumnar::LectorColumnar(const std::string& ruta) : m_ruta(ruta), m_archivo(ruta) {
+    const unsigned char* const base = m_archivo.datos();
+    const std::size_t tamano = m_archivo.size();
+    if (tamano < sizeof(CabeceraColumnar)) corrupto(ruta, "truncado");
+
+    CabeceraColumnar cabecera;
+    std::memcpy(&cabecera, base, sizeof cabecera);
+    if (std::memcmp(cabecera.firma, FormatoColumnar::FIRMA, sizeof cabecera.firma) != 0) {
+        corrupto(ruta, "firma desconocida");
+    }
+    if (cabecera.marcaOrden != SnapshotInventario::MARCA_ORDEN) corrupto(ruta, "orden de bytes distinto");
+    if (cabecera.version != FormatoColumnar::VERSION) corrupto(ruta, "versión no soportada");
+    if (cabecera.cantidadColumnas != FormatoColumnar::COLUMNAS) corrupto(ruta, "cantidad de columnas inesperada");
+
+    std::array<DescriptorColumna, FormatoColumnar::COLUMNAS> directorio;
+    if (tamano - sizeof cabecera < sizeof directorio) corrupto(ruta, "directorio truncado");
+    std::memcpy(directorio.data(), base + sizeof cabecera, sizeof directorio);
+    if (sumaVerificacion(directorio.data(), sizeof directorio) != cabecera.sumaDirectorio) {
+        corrupto(ruta, "suma de verificación del directorio incorrecta");
+    }
+    if (cabecera.cantidadArticulos > std::numeric_limits<std::uint32_t>::max()) {
+        corrupto(ruta, "cantidad de artículos fuera de rango");
+    }
+    m_cantidad = static_cast<std::size_t>(cabecera.cantidadArticulos);
+
+    std::array<bool, FormatoColumnar::COLUMNAS> vista{};
+    for (const DescriptorColumna& descriptor : directorio) {
+        if (descriptor.columna >= FormatoColumnar::COLUMNAS || vista[descriptor.columna]) {
+            corrupto(ruta, "columna desconocida o repetida");
+        }
+        vista[descriptor.columna] = true;
+        const auto columna = static_cast<ColumnaArchivo>(descriptor.columna);
+        const auto codificacion = static_cast<CodificacionColumna>(descriptor.codificacion);
+        const bool costoIeee = columna == ColumnaArchivo::COSTO && codificacion == CodificacionColumna::IEEE;
+        if (codificacion != codificacionEsperada(columna) && !costoIeee) corrupto(ruta, "codificación no soportada");
+        if (descriptor.desplazamiento > tamano || descriptor.bytes > tamano - descriptor.desplazamiento) {
+            corrupto(ruta, "columna fuera del archivo");
+        }
+        const unsigned char* datos = base + descriptor.desplazamiento;
+        const auto bytes = static_cast<std::size_t>(descriptor.bytes);
+        if (sumaVerificacion(datos, bytes) != descriptor.sumaVerificacion) {
+            corrupto(ruta, "suma de verificación de columna incorrecta");
+        }
+
+        Columna& destino = m_columnas[descriptor.columna];
+        destino.codificacion = codificacion;
+        LectorSecciones secciones(datos, bytes, ruta);
+        const auto seccion = [&secciones]() {
+            const std::uint64_t longitud = secciones.varint();
+            return Seccion{secciones.tomar(longitud), static_cast<std::size_t>(longitud)};
+        };
+        std::uint64_t tamanoDiccionario = 0;
+        Seccion diccionario;
+        switch (codificacion) {
+            case CodificacionColumna::PREFIJOS:
+                destino.filas = seccion();
+                destino.longitudes = seccion();
+                destino.bytes = seccion();
+                break;
+            case CodificacionColumna::DICCIONARIO_ENTEROS:
+            case CodificacionColumna::DICCIONARIO_TEXTOS:
+                tamanoDiccionario = secciones.varint();
+                if (tamanoDiccionario > m_cantidad) corrupto(ruta, "diccionario mayor que la columna");
+                diccionario = seccion();
+                if (codificacion == CodificacionColumna::DICCIONARIO_TEXTOS) destino.bytes = seccion();
+                destino.filas = seccion();
+                break;
+            default:
+                destino.filas = seccion();
+                break;
+        }
+        if (!secciones.agotado()) corrupto(ruta, "bytes sobrantes en la columna");
+
+        const auto cantidadDiccionario = static_cast<std::size_t>(tamanoDiccionario);
+        if (codificacion == CodificacionColumna::DICCIONARIO_ENTEROS) {
+            std::vector<std::int64_t>& valores = m_diccionarios[descriptor.columna];
+            for (const std::uint64_t valor : decodificarTodo(diccionario.datos, diccionario.bytes, cantidadDiccionario, ruta)) {
+                valores.push_back(desZigzag(valor));
+                if (valores.back() < 0 || valores.back() > maximoColumna(columna)) {
+                    corrupto(ruta, "valor de enumeración desconocido");
+                }
+            }
+        } else if (codificacion == CodificacionColumna::DICCIONARIO_TEXTOS) {
+            LectorSecciones textos(destino.bytes.datos, destino.bytes.bytes, ruta);
+            for (const std::uint64_t longitud : decodificarTodo(diccionario.datos, diccionario.bytes, cantidadDiccionario, ruta)) {
+                m_textos.emplace_back(reinterpret_cast<const char*>(textos.tomar(longitud)),
+                                      static_cast<std::size_t>(longitud));
+            }
+        }
+    }
+}
+
+namespace {
+    std::map<std::string, int> aMapa(const std::vector<int>& porEntrada, const LectorColumnar& lector) {
+        std::map<std::string, int> conteo;
+        for (std::uint32_t entrada = 0; entrada < porEntrada.size(); ++entrada) {
+            if (porEntrada[entrada] > 0) conteo.emplace(lector.texto(entrada), porEntrada[entrada]);
+        }
+        return conteo;
+    }
+
+    template <typename Enum>
+    std::map<Enum, int> aMapa(const std::array<int, 256>& porValor) {
+        std::map<Enum, int> conteo;
+        for (std::size_t valor = 0; valor < porValor.size(); ++valor) {
+            if (porValor[valor] > 0) conteo[static_cast<Enum>(valor)] = porValor[valor];
+        }
+        return conteo;
+    }
+}
+
+ContadoresInventario LectorColumnar::resumirPorTipoYEstado() const {
+    using FormatoColumnar::mascara;
+    ContadoresInventario contadores;
+    CursorColumnar cursor(*this, mascara(ColumnaArchivo::TIPO) | mascara(ColumnaArchivo::ESTADO) |
+                                     mascara(ColumnaArchivo::COSTO));
+    BloqueColumnar bloque;
+    while (cursor.siguiente(bloque)) {
+        for (std::size_t i = 0; i < bloque.cantidad; ++i) {
+            contadores.agregar(bloque.tipo[i], bloque.estado[i], bloque.costoUnitario[i]);
+        }
+    }
+    return contadores;
+}
+
+// Se cuenta por entrada del diccionario y solo al final se resuelven los nombres
+std::map<std::string, int> LectorColumnar::contarEquiposPorTecnico() const {
+    std::vector<int> porEntrada(m_textos.size(), 0);
+    CursorColumnar cursor(*this, FormatoColumnar::mascara(ColumnaArchivo::TEXTO));
+    BloqueColumnar bloque;
+    while (cursor.siguiente(bloque)) {
+        for (std::size_t i = 0; i < bloque.cantidad; ++i) {
+            if (bloque.tipo[i] == EQUIPO) ++porEntrada[bloque.texto[i]];
+        }
+    }
+    return aMapa(porEntrada, *this);
+}
+
+std::array<int, 256> LectorColumnar::contarPorValor(const ColumnaArchivo columna,
+                                                    const MedicalInventory::Domain::ArticleType tipo) const {
+    std::array<int, 256> porValor{};
+    const auto tipoBuscado = static_cast<std::uint8_t>(tipo);
+    CursorColumnar cursor(*this, FormatoColumnar::mascara(columna));
+    BloqueColumnar bloque;
+    const auto& valores = columna == ColumnaArchivo::MARCA ? bloque.marca : bloque.area;
+    while (cursor.siguiente(bloque)) {
+        for (std::size_t i = 0; i < bloque.cantidad; ++i) {
+            if (bloque.tipo[i] == tipoBuscado) ++porValor[valores[i]];
+        }
+    }
+    return porValor;
+}
+
+std::map<AreaUso, int> LectorColumnar::contarEquiposPorArea() const {
+    return aMapa<AreaUso>(contarPorValor(ColumnaArchivo::AREA, MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT));
+}
+
+std::map<AreaUbicacion, int> LectorColumnar::contarMobiliarioPorArea() const {
+    return aMapa<AreaUbicacion>(contarPorValor(ColumnaArchivo::AREA,
+                                               MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE));
+}
+
+std::map<MarcaEquipo, int> LectorColumnar::contarEquiposPorMarca() const {
+    return aMapa<MarcaEquipo>(contarPorValor(ColumnaArchivo::MARCA,
+                                             MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT));
+}
+
+std::size_t LectorColumnar::contarIngresosEntre(const std::int32_t diaDesde, const std::int32_t diaHasta) const {
+    std::size_t cantidad = 0;
+    CursorColumnar cursor(*this, FormatoColumnar::mascara(ColumnaArchivo::FECHA));
+    BloqueColumnar bloque;
+    while (cursor.siguiente(bloque)) {
+        for (std::size_t i = 0; i < bloque.cantidad; ++i) {
+            cantidad += (bloque.diaIngreso[i] >= diaDesde && bloque.diaIngreso[i] <= diaHasta) ? 1 : 0;
+        }
+    }
+    return cantidad;
+}
+
+ExtremosCostos LectorColumnar::obtenerExtremosCostos() const {
+    ExtremosCostos extremos;
+    CursorColumnar cursor(*this, FormatoColumnar::mascara(ColumnaArchivo::COSTO));
+    BloqueColumnar bloque;
+    bool primero = true;
+    while (cursor.siguiente(bloque)) {
+        if (bloque.cantidad == 0) continue;
+        const ExtremosCostos parcial = KernelsCostos::calcularExtremos(bloque.costoUnitario.data(), bloque.cantidad);
+        // Solo un valor estrictamente mejor desplaza al de un bloque anterior
+        if (primero || parcial.minimo < extremos.minimo) {
+            extremos.minimo = parcial.minimo;
+            extremos.indiceMinimo = bloque.primeraFila + parcial.indiceMinimo;
+        }
+        if (primero || parcial.maximo > extremos.maximo) {
+            extremos.maximo = parcial.maximo;
+            extremos.indiceMaximo = bloque.primeraFila + parcial.indiceMaximo;
+        }
+        primero = false;
+    }
+    return extremos;
+}
+
+struct CursorColumnar::Estado {
+    std::vector<LectorBloques> bloques;            // uno por columna pedida, en orden de columna
+    std::vector<ColumnaArchivo> columnas;
+    std::unique_ptr<LectorBloques> sufijos;        // longitudes de sufijo de CODIGO
+    std::unique_ptr<LectorSecciones> bytesCodigo;  // bytes de sufijo de CODIGO
+    std::string codigoAnterior;
+    std::string codigosBloque;
+    std::int64_t diaAnterior = 0;
+    std::array<std::uint64_t, FILAS_POR_BLOQUE> valores{};
+    std::array<std::uint64_t, FILAS_POR_BLOQUE> longitudes{};
+};
+
+CursorColumnar::CursorColumnar(const LectorColumnar& lector, FormatoColumnar::Mascara columnas)
+    : m_lector(lector), m_estado(std::make_unique<Estado>()) {
+    using FormatoColumnar::mascara;
+    const FormatoColumnar::Mascara dependenDelTipo = mascara(ColumnaArchivo::MARCA) | mascara(ColumnaArchivo::AREA) |
+                                                     mascara(ColumnaArchivo::VIDA_UTIL) | mascara(ColumnaArchivo::TEXTO);
+    if (columnas & dependenDelTipo) columnas |= mascara(ColumnaArchivo::TIPO);
+    m_columnas = columnas & FormatoColumnar::TODAS;
+
+    m_estado->bloques.reserve(FormatoColumnar::COLUMNAS);
+    for (std::size_t c = 0; c < FormatoColumnar::COLUMNAS; ++c) {
+        if ((m_columnas & mascara(static_cast<ColumnaArchivo>(c))) == 0) continue;
+        const LectorColumnar::Columna& columna = lector.m_columnas[c];
+        m_estado->bloques.emplace_back(columna.filas.datos, columna.filas.bytes, lector.m_cantidad, lector.m_ruta);
+        m_estado->columnas.push_back(static_cast<ColumnaArchivo>(c));
+        if (static_cast<ColumnaArchivo>(c) == ColumnaArchivo::CODIGO) {
+            m_estado->sufijos = std::make_unique<LectorBloques>(columna.longitudes.datos, columna.longitudes.bytes,
+                                                                lector.m_cantidad, lector.m_ruta);
+            m_estado->bytesCodigo = std::make_unique<LectorSecciones>(columna.bytes.datos, columna.bytes.bytes,
+                                                                      lector.m_ruta);
+        }
+    }
+}
+
+CursorColumnar::~CursorColumnar() = default;
+
+bool CursorColumnar::siguiente(BloqueColumnar& bloque) {
+    const std::size_t cantidad = std::min(m_lector.m_cantidad - m_fila, FILAS_POR_BLOQUE);
+    if (cantidad == 0) return false;
+    const std::string& ruta = m_lector.m_ruta;
+    Estado& estado = *m_estado;
+    auto& valores = estado.valores;
+    bloque.primeraFila = m_fila;
+    bloque.cantidad = cantidad;
+
+    for (std::size_t k = 0; k < estado.columnas.size(); ++k) {
+        const ColumnaArchivo columna = estado.columnas[k];
+        estado.bloques[k].siguiente(valores.data());
+        const LectorColumnar::Columna& descripcion = m_lector.m_columnas[indice(columna)];
+
+        // Códigos de diccionario: se validan contra su tamaño al traducirlos
+        const std::vector<std::int64_t>& diccionario = m_lector.m_diccionarios[indice(columna)];
+        const auto traducir = [&](auto& destino) {
+            for (std::size_t i = 0; i < cantidad; ++i) {
+                if (valores[i] >= diccionario.size()) corrupto(ruta, "código fuera del diccionario");
+                destino[i] = static_cast<typename std::decay_t<decltype(destino)>::value_type>(diccionario[valores[i]]);
+            }
+        };
+
+        switch (columna) {
+            case ColumnaArchivo::CODIGO: {
+                estado.sufijos->siguiente(estado.longitudes.data());
+                estado.codigosBloque.clear();
+                std::array<std::size_t, FILAS_POR_BLOQUE> fin{};
+                for (std::size_t i = 0; i < cantidad; ++i) {
+                    if (valores[i] > estado.codigoAnterior.size()) corrupto(ruta, "prefijo de código inválido");
+                    const std::uint64_t longitud = estado.longitudes[i];
+                    const unsigned char* sufijo = estado.bytesCodigo->tomar(longitud);
+                    estado.codigoAnterior.resize(static_cast<std::size_t>(valores[i]));
+                    estado.codigoAnterior.append(reinterpret_cast<const char*>(sufijo), static_cast<std::size_t>(longitud));
+                    estado.codigosBloque += estado.codigoAnterior;
+                    fin[i] = estado.codigosBloque.size();
+                }
+                // Las vistas se crean al final: el buffer ya no se realoja
+                for (std::size_t i = 0, inicio = 0; i < cantidad; inicio = fin[i++]) {
+                    bloque.codigo[i] = std::string_view(estado.codigosBloque).substr(inicio, fin[i] - inicio);
+                }
+                break;
+            }
+            case ColumnaArchivo::TIPO: traducir(bloque.tipo); break;
+            case ColumnaArchivo::ESTADO: traducir(bloque.estado); break;
+            case ColumnaArchivo::MARCA: traducir(bloque.marca); break;
+            case ColumnaArchivo::AREA: traducir(bloque.area); break;
+            case ColumnaArchivo::VIDA_UTIL: traducir(bloque.vidaUtilAnios); break;
+            case ColumnaArchivo::COSTO:
+                for (std::size_t i = 0; i < cantidad; ++i) {
+                    if (descripcion.codificacion == CodificacionColumna::CENTESIMAS) {
+                        bloque.costoUnitario[i] = static_cast<double>(desZigzag(valores[i])) / 100.0;
+                    } else {
+                        std::memcpy(&bloque.costoUnitario[i], &valores[i], sizeof(double));
+                    }
+                }
+                break;
+            case ColumnaArchivo::FECHA:
+                for (std::size_t i = 0; i < cantidad; ++i) {
+                    estado.diaAnterior += desZigzag(valores[i]);
+                    if (estado.diaAnterior < Fecha::PRIMER_DIA || estado.diaAnterior > Fecha::ULTIMO_DIA) {
+                        corrupto(ruta, "fecha fuera de rango");
+                    }
+                    bloque.diaIngreso[i] = static_cast<std::int32_t>(estado.diaAnterior);
+                }
+                break;
+            case ColumnaArchivo::TEXTO:
+                for (std::size_t i = 0; i < cantidad; ++i) {
+                    if (valores[i] >= m_lector.m_textos.size()) corrupto(ruta, "código fuera del diccionario");
+                    bloque.texto[i] = static_cast<std::uint32_t>(valores[i]);
+                }
+                break;
+        }
+    }
+
+    // El área y la marca se interpretan según el tipo de cada fila
+    using FormatoColumnar::mascara;
+    if (m_columnas & (mascara(ColumnaArchivo::AREA) | mascara(ColumnaArchivo::MARCA))) {
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            const bool esEquipo = bloque.tipo[i] == EQUIPO;
+            const bool valido =
+                (!(m_columnas & mascara(ColumnaArchivo::AREA)) ||
+                 bloque.area[i] < (esEquipo ? CodecEnums::AREA_USO.cantidad() : CodecEnums::AREA_UBICACION.cantidad())) &&
+                (!(m_columnas & mascara(ColumnaArchivo::MARCA)) || esEquipo || bloque.marca[i] == 0);
+            if (!valido) corrupto(ruta, "valor de enumeración desconocido");
+        }
+    }
+    m_fila += cantidad;
+    return true;
+}
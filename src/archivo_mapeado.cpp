@@ -0,0 +1,107 @@
+/**
+ * @file archivo_mapeado.cpp
+ * @brief Implementation of the read-only memory-mapped file
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/archivo_mapeado.hpp"
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    [[noreturn]] void fallar(const std::string& ruta, const char* motivo) {
+        throw std::runtime_error("[ArchivoMapeado] No se pudo " + std::string(motivo) + " '" + ruta + "'");
+    }
+}
+
+#ifdef _WIN32
+
+ArchivoMapeado::ArchivoMapeado(const std::string& ruta) {
+    HANDLE archivo = CreateFileA(ruta.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (archivo == INVALID_HANDLE_VALUE) fallar(ruta, "abrir");
+    LARGE_INTEGER tamano{};
+    if (!GetFileSizeEx(archivo, &tamano)) {
+        CloseHandle(archivo);
+        fallar(ruta, "leer el tamaño de");
+    }
+    if (tamano.QuadPart == 0) {
+        CloseHandle(archivo);
+        return;
+    }
+    // La vista mantiene viva la sección; los handles pueden cerrarse ya
+    HANDLE mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(archivo);
+    if (mapeo == nullptr) fallar(ruta, "mapear");
+    void* vista = MapViewOfFile(mapeo, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapeo);
+    if (vista == nullptr) fallar(ruta, "mapear");
+    m_datos = static_cast<const unsigned char*>(vista);
+    m_tamano = static_cast<std::size_t>(tamano.QuadPart);
+}
+
+void ArchivoMapeado::liberar() noexcept {
+    if (m_datos != nullptr) UnmapViewOfFile(m_datos);
+    m_datos = nullptr;
+    m_tamano = 0;
+}
+
+#else
+
+ArchivoMapeado::ArchivoMapeado(const std::string& ruta) {
+    const int descriptor = ::open(ruta.c_str(), O_RDONLY);
+    if (descriptor < 0) fallar(ruta, "abrir");
+    struct stat estado {};
+    if (::fstat(descriptor, &estado) != 0) {
+        ::close(descriptor);
+        fallar(ruta, "leer el tamaño de");
+    }
+    const auto tamano = static_cast<std::size_t>(estado.st_size);
+    if (tamano == 0) {
+        ::close(descriptor);
+        return;
+    }
+    void* vista = ::mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (vista == MAP_FAILED) fallar(ruta, "mapear");
+    m_datos = static_cast<const unsigned char*>(vista);
+    m_tamano = tamano;
+}
+
+void ArchivoMapeado::liberar() noexcept {
+    if (m_datos != nullptr) ::munmap(const_cast<unsigned char*>(m_datos), m_tamano);
+    m_datos = nullptr;
+    m_tamano = 0;
+}
+
+#endif
+
+ArchivoMapeado::~ArchivoMapeado() {
+    liberar();
+}
+
+ArchivoMapeado::ArchivoMapeado(ArchivoMapeado&& otro) noexcept
+    : m_datos(std::exchange(otro.m_datos, nullptr)),
+      m_tamano(std::exchange(otro.m_tamano, 0)) {}
+
+ArchivoMapeado& ArchivoMapeado::operator=(ArchivoMapeado&& otro) noexcept {
+    if (this != &otro) {
+        liberar();
+        m_datos = std::exchange(otro.m_datos, nullptr);
+        m_tamano = std::exchange(otro.m_tamano, 0);
+    }
+    return *this;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file archivo_secuencial.cpp
+ * @brief Implementation of the append-only file
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/archivo_secuencial.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    [[noreturn]] void fallar(const std::string& ruta, const char* motivo) {
+        throw std::runtime_error("[ArchivoSecuencial] No se pudo " + std::string(motivo) + " '" + ruta + "'");
+    }
+}
+
+#ifdef _WIN32
+
+ArchivoSecuencial::ArchivoSecuencial(const std::string& ruta, const Modo modo) : m_ruta(ruta) {
+    HANDLE archivo = CreateFileA(ruta.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                                 modo == Modo::CREAR ? CREATE_ALWAYS : OPEN_ALWAYS,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (archivo == INVALID_HANDLE_VALUE) fallar(ruta, "abrir");
+    LARGE_INTEGER tamano{};
+    if (!GetFileSizeEx(archivo, &tamano) || !SetFilePointerEx(archivo, tamano, nullptr, FILE_BEGIN)) {
+        CloseHandle(archivo);
+        fallar(ruta, "posicionar");
+    }
+    m_handle = archivo;
+    m_tamano = static_cast<std::uint64_t>(tamano.QuadPart);
+}
+
+bool ArchivoSecuencial::abierto() const noexcept {
+    return m_handle != nullptr;
+}
+
+void ArchivoSecuencial::escribir(const void* datos, std::size_t bytes) {
+    const auto* cursor = static_cast<const char*>(datos);
+    while (bytes > 0) {
+        const DWORD parte = bytes > 0x40000000u ? 0x40000000u : static_cast<DWORD>(bytes);
+        DWORD escritos = 0;
+        if (!WriteFile(m_handle, cursor, parte, &escritos, nullptr) || escritos == 0) fallar(m_ruta, "escribir en");
+        cursor += escritos;
+        bytes -= escritos;
+        m_tamano += escritos;
+    }
+}
+
+void ArchivoSecuencial::sincronizar() {
+    if (!FlushFileBuffers(m_handle)) fallar(m_ruta, "sincronizar");
+}
+
+void ArchivoSecuencial::truncar(const std::uint64_t tamano) {
+    LARGE_INTEGER posicion{};
+    posicion.QuadPart = static_cast<LONGLONG>(tamano);
+    if (!SetFilePointerEx(m_handle, posicion, nullptr, FILE_BEGIN) || !SetEndOfFile(m_handle)) {
+        fallar(m_ruta, "truncar");
+    }
+    m_tamano = tamano;
+}
+
+void ArchivoSecuencial::cerrar() noexcept {
+    if (m_handle != nullptr) CloseHandle(m_handle);
+    m_handle = nullptr;
+}
+
+void ArchivoSecuencial::sincronizarDirectorio(const std::string&) {}
+
+#else
+
+ArchivoSecuencial::ArchivoSecuencial(const std::string& ruta, const Modo modo) : m_ruta(ruta) {
+    const int banderas = O_WRONLY | O_CREAT | (modo == Modo::CREAR ? O_TRUNC : O_APPEND);
+    m_descriptor = ::open(ruta.c_str(), banderas, 0644);
+    if (m_descriptor < 0) fallar(ruta, "abrir");
+    struct stat estado {};
+    if (::fstat(m_descriptor, &estado) != 0) {
+        cerrar();
+        fallar(ruta, "leer el tamaño de");
+    }
+    m_tamano = static_cast<std::uint64_t>(estado.st_size);
+}
+
+bool ArchivoSecuencial::abierto() const noexcept {
+    return m_descriptor >= 0;
+}
+
+void ArchivoSecuencial::escribir(const void* datos, std::size_t bytes) {
+    const auto* cursor = static_cast<const char*>(datos);
+    while (bytes > 0) {
+        const ssize_t escritos = ::write(m_descriptor, cursor, bytes);
+        if (escritos < 0 && errno == EINTR) continue;
+        if (escritos <= 0) fallar(m_ruta, "escribir en");
+        cursor += escritos;
+        bytes -= static_cast<std::size_t>(escritos);
+        m_tamano += static_cast<std::uint64_t>(escritos);
+    }
+}
+
+void ArchivoSecuencial::sincronizar() {
+#if defined(__APPLE__)
+    // fsync no vacía la caché del disco en macOS
+    if (::fcntl(m_descriptor, F_FULLFSYNC) == 0) return;
+#endif
+    if (::fsync(m_descriptor) != 0) fallar(m_ruta, "sincronizar");
+}
+
+void ArchivoSecuencial::truncar(const std::uint64_t tamano) {
+    // Con O_APPEND la siguiente escritura continúa en el nuevo final
+    if (::ftruncate(m_descriptor, static_cast<off_t>(tamano)) != 0) fallar(m_ruta, "truncar");
+    m_tamano = tamano;
+}
+
+void ArchivoSecuencial::cerrar() noexcept {
+    if (m_descriptor >= 0) ::close(m_descriptor);
+    m_descriptor = -1;
+}
+
+void ArchivoSecuencial::sincronizarDirectorio(const std::string& ruta) {
+    const std::size_t barra = ruta.find_last_of('/');
+    const std::string directorio = (barra == std::string::npos) ? "." : (barra == 0 ? "/" : ruta.substr(0, barra));
+    const int descriptor = ::open(directorio.c_str(), O_RDONLY);
+    if (descriptor < 0) fallar(directorio, "abrir");
+    const int resultado = ::fsync(descriptor);
+    ::close(descriptor);
+    if (resultado != 0) fallar(directorio, "sincronizar");
+}
+
+#endif
+
+ArchivoSecuencial::~ArchivoSecuencial() {
+    cerrar();
+}
+
+#ifdef _WIN32
+ArchivoSecuencial::ArchivoSecuencial(ArchivoSecuencial&& otro) noexcept
+    : m_ruta(std::move(otro.m_ruta)),
+      m_handle(std::exchange(otro.m_handle, nullptr)),
+      m_tamano(std::exchange(otro.m_tamano, 0)) {}
+
+ArchivoSecuencial& ArchivoSecuencial::operator=(ArchivoSecuencial&& otro) noexcept {
+    if (this != &otro) {
+        cerrar();
+        m_ruta = std::move(otro.m_ruta);
+        m_handle = std::exchange(otro.m_handle, nullptr);
+        m_tamano = std::exchange(otro.m_tamano, 0);
+    }
+    return *this;
+}
+#else
+ArchivoSecuencial::ArchivoSecuencial(ArchivoSecuencial&& otro) noexcept
+    : m_ruta(std::move(otro.m_ruta)),
+      m_descriptor(std::exchange(otro.m_descriptor, -1)),
+      m_tamano(std::exchange(otro.m_tamano, 0)) {}
+
+ArchivoSecuencial& ArchivoSecuencial::operator=(ArchivoSecuencial&& otro) noexcept {
+    if (this != &otro) {
+        cerrar();
+        m_ruta = std::move(otro.m_ruta);
+        m_descriptor = std::exchange(otro.m_descriptor, -1);
+        m_tamano = std::exchange(otro.m_tamano, 0);
+    }
+    return *this;
+}
+#endif
+
+void ArchivoSecuencial::reemplazar(const std::string& ruta, const std::initializer_list<Tramo> tramos) {
+    const std::string temporal = ruta + ".tmp";
+    try {
+        ArchivoSecuencial archivo(temporal, Modo::CREAR);
+        for (const Tramo& tramo : tramos) archivo.escribir(tramo.datos, tramo.bytes);
+        archivo.sincronizar();
+    } catch (const std::runtime_error&) {
+        std::remove(temporal.c_str());
+        throw;
+    }
+    std::error_code error;
+    std::filesystem::rename(temporal, ruta, error);
+    if (error) {
+        std::remove(temporal.c_str());
+        fallar(ruta, "reemplazar");
+    }
+    sincronizarDirectorio(ruta);
+}
@@ -6,22 +6,24 @@
  */
 
 #include "../include/articulo.hpp"
+#include "../include/validacion.hpp"
+#include "../include/codec_enums.hpp"
 #include <sstream>
-#include <algorithm>
-#include <regex>
-#include <cctype>
+#include <cmath>
 
 using namespace MedicalInventory::Domain;
 
 // Constructor con validación
-Articulo::Articulo(const std::string& code, 
+Articulo::Articulo(const std::string_view code, 
                    const ArticleType type, 
-                   const std::string& entryDate,
+                   const std::string_view entryDate,
                    const ArticleStatus status, 
                    const double unitCost)
-    : m_code(code), m_type(type), m_entryDate(entryDate), 
+    : m_code(code), m_type(type), m_entryDateId(TablaSimbolos::SIN_ID), m_entryDay(0),
       m_status(status), m_unitCost(unitCost) {
     ValidateParameters(code, entryDate, unitCost);
+    m_entryDateId = TablaSimbolos::global().internar(entryDate);
+    m_entryDay = Fecha::diasDesdeTexto(entryDate);
 }
 
 void Articulo::SetUnitCost(const double newCost) {
@@ -30,7 +32,7 @@ void Articulo::SetUnitCost(const double newCost) {
                                   std::to_string(Validation::MIN_COST) + 
                                   " y " + std::to_string(Validation::MAX_COST));
     }
-    m_unitCost = newCost;
+    AssignAndNotify(m_unitCost, newCost, ArticleChange::COST);
 }
 
 double Articulo::CalculateTotalCost() const {
@@ -38,79 +40,44 @@ double Articulo::CalculateTotalCost() const {
 }
 
 std::string Articulo::TypeToString(const ArticleType type) {
-    switch (type) {
-        case ArticleType::MEDICAL_EQUIPMENT:   return "Medical Equipment";
-        case ArticleType::CLINICAL_FURNITURE:  return "Clinical Furniture";
-        default:                               return "Unknown Type";
-    }
+    return std::string(TypeName(type));
 }
 
 std::string Articulo::StatusToString(const ArticleStatus status) {
-    switch (status) {
-        case ArticleStatus::OPERATIONAL:   return "Operational";
-        case ArticleStatus::UNDER_REVIEW:  return "Under Review";
-        case ArticleStatus::DAMAGED:       return "Damaged";
-        default:                           return "Unknown Status";
-    }
+    return std::string(StatusName(status));
 }
 
-Articulo::ArticleType Articulo::StringToType(const std::string& str) {
-    std::string lowerStr = str;
-    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
-    if (lowerStr == "medical equipment" || lowerStr == "equipo_medico" || 
-        lowerStr == "equipo médico" || lowerStr == "equipment") {
-        return ArticleType::MEDICAL_EQUIPMENT;
-    }
-    if (lowerStr == "clinical furniture" || lowerStr == "mobiliario_clinico" || 
-        lowerStr == "mobiliario clínico" || lowerStr == "furniture") {
-        return ArticleType::CLINICAL_FURNITURE;
-    }
-    throw std::invalid_argument("[Articulo] Tipo de artículo inválido: " + str);
+std::string_view Articulo::TypeName(const ArticleType type) noexcept {
+    return CodecEnums::TIPO.nombre(type);
 }
 
-Articulo::ArticleStatus Articulo::StringToStatus(const std::string& str) {
-    std::string lowerStr = str;
-    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
-    if (lowerStr == "operational" || lowerStr == "operativo") {
-        return ArticleStatus::OPERATIONAL;
-    }
-    if (lowerStr == "under review" || lowerStr == "en revisión" || 
-        lowerStr == "en revision" || lowerStr == "en_revision") {
-        return ArticleStatus::UNDER_REVIEW;
+std::string_view Articulo::StatusName(const ArticleStatus status) noexcept {
+    return CodecEnums::ESTADO.nombre(status);
+}
+
+Articulo::ArticleType Articulo::StringToType(const std::string_view str) {
+    ArticleType type{};
+    if (!CodecEnums::TIPO.parsear(str, type)) {
+        throw std::invalid_argument("[Articulo] Tipo de artículo inválido: " + std::string(str));
     }
-    if (lowerStr == "damaged" || lowerStr == "dañado" || lowerStr == "danado") {
-        return ArticleStatus::DAMAGED;
+    return type;
+}
+
+Articulo::ArticleStatus Articulo::StringToStatus(const std::string_view str) {
+    ArticleStatus status{};
+    if (!CodecEnums::ESTADO.parsear(str, status)) {
+        throw std::invalid_argument("[Articulo] Estado de artículo inválido: " + std::string(str));
     }
-    throw std::invalid_argument("[Articulo] Estado de artículo inválido: " + str);
+    return status;
 }
 
 // Validation methods
-bool Articulo::IsValidCode(const std::string& code) {
-    if (code.empty() || 
-        code.length() < Validation::MIN_CODE_LENGTH || 
-        code.length() > Validation::MAX_CODE_LENGTH) {
-        return false;
-    }
-    const std::regex codePattern("^[A-Za-z0-9_-]+$");
-    return std::regex_match(code, codePattern);
-}
-
-bool Articulo::IsValidDate(const std::string& date) {
-    if (date.length() != 10) return false;
-    const std::regex datePattern("^([0-2][0-9]|3[01])/(0[1-9]|1[0-2])/([12][0-9]{3})$");
-    if (!std::regex_match(date, datePattern)) return false;
-    const int day = std::stoi(date.substr(0, 2));
-    const int month = std::stoi(date.substr(3, 2));
-    const int year = std::stoi(date.substr(6, 4));
-    if (day < 1 || day > 31 || month < 1 || month > 12) return false;
-    if (year < 2000 || year > 2099) return false;
-    if (month == 2) {
-        const bool isLeapYear = (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
-        if (day > (isLeapYear ? 29 : 28)) return false;
-    } else if (month == 4 || month == 6 || month == 9 || month == 11) {
-        if (day > 30) return false;
-    }
-    return true;
+bool Articulo::IsValidCode(const std::string_view code) noexcept {
+    return Validacion::codigoValido(code);
+}
+
+bool Articulo::IsValidDate(const std::string_view date) noexcept {
+    return Validacion::fechaValida(date);
 }
 
 bool Articulo::IsValidCost(const double cost) {
@@ -133,17 +100,17 @@ bool Articulo::operator<(const Articulo& other) const {
     return m_code < other.m_code;
 }
 
-void Articulo::ValidateParameters(const std::string& code, 
-                                 const std::string& entryDate, 
+void Articulo::ValidateParameters(const std::string_view code, 
+                                 const std::string_view entryDate, 
                                  const double unitCost) const {
     if (!IsValidCode(code)) {
-        throw std::invalid_argument("[Articulo] Código inválido: '" + code +
+        throw std::invalid_argument("[Articulo] Código inválido: '" + std::string(code) +
                                   "'. Debe tener entre " + std::to_string(Validation::MIN_CODE_LENGTH) +
                                   " y " + std::to_string(Validation::MAX_CODE_LENGTH) +
                                   " caracteres y solo contener alfanuméricos, guiones y guiones bajos.");
     }
     if (!IsValidDate(entryDate)) {
-        throw std::invalid_argument("[Articulo] Fecha inválida: '" + entryDate +
+        throw std::invalid_argument("[Articulo] Fecha inválida: '" + std::string(entryDate) +
                                   "'. Formato esperado: DD/MM/YYYY");
     }
     if (!IsValidCost(unitCost)) {
@@ -0,0 +1,101 @@
+/**
+ * @file columnas_articulos.cpp
+ * @brief Implementation of the structure-of-arrays article columns
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/columnas_articulos.hpp"
+#include "../include/equipo_medico.hpp"
+#include "../include/mobiliario_clinico.hpp"
+#include <algorithm>
+
+namespace {
+    // Campos que dependen del tipo concreto. La etiqueta de tipo garantiza el
+    // cast y, al ser clases final, CalculateTotalCost se resuelve estáticamente.
+    void leerCamposConcretos(const Articulo& articulo, const FechaCorte& corte, double& total,
+                             std::uint8_t& marca, std::uint8_t& area, std::uint32_t& tecnico) noexcept {
+        if (articulo.GetType() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
+            const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+            total = equipo.CalculateTotalCost(corte);
+            marca = static_cast<std::uint8_t>(equipo.getMarca());
+            area = static_cast<std::uint8_t>(equipo.getAreaUso());
+            tecnico = equipo.getTecnicoId();
+        } else {
+            const auto& mobiliario = static_cast<const MobiliarioClinico&>(articulo);
+            total = mobiliario.CalculateTotalCost(corte);
+            marca = ColumnasArticulos::SIN_VALOR;
+            area = static_cast<std::uint8_t>(mobiliario.getAreaUbicacion());
+            tecnico = TablaSimbolos::SIN_ID;
+        }
+    }
+}
+
+void ColumnasArticulos::agregar(const Articulo& articulo, const FechaCorte& corte) {
+    double total = 0.0;
+    std::uint8_t marcaArticulo = SIN_VALOR;
+    std::uint8_t areaArticulo = SIN_VALOR;
+    std::uint32_t tecnicoArticulo = TablaSimbolos::SIN_ID;
+    leerCamposConcretos(articulo, corte, total, marcaArticulo, areaArticulo, tecnicoArticulo);
+    // Todas las columnas crecen antes de escribir: una fila nunca queda a medias
+    const std::size_t filas = size();
+    const auto llena = [filas](const auto& columna) { return columna.capacity() == filas; };
+    if (llena(costoUnitario) || llena(costoTotal) || llena(estado) || llena(tipo) || llena(marca) ||
+        llena(area) || llena(tecnico) || llena(diaIngreso)) {
+        reservar(std::max<std::size_t>(16, 2 * filas));
+    }
+    costoUnitario.push_back(articulo.GetUnitCost());
+    costoTotal.push_back(total);
+    estado.push_back(static_cast<std::uint8_t>(articulo.GetStatus()));
+    tipo.push_back(static_cast<std::uint8_t>(articulo.GetType()));
+    marca.push_back(marcaArticulo);
+    area.push_back(areaArticulo);
+    tecnico.push_back(tecnicoArticulo);
+    diaIngreso.push_back(articulo.GetEntryDay());
+}
+
+void ColumnasArticulos::actualizar(const std::uint32_t slot, const Articulo& articulo,
+                                   const FechaCorte& corte) noexcept {
+    costoUnitario[slot] = articulo.GetUnitCost();
+    estado[slot] = static_cast<std::uint8_t>(articulo.GetStatus());
+    tipo[slot] = static_cast<std::uint8_t>(articulo.GetType());
+    diaIngreso[slot] = articulo.GetEntryDay();
+    leerCamposConcretos(articulo, corte, costoTotal[slot], marca[slot], area[slot], tecnico[slot]);
+}
+
+void ColumnasArticulos::quitar(const std::uint32_t slot) noexcept {
+    const auto mover = [slot](auto& columna) {
+        columna[slot] = columna.back();
+        columna.pop_back();
+    };
+    mover(costoUnitario);
+    mover(costoTotal);
+    mover(estado);
+    mover(tipo);
+    mover(marca);
+    mover(area);
+    mover(tecnico);
+    mover(diaIngreso);
+}
+
+void ColumnasArticulos::reservar(const std::size_t cantidad) {
+    costoUnitario.reserve(cantidad);
+    costoTotal.reserve(cantidad);
+    estado.reserve(cantidad);
+    tipo.reserve(cantidad);
+    marca.reserve(cantidad);
+    area.reserve(cantidad);
+    tecnico.reserve(cantidad);
+    diaIngreso.reserve(cantidad);
+}
+
+void ColumnasArticulos::limpiar() noexcept {
+    costoUnitario.clear();
+    costoTotal.clear();
+    estado.clear();
+    tipo.clear();
+    marca.clear();
+    area.clear();
+    tecnico.clear();
+    diaIngreso.clear();
+}
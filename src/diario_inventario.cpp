@@ -0,0 +1,425 @@
+/**
+ * @file diario_inventario.cpp
+ * @brief Implementation of the write-ahead journal
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/diario_inventario.hpp"
+#include "../include/equipo_medico.hpp"
+#include "../include/mobiliario_clinico.hpp"
+#include "../include/suma_verificacion.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+using MedicalInventory::Domain::ArticleChange;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    std::uint32_t sumaCorta(const void* datos, const std::size_t bytes) noexcept {
+        return static_cast<std::uint32_t>(sumaVerificacion(datos, bytes));
+    }
+
+    template <typename T>
+    void poner(std::string& destino, const T valor) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &valor, sizeof(T));
+        destino.append(bytes, sizeof(T));
+    }
+
+    void ponerTexto(std::string& destino, const std::string_view texto) {
+        poner(destino, static_cast<std::uint32_t>(texto.size()));
+        destino.append(texto);
+    }
+
+    // Lectura acotada del cuerpo de un registro
+    class Cursor {
+    public:
+        Cursor(const unsigned char* datos, const std::size_t bytes) : m_datos(datos), m_resto(bytes) {}
+
+        template <typename T>
+        bool leer(T& valor) noexcept {
+            if (m_resto < sizeof(T)) return false;
+            std::memcpy(&valor, m_datos, sizeof(T));
+            m_datos += sizeof(T);
+            m_resto -= sizeof(T);
+            return true;
+        }
+
+        bool leerTexto(std::string_view& texto) noexcept {
+            std::uint32_t longitud = 0;
+            if (!leer(longitud) || m_resto < longitud) return false;
+            texto = {reinterpret_cast<const char*>(m_datos), longitud};
+            m_datos += longitud;
+            m_resto -= longitud;
+            return true;
+        }
+
+        bool agotado() const noexcept { return m_resto == 0; }
+
+    private:
+        const unsigned char* m_datos;
+        std::size_t m_resto;
+    };
+
+    [[noreturn]] void corrupto(const std::string& ruta, const char* motivo) {
+        throw std::runtime_error("[DiarioInventario] Archivo '" + ruta + "' inválido: " + motivo);
+    }
+}
+
+LectorDiario::LectorDiario(const std::string& ruta) : m_archivo(ruta) {
+    if (m_archivo.size() < sizeof(CabeceraDiario)) corrupto(ruta, "truncado");
+    CabeceraDiario cabecera;
+    std::memcpy(&cabecera, m_archivo.datos(), sizeof cabecera);
+    if (std::memcmp(cabecera.firma, FormatoDiario::FIRMA, sizeof cabecera.firma) != 0) {
+        corrupto(ruta, "firma desconocida");
+    }
+    if (cabecera.marcaOrden != SnapshotInventario::MARCA_ORDEN) corrupto(ruta, "orden de bytes distinto");
+    if (cabecera.version != FormatoDiario::VERSION) corrupto(ruta, "versión no soportada");
+    if (cabecera.sumaCabecera != sumaCorta(&cabecera, offsetof(CabeceraDiario, sumaCabecera))) {
+        corrupto(ruta, "suma de verificación de la cabecera incorrecta");
+    }
+    m_generacion = cabecera.generacion;
+    m_posicion = sizeof(CabeceraDiario);
+}
+
+bool LectorDiario::siguiente(RegistroDiario& registro) noexcept {
+    const std::size_t resto = m_archivo.size() - m_posicion;
+    if (resto < sizeof(CabeceraRegistroDiario)) return false;
+    CabeceraRegistroDiario cabecera;
+    std::memcpy(&cabecera, m_archivo.datos() + m_posicion, sizeof cabecera);
+    if (cabecera.longitud == 0 || cabecera.longitud > FormatoDiario::MAX_CUERPO ||
+        cabecera.longitud > resto - sizeof cabecera) {
+        return false;
+    }
+    const unsigned char* cuerpo = m_archivo.datos() + m_posicion + sizeof cabecera;
+    if (sumaCorta(cuerpo, cabecera.longitud) != cabecera.suma) return false;
+
+    Cursor cursor(cuerpo, cabecera.longitud);
+    RegistroDiario leido;
+    std::uint8_t operacion = 0;
+    if (!cursor.leer(operacion) || !cursor.leer(leido.slot)) return false;
+    leido.operacion = static_cast<OperacionDiario>(operacion);
+    bool valido = false;
+    switch (leido.operacion) {
+        case OperacionDiario::ALTA:
+            valido = cursor.leer(leido.tipo) && cursor.leer(leido.estado) && cursor.leer(leido.marca) &&
+                     cursor.leer(leido.area) && cursor.leer(leido.vidaUtilAnios) &&
+                     cursor.leer(leido.costoUnitario) && cursor.leerTexto(leido.codigo) &&
+                     cursor.leerTexto(leido.fechaIngreso) && cursor.leerTexto(leido.texto);
+            break;
+        case OperacionDiario::ESTADO: valido = cursor.leer(leido.estado); break;
+        case OperacionDiario::COSTO: valido = cursor.leer(leido.costoUnitario); break;
+        case OperacionDiario::UBICACION: valido = cursor.leer(leido.area); break;
+        case OperacionDiario::VIDA_UTIL: valido = cursor.leer(leido.vidaUtilAnios); break;
+        case OperacionDiario::TECNICO:
+        case OperacionDiario::MATERIAL: valido = cursor.leerTexto(leido.texto); break;
+        case OperacionDiario::BAJA: valido = true; break;
+    }
+    if (!valido || !cursor.agotado()) return false;
+
+    registro = leido;
+    m_posicion += sizeof cabecera + cabecera.longitud;
+    return true;
+}
+
+DiarioInventario::DiarioInventario(std::string rutaSnapshot, const std::uint32_t generacion,
+                                   const std::uint64_t bytesValidos, const OpcionesDiario opciones)
+    : m_rutaSnapshot(std::move(rutaSnapshot)), m_opciones(opciones), m_generacion(generacion) {
+    if (bytesValidos < sizeof(CabeceraDiario)) {
+        crearDiario(generacion);
+    } else {
+        // Lo que sigue al último registro íntegro es un registro a medias
+        m_archivo = ArchivoSecuencial(rutaDiario(m_rutaSnapshot), ArchivoSecuencial::Modo::ANEXAR);
+        if (m_archivo.size() != bytesValidos) {
+            m_archivo.truncar(bytesValidos);
+            m_archivo.sincronizar();
+        }
+    }
+    m_escritor = std::thread(&DiarioInventario::escribirGrupos, this);
+}
+
+DiarioInventario::~DiarioInventario() {
+    if (m_compactador.joinable()) m_compactador.join();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cerrando = true;
+    }
+    m_hayTrabajo.notify_one();
+    m_escritor.join();
+}
+
+// Codifica el registro directamente al final del buffer pendiente
+template <typename Codificar>
+void DiarioInventario::anexar(Codificar&& codificar) noexcept {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::size_t inicio = m_pendiente.size();
+    try {
+        m_pendiente.resize(inicio + sizeof(CabeceraRegistroDiario));
+        codificar(m_pendiente);
+        CabeceraRegistroDiario cabecera;
+        cabecera.longitud = static_cast<std::uint32_t>(m_pendiente.size() - inicio - sizeof cabecera);
+        cabecera.suma = sumaCorta(m_pendiente.data() + inicio + sizeof cabecera, cabecera.longitud);
+        std::memcpy(&m_pendiente[inicio], &cabecera, sizeof cabecera);
+    } catch (...) {
+        m_pendiente.resize(inicio);
+        if (!m_error) m_error = std::current_exception();
+        return;
+    }
+    m_registrados += m_pendiente.size() - inicio;
+    if (inicio == 0) {
+        m_inicioGrupo = std::chrono::steady_clock::now();
+        m_hayTrabajo.notify_one();
+    } else if (inicio < m_opciones.bytesPorGrupo && m_pendiente.size() >= m_opciones.bytesPorGrupo) {
+        m_hayTrabajo.notify_one();
+    }
+}
+
+void DiarioInventario::registrarAlta(const Articulo& articulo, const std::uint32_t slot) noexcept {
+    anexar([&articulo, slot](std::string& destino) {
+        std::uint8_t marca = 0;
+        std::uint8_t area = 0;
+        std::int32_t vidaUtil = 0;
+        std::string_view texto;
+        if (articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+            const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+            marca = static_cast<std::uint8_t>(equipo.getMarca());
+            area = static_cast<std::uint8_t>(equipo.getAreaUso());
+            vidaUtil = equipo.getVidaUtilAnios();
+            texto = equipo.getTecnicoAsignado();
+        } else {
+            const auto& mobiliario = static_cast<const MobiliarioClinico&>(articulo);
+            area = static_cast<std::uint8_t>(mobiliario.getAreaUbicacion());
+            texto = mobiliario.getMaterial();
+        }
+        poner(destino, static_cast<std::uint8_t>(OperacionDiario::ALTA));
+        poner(destino, slot);
+        poner(destino, static_cast<std::uint8_t>(articulo.GetType()));
+        poner(destino, static_cast<std::uint8_t>(articulo.GetStatus()));
+        poner(destino, marca);
+        poner(destino, area);
+        poner(destino, vidaUtil);
+        poner(destino, articulo.GetUnitCost());
+        ponerTexto(destino, articulo.GetCode());
+        ponerTexto(destino, articulo.GetEntryDate());
+        ponerTexto(destino, texto);
+    });
+}
+
+void DiarioInventario::registrarCambio(const Articulo& articulo, const ArticleChange cambio) noexcept {
+    anexar([&articulo, cambio](std::string& destino) {
+        const bool esEquipo = articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT;
+        const auto cabecera = [&](const OperacionDiario operacion) {
+            poner(destino, static_cast<std::uint8_t>(operacion));
+            poner(destino, articulo.GetSlot());
+        };
+        switch (cambio) {
+            case ArticleChange::STATUS:
+                cabecera(OperacionDiario::ESTADO);
+                poner(destino, static_cast<std::uint8_t>(articulo.GetStatus()));
+                break;
+            case ArticleChange::COST:
+                cabecera(OperacionDiario::COSTO);
+                poner(destino, articulo.GetUnitCost());
+                break;
+            case ArticleChange::LOCATION:
+                cabecera(OperacionDiario::UBICACION);
+                poner(destino, esEquipo
+                    ? static_cast<std::uint8_t>(static_cast<const EquipoMedico&>(articulo).getAreaUso())
+                    : static_cast<std::uint8_t>(static_cast<const MobiliarioClinico&>(articulo).getAreaUbicacion()));
+                break;
+            case ArticleChange::USEFUL_LIFE:
+                cabecera(OperacionDiario::VIDA_UTIL);
+                poner(destino, static_cast<std::int32_t>(static_cast<const EquipoMedico&>(articulo).getVidaUtilAnios()));
+                break;
+            case ArticleChange::TECHNICIAN:
+                cabecera(OperacionDiario::TECNICO);
+                ponerTexto(destino, static_cast<const EquipoMedico&>(articulo).getTecnicoAsignado());
+                break;
+            case ArticleChange::MATERIAL:
+                cabecera(OperacionDiario::MATERIAL);
+                ponerTexto(destino, static_cast<const MobiliarioClinico&>(articulo).getMaterial());
+                break;
+        }
+    });
+}
+
+void DiarioInventario::registrarBaja(const std::uint32_t slot) noexcept {
+    anexar([slot](std::string& destino) {
+        poner(destino, static_cast<std::uint8_t>(OperacionDiario::BAJA));
+        poner(destino, slot);
+    });
+}
+
+// Hilo escritor: un write y un fsync por grupo de registros
+void DiarioInventario::escribirGrupos() noexcept {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_hayTrabajo.wait(lock, [this] { return m_cerrando || !m_pendiente.empty(); });
+        if (m_pendiente.empty()) return;
+        m_hayTrabajo.wait_until(lock, m_inicioGrupo + m_opciones.intervaloGrupo, [this] {
+            return m_cerrando || m_urgente || m_pendiente.size() >= m_opciones.bytesPorGrupo;
+        });
+
+        // El archivo se toma antes que el buffer (mismo orden que la
+        // compactación), así un grupo nunca acaba en el diario rotado
+        lock.unlock();
+        std::lock_guard<std::mutex> archivo(m_mutexArchivo);
+        lock.lock();
+        m_lote.swap(m_pendiente);
+        m_urgente = false;
+        const std::uint64_t objetivo = m_registrados;
+        // Tras un fallo no se escribe más: el diario tendría un hueco
+        const bool escribir = !m_error;
+        lock.unlock();
+
+        std::exception_ptr error;
+        if (escribir && !m_lote.empty()) {
+            try {
+                m_archivo.escribir(m_lote.data(), m_lote.size());
+                m_archivo.sincronizar();
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        m_lote.clear();
+
+        lock.lock();
+        if (error && !m_error) m_error = error;
+        if (!m_error) m_persistidos = objetivo;
+        m_persistido.notify_all();
+    }
+}
+
+void DiarioInventario::confirmar() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const std::uint64_t objetivo = m_registrados;
+    if (m_persistidos < objetivo && !m_error) {
+        m_urgente = true;
+        m_hayTrabajo.notify_one();
+        m_persistido.wait(lock, [this, objetivo] { return m_persistidos >= objetivo || m_error; });
+    }
+    if (m_error) std::rethrow_exception(m_error);
+}
+
+// Escribe y sincroniza lo pendiente sin pasar por el hilo escritor;
+// requiere m_mutexArchivo
+void DiarioInventario::vaciarPendiente() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_error) std::rethrow_exception(m_error);
+    if (!m_pendiente.empty()) {
+        m_archivo.escribir(m_pendiente.data(), m_pendiente.size());
+        m_pendiente.clear();
+    }
+    m_archivo.sincronizar();
+    m_persistidos = m_registrados;
+    m_persistido.notify_all();
+}
+
+// Crea el diario vacío de una generación (temporal + rename) y lo abre;
+// requiere m_mutexArchivo o que el hilo escritor no exista aún
+void DiarioInventario::crearDiario(const std::uint32_t generacion) {
+    CabeceraDiario cabecera{};
+    std::memcpy(cabecera.firma, FormatoDiario::FIRMA, sizeof cabecera.firma);
+    cabecera.version = FormatoDiario::VERSION;
+    cabecera.marcaOrden = SnapshotInventario::MARCA_ORDEN;
+    cabecera.generacion = generacion;
+    cabecera.sumaCabecera = sumaCorta(&cabecera, offsetof(CabeceraDiario, sumaCabecera));
+
+    const std::string ruta = rutaDiario(m_rutaSnapshot);
+    const std::string temporal = ruta + ".tmp";
+    {
+        ArchivoSecuencial archivo(temporal, ArchivoSecuencial::Modo::CREAR);
+        archivo.escribir(&cabecera, sizeof cabecera);
+        archivo.sincronizar();
+    }
+    m_archivo.cerrar();
+    std::error_code error;
+    std::filesystem::rename(temporal, ruta, error);
+    if (error) {
+        std::remove(temporal.c_str());
+        throw std::runtime_error("[DiarioInventario] No se pudo crear '" + ruta + "': " + error.message());
+    }
+    ArchivoSecuencial::sincronizarDirectorio(ruta);
+    m_archivo = ArchivoSecuencial(ruta, ArchivoSecuencial::Modo::ANEXAR);
+    m_generacion = generacion;
+}
+
+void DiarioInventario::compactar(EscritorSnapshot&& estado) {
+    if (m_compactador.joinable()) m_compactador.join();
+    // Un diario anterior que sigue ahí no está recogido en ningún snapshot:
+    // rotar de nuevo lo pisaría
+    const std::string anterior = rutaDiarioAnterior(m_rutaSnapshot);
+    if (m_errorCompactacion || std::filesystem::exists(anterior)) {
+        puntoDeControl(estado);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> archivo(m_mutexArchivo);
+        vaciarPendiente();
+        m_archivo.cerrar();
+        const std::string actual = rutaDiario(m_rutaSnapshot);
+        std::error_code error;
+        std::filesystem::rename(actual, anterior, error);
+        if (error) {
+            m_archivo = ArchivoSecuencial(actual, ArchivoSecuencial::Modo::ANEXAR);
+            throw std::runtime_error("[DiarioInventario] No se pudo rotar '" + actual + "': " + error.message());
+        }
+        try {
+            crearDiario(m_generacion + 1);
+        } catch (...) {
+            // Sin diario nuevo no se puede seguir anexando; la recuperación
+            // parte del diario rotado
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error) m_error = std::current_exception();
+            throw;
+        }
+    }
+
+    const std::uint32_t generacion = m_generacion;
+    m_compactador = std::thread([this, estado = std::move(estado), generacion, anterior]() noexcept {
+        try {
+            estado.escribir(m_rutaSnapshot, generacion);
+            std::remove(anterior.c_str());
+            ArchivoSecuencial::sincronizarDirectorio(anterior);
+        } catch (...) {
+            m_errorCompactacion = std::current_exception();
+        }
+    });
+}
+
+void DiarioInventario::esperarCompactacion() {
+    if (m_compactador.joinable()) m_compactador.join();
+    if (m_errorCompactacion) std::rethrow_exception(std::exchange(m_errorCompactacion, nullptr));
+}
+
+void DiarioInventario::puntoDeControl(const EscritorSnapshot& estado) {
+    if (m_compactador.joinable()) m_compactador.join();
+    std::lock_guard<std::mutex> archivo(m_mutexArchivo);
+    estado.escribir(m_rutaSnapshot, m_generacion + 1);
+    m_errorCompactacion = nullptr;
+    {
+        // El snapshot ya contiene todo lo registrado, incluso lo que no se
+        // llegó a escribir por un error anterior
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendiente.clear();
+        m_persistidos = m_registrados;
+        m_error = nullptr;
+        m_persistido.notify_all();
+    }
+    try {
+        crearDiario(m_generacion + 1);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = std::current_exception();
+        throw;
+    }
+    const std::string anterior = rutaDiarioAnterior(m_rutaSnapshot);
+    std::remove(anterior.c_str());
+    ArchivoSecuencial::sincronizarDirectorio(anterior);
+}
@@ -6,23 +6,23 @@
  */
 
 #include "../include/equipo_medico.hpp"
+#include "../include/codec_enums.hpp"
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <stdexcept>
-#include <chrono>
-#include <ctime>
 
-EquipoMedico::EquipoMedico(const std::string& codigo, const std::string& fechaIngreso,
+EquipoMedico::EquipoMedico(const std::string_view codigo, const std::string_view fechaIngreso,
                            const ArticleStatus estado, const double costoUnitario, const MarcaEquipo marca,
-                           const int vidaUtil, const std::string& tecnico, const AreaUso area)
+                           const int vidaUtil, const std::string_view tecnico, const AreaUso area)
     : Articulo(codigo, ArticleType::MEDICAL_EQUIPMENT, fechaIngreso, estado, costoUnitario),
-      marca(marca), vidaUtilAnios(vidaUtil), tecnicoAsignado(tecnico), areaUso(area) {
+      marca(marca), vidaUtilAnios(vidaUtil), tecnicoId(TablaSimbolos::SIN_ID), areaUso(area) {
     if (codigo.empty()) throw std::invalid_argument("[EquipoMedico] Código vacío.");
     if (fechaIngreso.empty()) throw std::invalid_argument("[EquipoMedico] Fecha de ingreso vacía.");
     if (costoUnitario < 0) throw std::invalid_argument("[EquipoMedico] Costo unitario negativo.");
     if (vidaUtil <= 0) throw std::invalid_argument("[EquipoMedico] Vida útil debe ser mayor a 0.");
     if (tecnico.empty()) throw std::invalid_argument("[EquipoMedico] Técnico asignado vacío.");
+    tecnicoId = TablaSimbolos::global().internar(tecnico);
 }
 
 std::string EquipoMedico::GetDetailedInfo() const {
@@ -30,14 +30,14 @@ std::string EquipoMedico::GetDetailedInfo() const {
     info << std::fixed << std::setprecision(2);
     info << "=== EQUIPO MÉDICO ===\n"
          << "Código: " << GetCode() << '\n'
-         << "Tipo: " << TypeToString(GetType()) << '\n'
+         << "Tipo: " << TypeName(GetType()) << '\n'
          << "Fecha de Ingreso: " << GetEntryDate() << '\n'
-         << "Estado: " << StatusToString(GetStatus()) << '\n'
+         << "Estado: " << StatusName(GetStatus()) << '\n'
          << "Costo Unitario: $" << GetUnitCost() << '\n'
-         << "Marca: " << marcaToString(marca) << '\n'
+         << "Marca: " << nombreMarca(marca) << '\n'
          << "Vida Útil: " << vidaUtilAnios << " años\n"
-         << "Técnico Asignado: " << tecnicoAsignado << '\n'
-         << "Área de Uso: " << areaToString(areaUso) << '\n'
+         << "Técnico Asignado: " << getTecnicoAsignado() << '\n'
+         << "Área de Uso: " << nombreArea(areaUso) << '\n'
          << "Depreciación: $" << calcularDepreciacion() << '\n';
     return info.str();
 }
@@ -49,7 +49,11 @@ std::string EquipoMedico::getInformacion() const {
 
 // Implementación del método CalculateTotalCost (nueva interfaz)
 double EquipoMedico::CalculateTotalCost() const {
-    return GetUnitCost() - calcularDepreciacion();
+    return CalculateTotalCost(FechaCorte::Hoy());
+}
+
+double EquipoMedico::CalculateTotalCost(const FechaCorte& corte) const {
+    return GetUnitCost() - calcularDepreciacion(corte);
 }
 
 // Implementación del método legacy para compatibilidad
@@ -59,33 +63,32 @@ double EquipoMedico::calcularCostoTotal() const {
 
 // Método para calcular la depreciación
 double EquipoMedico::calcularDepreciacion() const {
-    // Calcular años transcurridos desde la fecha de ingreso
-    double aniosTranscurridos = calcularAniosTranscurridos();
-    
+    return calcularDepreciacion(FechaCorte::Hoy());
+}
+
+double EquipoMedico::calcularDepreciacion(const FechaCorte& corte) const {
+    return depreciacion(GetUnitCost(), vidaUtilAnios, GetEntryDay(), corte);
+}
+
+// Lineal por años calendario transcurridos desde el ingreso
+double EquipoMedico::depreciacion(const double costoUnitario, const int vidaUtilAnios,
+                                  const std::int32_t diaIngreso, const FechaCorte& corte) noexcept {
     if (vidaUtilAnios <= 0) return 0.0;
     
-    double depreciacionAnual = GetUnitCost() / vidaUtilAnios;
-    return std::min(depreciacionAnual * aniosTranscurridos, GetUnitCost() * 0.8); // máximo 80% de depreciación
+    const double aniosTranscurridos = std::max(0.0, static_cast<double>(corte.anio - Fecha::anioDeDias(diaIngreso)));
+    const double depreciacionAnual = costoUnitario / vidaUtilAnios;
+    return std::min(depreciacionAnual * aniosTranscurridos, costoUnitario * 0.8); // máximo 80% de depreciación
 }
 
 // Método para calcular años transcurridos desde fecha de ingreso
 double EquipoMedico::calcularAniosTranscurridos() const {
-    try {
-        const std::string& fechaIngreso = GetEntryDate();
-        if (fechaIngreso.length() >= 10) {
-            const std::string anioStr = fechaIngreso.substr(6, 4);
-            const int anioIngreso = std::stoi(anioStr);
-            const auto now = std::chrono::system_clock::now();
-            const std::time_t t = std::chrono::system_clock::to_time_t(now);
-            const struct tm* ltm = std::localtime(&t);
-            const int anioActual = 1900 + ltm->tm_year;
-            const double diferencia = anioActual - anioIngreso;
-            return std::max(0.0, diferencia);
-        }
-    } catch (const std::exception&) {
-        // Si hay error en el parsing, usar valor por defecto
-    }
-    return 2.0;
+    return calcularAniosTranscurridos(FechaCorte::Hoy());
+}
+
+// Años calendario entre el ingreso (ya analizado en el constructor) y el corte
+double EquipoMedico::calcularAniosTranscurridos(const FechaCorte& corte) const {
+    const double diferencia = corte.anio - Fecha::anioDeDias(GetEntryDay());
+    return std::max(0.0, diferencia);
 }
 
 // Método para verificar si necesita mantenimiento
@@ -95,59 +98,41 @@ bool EquipoMedico::necesitaMantenimiento() const {
 
 // Funciones auxiliares estáticas
 std::string EquipoMedico::marcaToString(MarcaEquipo marca) {
-    switch (marca) {
-        case MarcaEquipo::PHILIPS:
-            return "Philips";
-        case MarcaEquipo::GE:
-            return "GE";
-        case MarcaEquipo::MINDRAY:
-            return "Mindray";
-        case MarcaEquipo::OTROS:
-            return "Otros";
-        default:
-            return "Desconocido";
-    }
+    return std::string(nombreMarca(marca));
 }
 
 std::string EquipoMedico::areaToString(AreaUso area) {
-    switch (area) {
-        case AreaUso::EMERGENCIA:
-            return "Emergencia";
-        case AreaUso::PEDIATRIA:
-            return "Pediatría";
-        case AreaUso::QUIROFANO:
-            return "Quirófano";
-        default:
-            return "Desconocido";
-    }
+    return std::string(nombreArea(area));
 }
 
-MarcaEquipo EquipoMedico::stringToMarca(const std::string& str) {
-    if (str == "Philips" || str == "PHILIPS") {
-        return MarcaEquipo::PHILIPS;
-    } else if (str == "GE") {
-        return MarcaEquipo::GE;
-    } else if (str == "Mindray" || str == "MINDRAY") {
-        return MarcaEquipo::MINDRAY;
-    } else {
-        return MarcaEquipo::OTROS;
-    }
+std::string_view EquipoMedico::nombreMarca(const MarcaEquipo marca) noexcept {
+    return CodecEnums::MARCA.nombre(marca);
 }
 
-AreaUso EquipoMedico::stringToArea(const std::string& str) {
-    if (str == "Emergencia" || str == "EMERGENCIA") {
-        return AreaUso::EMERGENCIA;
-    } else if (str == "Pediatría" || str == "PEDIATRIA") {
-        return AreaUso::PEDIATRIA;
-    } else if (str == "Quirófano" || str == "QUIROFANO") {
-        return AreaUso::QUIROFANO;
-    }
-    return AreaUso::EMERGENCIA; // valor por defecto
+std::string_view EquipoMedico::nombreArea(const AreaUso area) noexcept {
+    return CodecEnums::AREA_USO.nombre(area);
+}
+
+MarcaEquipo EquipoMedico::stringToMarca(const std::string_view str) {
+    MarcaEquipo marca = MarcaEquipo::OTROS; // marcas no registradas
+    CodecEnums::MARCA.parsear(str, marca);
+    return marca;
+}
+
+AreaUso EquipoMedico::stringToArea(const std::string_view str) {
+    AreaUso area = AreaUso::EMERGENCIA; // valor por defecto
+    CodecEnums::AREA_USO.parsear(str, area);
+    return area;
+}
+
+void EquipoMedico::setVidaUtilAnios(const int anios) {
+    if (anios <= 0) throw std::invalid_argument("[EquipoMedico] Vida útil debe ser mayor a 0.");
+    AssignAndNotify(vidaUtilAnios, anios, ArticleChange::USEFUL_LIFE);
 }
 
 void EquipoMedico::setTecnicoAsignado(const std::string& nuevoTecnico) {
     if (nuevoTecnico.empty()) {
         throw std::invalid_argument("[EquipoMedico] Técnico asignado vacío.");
     }
-    tecnicoAsignado = nuevoTecnico;
+    AssignAndNotify(tecnicoId, TablaSimbolos::global().internar(nuevoTecnico), ArticleChange::TECHNICIAN);
 }
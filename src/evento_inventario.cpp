@@ -0,0 +1,40 @@
+/**
+ * @file evento_inventario.cpp
+ * @brief Validation of inventory mutation events
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/evento_inventario.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    EventoInventario conCodigo(const std::string_view codigo) {
+        if (!Articulo::IsValidCode(codigo)) {
+            throw std::invalid_argument("[EventoInventario] Código inválido: '" + std::string(codigo) + "'");
+        }
+        EventoInventario evento;
+        evento.longitudCodigo = static_cast<std::uint8_t>(codigo.size());
+        std::copy(codigo.begin(), codigo.end(), evento.codigoArticulo);
+        return evento;
+    }
+}
+
+EventoInventario EventoInventario::cambioEstado(const std::string_view codigo, const EstadoArticulo estado) {
+    EventoInventario evento = conCodigo(codigo);
+    evento.tipo = Tipo::ESTADO;
+    evento.estado = estado;
+    return evento;
+}
+
+EventoInventario EventoInventario::cambioCosto(const std::string_view codigo, const double costo) {
+    if (!Articulo::IsValidCost(costo)) {
+        throw std::invalid_argument("[EventoInventario] Costo inválido: " + std::to_string(costo));
+    }
+    EventoInventario evento = conCodigo(codigo);
+    evento.tipo = Tipo::COSTO;
+    evento.costo = costo;
+    return evento;
+}
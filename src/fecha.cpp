@@ -0,0 +1,18 @@
+/**
+ * @file fecha.cpp
+ * @brief Clock access for compact dates
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/fecha.hpp"
+#include <chrono>
+#include <ctime>
+
+std::int32_t Fecha::hoy() {
+    const auto now = std::chrono::system_clock::now();
+    const std::time_t t = std::chrono::system_clock::to_time_t(now);
+    const struct tm* ltm = std::localtime(&t);
+    return diasDesdeCivil(1900 + ltm->tm_year, static_cast<unsigned>(ltm->tm_mon + 1),
+                          static_cast<unsigned>(ltm->tm_mday));
+}
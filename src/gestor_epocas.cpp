@@ -0,0 +1,60 @@
+/**
+ * @file gestor_epocas.cpp
+ * @brief Implementation of the epoch-based reclamation
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/gestor_epocas.hpp"
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+// Todas las operaciones atómicas son seq_cst: el escritor publica, retira y
+// luego revisa las ranuras; un lector que anuncia una época posterior a la
+// del retiro ya lee la estructura nueva
+GestorEpocas::Guarda& GestorEpocas::Guarda::operator=(Guarda&& otra) noexcept {
+    if (this != &otra) {
+        salir();
+        m_ranura = otra.m_ranura;
+        otra.m_ranura = nullptr;
+    }
+    return *this;
+}
+
+void GestorEpocas::Guarda::salir() noexcept {
+    if (m_ranura) m_ranura->store(0);
+    m_ranura = nullptr;
+}
+
+GestorEpocas::~GestorEpocas() {
+    for (const Retirado& retirado : m_retirados) retirado.liberar(retirado.objeto);
+}
+
+GestorEpocas::Guarda GestorEpocas::entrar() noexcept {
+    // Cada hilo empieza a buscar en una ranura distinta para no competir
+    const std::size_t inicio = std::hash<std::thread::id>{}(std::this_thread::get_id()) % MAX_LECTORES;
+    for (;;) {
+        for (std::size_t i = 0; i < MAX_LECTORES; ++i) {
+            std::atomic<std::uint64_t>& ranura = m_ranuras[(inicio + i) % MAX_LECTORES].epoca;
+            std::uint64_t libre = 0;
+            if (ranura.load() == 0 && ranura.compare_exchange_strong(libre, m_epoca.load())) {
+                return Guarda(&ranura);
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+void GestorEpocas::avanzar() noexcept {
+    // Lo retirado en la época que se cierra es invisible para quien anuncie la siguiente
+    std::uint64_t minima = m_epoca.fetch_add(1) + 1;
+    for (const Ranura& ranura : m_ranuras) {
+        const std::uint64_t epoca = ranura.epoca.load();
+        if (epoca != 0) minima = std::min(minima, epoca);
+    }
+    const auto vivos = std::partition(m_retirados.begin(), m_retirados.end(),
+                                      [minima](const Retirado& retirado) { return retirado.epoca >= minima; });
+    for (auto it = vivos; it != m_retirados.end(); ++it) it->liberar(it->objeto);
+    m_retirados.erase(vivos, m_retirados.end());
+}
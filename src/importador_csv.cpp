@@ -0,0 +1,434 @@
+/**
+ * @file importador_csv.cpp
+ * @brief Implementation of the streaming CSV importer
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/importador_csv.hpp"
+#include "../include/codec_enums.hpp"
+#include "../include/validacion.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <deque>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    enum Columna : std::size_t {
+        TIPO, CODIGO, FECHA, ESTADO, COSTO, AREA, MARCA, VIDA_UTIL, TECNICO, MATERIAL, CANTIDAD_COLUMNAS
+    };
+    constexpr std::array<std::string_view, CANTIDAD_COLUMNAS> NOMBRES_COLUMNAS = {
+        "tipo", "codigo", "fecha_ingreso", "estado", "costo_unitario", "area",
+        "marca", "vida_util", "tecnico", "material"
+    };
+    constexpr std::size_t COLUMNAS_OBLIGATORIAS = MARCA;  // Las anteriores a 'marca'
+    constexpr std::size_t SIN_COLUMNA = static_cast<std::size_t>(-1);
+
+    // Columna lógica -> posición del campo en cada fila
+    using MapaColumnas = std::array<std::size_t, CANTIDAD_COLUMNAS>;
+
+    struct FilaImportada {
+        std::size_t linea = 0;
+        std::string error;  ///< Vacío si la fila es válida
+        ArticleType tipo{};
+        ArticleStatus estado{};
+        std::uint8_t marca = 0;
+        std::uint8_t area = 0;
+        int vidaUtil = 0;
+        double costo = 0.0;
+        std::string_view codigo;
+        std::string_view fecha;
+        std::string_view texto;  ///< Técnico o material según el tipo
+    };
+
+    // Filas completas del archivo; los campos de las filas apuntan a 'texto'
+    // o, si llevaban comillas dobladas, a 'escapados'
+    struct Bloque {
+        std::string texto;
+        std::size_t primeraLinea = 0;
+        std::deque<std::string> escapados;
+        std::vector<FilaImportada> filas;
+
+        void vaciar() {
+            texto.clear();
+            escapados.clear();
+            filas.clear();
+        }
+    };
+
+    std::string_view recortar(std::string_view campo) noexcept {
+        while (!campo.empty() && (campo.front() == ' ' || campo.front() == '\t')) campo.remove_prefix(1);
+        while (!campo.empty() && (campo.back() == ' ' || campo.back() == '\t')) campo.remove_suffix(1);
+        return campo;
+    }
+
+    bool igualSinMayusculas(const std::string_view a, const std::string_view b) noexcept {
+        if (a.size() != b.size()) return false;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            const char x = (a[i] >= 'A' && a[i] <= 'Z') ? static_cast<char>(a[i] + 32) : a[i];
+            if (x != b[i]) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Divide una fila (sin salto de línea) en campos según RFC 4180.
+     * Devuelve un mensaje de error o nullptr.
+     */
+    const char* dividirFila(const std::string_view fila, const char separador,
+                            std::vector<std::string_view>& campos, std::deque<std::string>& escapados) {
+        campos.clear();
+        std::size_t i = 0;
+        while (true) {
+            if (i < fila.size() && fila[i] == '"') {
+                std::size_t j = i + 1;
+                bool dobladas = false;
+                while (j < fila.size()) {
+                    if (fila[j] == '"') {
+                        if (j + 1 < fila.size() && fila[j + 1] == '"') {
+                            dobladas = true;
+                            j += 2;
+                            continue;
+                        }
+                        break;
+                    }
+                    ++j;
+                }
+                if (j >= fila.size()) return "Comillas sin cerrar";
+                std::string_view contenido = fila.substr(i + 1, j - i - 1);
+                if (dobladas) {
+                    std::string limpio;
+                    limpio.reserve(contenido.size());
+                    for (std::size_t k = 0; k < contenido.size(); ++k) {
+                        limpio.push_back(contenido[k]);
+                        if (contenido[k] == '"') ++k;
+                    }
+                    escapados.push_back(std::move(limpio));
+                    contenido = escapados.back();
+                }
+                campos.push_back(contenido);
+                i = j + 1;
+                while (i < fila.size() && (fila[i] == ' ' || fila[i] == '\t')) ++i;
+                if (i == fila.size()) return nullptr;
+                if (fila[i] != separador) return "Texto después de un campo entre comillas";
+                ++i;
+                continue;
+            }
+            const std::size_t siguiente = fila.find(separador, i);
+            campos.push_back(recortar(fila.substr(i, siguiente == std::string_view::npos ? std::string_view::npos
+                                                                                        : siguiente - i)));
+            if (siguiente == std::string_view::npos) return nullptr;
+            i = siguiente + 1;
+        }
+    }
+
+    // Primera fila que termina dentro de 'texto', o npos; cuenta las comillas
+    // para no cortar dentro de un campo con saltos de línea
+    std::size_t finDeFila(const std::string_view texto, const std::size_t desde) noexcept {
+        bool entreComillas = false;
+        for (std::size_t i = desde; i < texto.size(); ++i) {
+            if (texto[i] == '"') entreComillas = !entreComillas;
+            else if (texto[i] == '\n' && !entreComillas) return i;
+        }
+        return std::string_view::npos;
+    }
+
+    // Posición tras el último salto de línea que cierra una fila, o 0
+    std::size_t ultimoCorte(const std::string_view texto) noexcept {
+        if (std::find(texto.begin(), texto.end(), '"') == texto.end()) {
+            const std::size_t salto = texto.rfind('\n');
+            return salto == std::string_view::npos ? 0 : salto + 1;
+        }
+        std::size_t corte = 0;
+        bool entreComillas = false;
+        for (std::size_t i = 0; i < texto.size(); ++i) {
+            if (texto[i] == '"') entreComillas = !entreComillas;
+            else if (texto[i] == '\n' && !entreComillas) corte = i + 1;
+        }
+        return corte;
+    }
+
+    template <typename Entero>
+    bool leerNumero(const std::string_view campo, Entero& valor) noexcept {
+        const auto [fin, error] = std::from_chars(campo.data(), campo.data() + campo.size(), valor);
+        return error == std::errc() && fin == campo.data() + campo.size() && !campo.empty();
+    }
+
+    std::string conValor(const char* motivo, const std::string_view valor) {
+        return std::string(motivo) + " '" + std::string(valor) + "'";
+    }
+
+    void validarFila(FilaImportada& fila, const std::vector<std::string_view>& campos, const MapaColumnas& columnas) {
+        const auto campo = [&](const Columna c) -> std::string_view {
+            const std::size_t indice = columnas[c];
+            return indice < campos.size() ? campos[indice] : std::string_view{};
+        };
+
+        if (!CodecEnums::TIPO.parsear(campo(TIPO), fila.tipo)) {
+            fila.error = conValor("Tipo de artículo inválido", campo(TIPO));
+            return;
+        }
+        fila.codigo = campo(CODIGO);
+        if (!Validacion::codigoValido(fila.codigo)) {
+            fila.error = conValor("Código inválido", fila.codigo);
+            return;
+        }
+        fila.fecha = campo(FECHA);
+        if (!Validacion::fechaValida(fila.fecha)) {
+            fila.error = conValor("Fecha inválida", fila.fecha);
+            return;
+        }
+        if (!CodecEnums::ESTADO.parsear(campo(ESTADO), fila.estado)) {
+            fila.error = conValor("Estado inválido", campo(ESTADO));
+            return;
+        }
+        if (!leerNumero(campo(COSTO), fila.costo) || !Articulo::IsValidCost(fila.costo)) {
+            fila.error = conValor("Costo unitario inválido", campo(COSTO));
+            return;
+        }
+
+        if (fila.tipo == ArticleType::MEDICAL_EQUIPMENT) {
+            AreaUso area{};
+            MarcaEquipo marca{};
+            if (!CodecEnums::AREA_USO.parsear(campo(AREA), area)) {
+                fila.error = conValor("Área de uso inválida", campo(AREA));
+                return;
+            }
+            if (!CodecEnums::MARCA.parsear(campo(MARCA), marca)) {
+                fila.error = conValor("Marca inválida", campo(MARCA));
+                return;
+            }
+            if (!leerNumero(campo(VIDA_UTIL), fila.vidaUtil) || fila.vidaUtil <= 0) {
+                fila.error = conValor("Vida útil inválida", campo(VIDA_UTIL));
+                return;
+            }
+            fila.texto = campo(TECNICO);
+            if (fila.texto.empty()) {
+                fila.error = "Técnico asignado vacío";
+                return;
+            }
+            fila.area = static_cast<std::uint8_t>(area);
+            fila.marca = static_cast<std::uint8_t>(marca);
+        } else {
+            AreaUbicacion area{};
+            if (!CodecEnums::AREA_UBICACION.parsear(campo(AREA), area)) {
+                fila.error = conValor("Área de ubicación inválida", campo(AREA));
+                return;
+            }
+            fila.texto = campo(MATERIAL);
+            if (fila.texto.empty()) {
+                fila.error = "Material vacío";
+                return;
+            }
+            fila.area = static_cast<std::uint8_t>(area);
+        }
+    }
+
+    // Trabajo de cada hilo: separar filas y campos y validarlos
+    void analizarBloque(Bloque& bloque, const MapaColumnas& columnas, const char separador) {
+        const std::string_view texto = bloque.texto;
+        std::vector<std::string_view> campos;
+        std::size_t linea = bloque.primeraLinea;
+        std::size_t inicio = 0;
+        while (inicio < texto.size()) {
+            std::size_t fin = finDeFila(texto, inicio);
+            if (fin == std::string_view::npos) fin = texto.size();
+            std::string_view contenido = texto.substr(inicio, fin - inicio);
+            const std::size_t lineaFila = linea;
+            linea += 1 + static_cast<std::size_t>(std::count(contenido.begin(), contenido.end(), '\n'));
+            inicio = fin + 1;
+            if (!contenido.empty() && contenido.back() == '\r') contenido.remove_suffix(1);
+            if (recortar(contenido).empty()) continue;
+
+            bloque.filas.emplace_back();
+            FilaImportada& fila = bloque.filas.back();
+            fila.linea = lineaFila;
+            if (const char* error = dividirFila(contenido, separador, campos, bloque.escapados)) {
+                fila.error = error;
+                continue;
+            }
+            validarFila(fila, campos, columnas);
+        }
+    }
+
+    MapaColumnas leerCabecera(std::string_view cabecera, const char separador) {
+        if (cabecera.size() >= 3 && cabecera.substr(0, 3) == "\xEF\xBB\xBF") cabecera.remove_prefix(3);
+        if (!cabecera.empty() && cabecera.back() == '\r') cabecera.remove_suffix(1);
+        std::vector<std::string_view> campos;
+        std::deque<std::string> escapados;
+        if (const char* error = dividirFila(cabecera, separador, campos, escapados)) {
+            throw std::runtime_error(std::string("[ImportadorCSV] Cabecera inválida: ") + error);
+        }
+        MapaColumnas columnas;
+        columnas.fill(SIN_COLUMNA);
+        for (std::size_t i = 0; i < campos.size(); ++i) {
+            for (std::size_t c = 0; c < CANTIDAD_COLUMNAS; ++c) {
+                if (igualSinMayusculas(recortar(campos[i]), NOMBRES_COLUMNAS[c])) columnas[c] = i;
+            }
+        }
+        for (std::size_t c = 0; c < COLUMNAS_OBLIGATORIAS; ++c) {
+            if (columnas[c] == SIN_COLUMNA) {
+                throw std::runtime_error("[ImportadorCSV] Falta la columna obligatoria '" +
+                                         std::string(NOMBRES_COLUMNAS[c]) + "'");
+            }
+        }
+        return columnas;
+    }
+
+    /**
+     * Lee la entrada en bloques que terminan en un fin de fila. La fila
+     * incompleta del final de cada lectura pasa al bloque siguiente.
+     */
+    class LectorBloques {
+    public:
+        LectorBloques(std::istream& entrada, const OpcionesImportacion& opciones)
+            : m_entrada(entrada), m_opciones(opciones) {}
+
+        std::string leerCabecera() {
+            while (true) {
+                const std::size_t fin = finDeFila(m_resto, 0);
+                if (fin != std::string::npos) {
+                    std::string cabecera = m_resto.substr(0, fin);
+                    m_resto.erase(0, fin + 1);
+                    m_linea = 2;
+                    return cabecera;
+                }
+                if (m_fin) {
+                    std::string cabecera = std::move(m_resto);
+                    m_resto.clear();
+                    m_linea = 2;
+                    return cabecera;
+                }
+                comprobarFila();
+                leer(m_resto);
+            }
+        }
+
+        bool siguiente(Bloque& bloque) {
+            bloque.vaciar();
+            bloque.texto.swap(m_resto);
+            while (true) {
+                if (m_fin) {
+                    if (bloque.texto.empty()) return false;
+                    break;
+                }
+                leer(bloque.texto);
+                const std::size_t corte = ultimoCorte(bloque.texto);
+                if (corte > 0) {
+                    m_resto.assign(bloque.texto, corte, std::string::npos);
+                    bloque.texto.resize(corte);
+                    break;
+                }
+                m_resto.swap(bloque.texto);
+                comprobarFila();
+                m_resto.swap(bloque.texto);
+            }
+            bloque.primeraLinea = m_linea;
+            m_linea += static_cast<std::size_t>(std::count(bloque.texto.begin(), bloque.texto.end(), '\n'));
+            return true;
+        }
+
+    private:
+        std::istream& m_entrada;
+        const OpcionesImportacion& m_opciones;
+        std::string m_resto;
+        std::size_t m_linea = 1;
+        bool m_fin = false;
+
+        void leer(std::string& destino) {
+            const std::size_t previo = destino.size();
+            destino.resize(previo + m_opciones.tamanoBloque);
+            m_entrada.read(&destino[previo], static_cast<std::streamsize>(m_opciones.tamanoBloque));
+            const auto leidos = static_cast<std::size_t>(m_entrada.gcount());
+            destino.resize(previo + leidos);
+            if (leidos < m_opciones.tamanoBloque) {
+                if (m_entrada.bad()) throw std::runtime_error("[ImportadorCSV] Error de lectura");
+                m_fin = true;
+            }
+        }
+
+        void comprobarFila() const {
+            if (m_resto.size() > m_opciones.maxTamanoFila) {
+                throw std::runtime_error("[ImportadorCSV] Fila de más de " +
+                                         std::to_string(m_opciones.maxTamanoFila) + " bytes cerca de la línea " +
+                                         std::to_string(m_linea));
+            }
+        }
+    };
+}
+
+ImportadorCSV::ImportadorCSV(Inventario& inventario, OpcionesImportacion opciones)
+    : m_inventario(inventario), m_opciones(opciones) {
+    if (m_opciones.tamanoBloque == 0) m_opciones.tamanoBloque = 1;
+    if (m_opciones.bloquesPorLote == 0) m_opciones.bloquesPorLote = 1;
+}
+
+ResultadoImportacion ImportadorCSV::importar(const std::string& ruta) {
+    std::ifstream archivo(ruta, std::ios::binary);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("[ImportadorCSV] No se pudo abrir '" + ruta + "'");
+    }
+    return importar(archivo);
+}
+
+ResultadoImportacion ImportadorCSV::importar(std::istream& entrada) {
+    ResultadoImportacion resultado;
+    LectorBloques lector(entrada, m_opciones);
+    const MapaColumnas columnas = leerCabecera(lector.leerCabecera(), m_opciones.separador);
+
+    const auto anotar = [this, &resultado](const std::size_t linea, std::string mensaje) {
+        if (resultado.errores.size() < m_opciones.maxErroresDetallados) {
+            resultado.errores.push_back({linea, std::move(mensaje)});
+        }
+    };
+
+    std::vector<Bloque> lote(m_opciones.bloquesPorLote);
+    while (true) {
+        std::size_t usados = 0;
+        while (usados < lote.size() && lector.siguiente(lote[usados])) ++usados;
+        if (usados == 0) break;
+
+        m_agregador.ejecutar(usados, [&](const std::size_t i) {
+            analizarBloque(lote[i], columnas, m_opciones.separador);
+        });
+
+        // Confirmación en orden de archivo: los duplicados se detectan igual
+        // que en una carga secuencial
+        for (std::size_t i = 0; i < usados; ++i) {
+            for (FilaImportada& fila : lote[i].filas) {
+                ++resultado.filasLeidas;
+                if (!fila.error.empty()) {
+                    ++resultado.rechazadas;
+                    anotar(fila.linea, std::move(fila.error));
+                    continue;
+                }
+                if (m_inventario.existeCodigo(fila.codigo)) {
+                    ++resultado.duplicadas;
+                    anotar(fila.linea, conValor("Código duplicado", fila.codigo));
+                    continue;
+                }
+                try {
+                    if (fila.tipo == ArticleType::MEDICAL_EQUIPMENT) {
+                        m_inventario.agregarArticulo(EquipoMedico(fila.codigo, fila.fecha, fila.estado, fila.costo,
+                                                                  static_cast<MarcaEquipo>(fila.marca), fila.vidaUtil,
+                                                                  fila.texto, static_cast<AreaUso>(fila.area)));
+                    } else {
+                        m_inventario.agregarArticulo(MobiliarioClinico(fila.codigo, fila.fecha, fila.estado, fila.costo,
+                                                                       fila.texto, static_cast<AreaUbicacion>(fila.area)));
+                    }
+                    ++resultado.importadas;
+                } catch (const std::invalid_argument& e) {
+                    ++resultado.rechazadas;
+                    anotar(fila.linea, e.what());
+                }
+            }
+        }
+    }
+    return resultado;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file indice_bitmaps.cpp
+ * @brief Maintenance of the per-value slot bitmaps
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/indice_bitmaps.hpp"
+
+MapaBits& IndiceBitmaps::mapaArea(const std::uint8_t tipo, const std::uint8_t area) noexcept {
+    if (tipo == static_cast<std::uint8_t>(TipoArticulo::MEDICAL_EQUIPMENT)) return m_areaUso[area];
+    return m_areaUbicacion[area];
+}
+
+IndiceBitmaps::MapasFila IndiceBitmaps::mapasDe(const ColumnasArticulos& columnas, const std::uint32_t fila) noexcept {
+    MapaBits* marca = nullptr;
+    if (columnas.marca[fila] != ColumnasArticulos::SIN_VALOR) marca = &m_marca[columnas.marca[fila]];
+    return {&m_estado[columnas.estado[fila]], &m_tipo[columnas.tipo[fila]], marca,
+            &mapaArea(columnas.tipo[fila], columnas.area[fila])};
+}
+
+// Si un alta falla se quitan las anteriores, que no fallan
+void IndiceBitmaps::agregar(const ColumnasArticulos& columnas, const std::uint32_t slot) {
+    const MapasFila mapas = mapasDe(columnas, slot);
+    std::size_t hechos = 0;
+    try {
+        for (; hechos < mapas.size(); ++hechos) {
+            if (mapas[hechos] != nullptr) mapas[hechos]->agregar(slot);
+        }
+    } catch (...) {
+        while (hechos-- > 0) {
+            if (mapas[hechos] != nullptr) mapas[hechos]->quitar(slot);
+        }
+        throw;
+    }
+}
+
+void IndiceBitmaps::quitar(const ColumnasArticulos& columnas, const std::uint32_t slot) noexcept {
+    for (MapaBits* mapa : mapasDe(columnas, slot)) {
+        if (mapa != nullptr) mapa->quitar(slot);
+    }
+}
+
+// Donde los mapas coinciden el slot ya está; en el resto se agrega
+// primero y las bajas, que no fallan, van al final
+void IndiceBitmaps::cambiarMapas(const MapasFila& anteriores, const MapasFila& nuevos, const std::uint32_t slot) {
+    std::size_t hechos = 0;
+    try {
+        for (; hechos < nuevos.size(); ++hechos) {
+            if (nuevos[hechos] != nullptr && nuevos[hechos] != anteriores[hechos]) nuevos[hechos]->agregar(slot);
+        }
+    } catch (...) {
+        while (hechos-- > 0) {
+            if (nuevos[hechos] != nullptr && nuevos[hechos] != anteriores[hechos]) nuevos[hechos]->quitar(slot);
+        }
+        throw;
+    }
+    for (std::size_t i = 0; i < nuevos.size(); ++i) {
+        if (anteriores[i] != nullptr && anteriores[i] != nuevos[i]) anteriores[i]->quitar(slot);
+    }
+}
+
+void IndiceBitmaps::reemplazar(const ColumnasArticulos& columnas, const std::uint32_t slot,
+                               const std::uint32_t ultimo) {
+    const MapasFila nuevos = mapasDe(columnas, ultimo);
+    cambiarMapas(mapasDe(columnas, slot), nuevos, slot);
+    for (MapaBits* mapa : nuevos) {
+        if (mapa != nullptr) mapa->quitar(ultimo);
+    }
+}
+
+// El tipo y la marca de un artículo no cambian: solo el estado y el área
+void IndiceBitmaps::actualizar(const ColumnasArticulos& columnas, const std::uint32_t slot,
+                               const std::uint8_t estadoAnterior, const std::uint8_t areaAnterior) {
+    const MapasFila nuevos = mapasDe(columnas, slot);
+    MapasFila anteriores = nuevos;
+    anteriores[0] = &m_estado[estadoAnterior];
+    anteriores[3] = &mapaArea(columnas.tipo[slot], areaAnterior);
+    cambiarMapas(anteriores, nuevos, slot);
+}
+
+void IndiceBitmaps::limpiar() noexcept {
+    for (MapaBits& mapa : m_estado) mapa.limpiar();
+    for (MapaBits& mapa : m_tipo) mapa.limpiar();
+    for (MapaBits& mapa : m_marca) mapa.limpiar();
+    for (MapaBits& mapa : m_areaUso) mapa.limpiar();
+    for (MapaBits& mapa : m_areaUbicacion) mapa.limpiar();
+}
@@ -0,0 +1,81 @@
+/**
+ * @file indice_codigos.cpp
+ * @brief Implementation of the article code hash index
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/indice_codigos.hpp"
+
+std::uint32_t IndiceCodigos::hashCodigo(const std::string_view codigo) noexcept {
+    std::uint32_t hash = 2166136261u;
+    for (const char c : codigo) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void IndiceCodigos::insertar(const std::string_view codigo, const std::uint32_t slot) {
+    // Mantener el factor de carga por debajo de 1/2 para sondeos cortos
+    if ((m_cantidad + 1) * 2 > m_tabla.size()) {
+        redimensionar(m_tabla.empty() ? CAPACIDAD_MINIMA : m_tabla.size() * 2);
+    }
+    colocar({hashCodigo(codigo), slot});
+    ++m_cantidad;
+}
+
+void IndiceCodigos::eliminar(const std::string_view codigo, const std::uint32_t slot) noexcept {
+    const std::size_t mascara = m_tabla.size() - 1;
+    std::size_t hueco = posicion(hashCodigo(codigo), slot);
+    // Borrado con desplazamiento: sube cada entrada posterior del sondeo
+    // cuya posición ideal no quede entre el hueco y ella
+    for (std::size_t i = (hueco + 1) & mascara; m_tabla[i].slot != SIN_SLOT; i = (i + 1) & mascara) {
+        const std::size_t ideal = m_tabla[i].hash & mascara;
+        if (((i - ideal) & mascara) >= ((i - hueco) & mascara)) {
+            m_tabla[hueco] = m_tabla[i];
+            hueco = i;
+        }
+    }
+    m_tabla[hueco] = Entrada{0, SIN_SLOT};
+    --m_cantidad;
+}
+
+void IndiceCodigos::reubicar(const std::string_view codigo, const std::uint32_t anterior,
+                             const std::uint32_t nuevo) noexcept {
+    m_tabla[posicion(hashCodigo(codigo), anterior)].slot = nuevo;
+}
+
+void IndiceCodigos::reservar(const std::size_t cantidad) {
+    std::size_t capacidad = m_tabla.empty() ? CAPACIDAD_MINIMA : m_tabla.size();
+    while (capacidad < cantidad * 2) capacidad *= 2;
+    if (capacidad > m_tabla.size()) redimensionar(capacidad);
+}
+
+void IndiceCodigos::limpiar() noexcept {
+    m_tabla.clear();
+    m_cantidad = 0;
+}
+
+void IndiceCodigos::redimensionar(const std::size_t capacidad) {
+    std::vector<Entrada> anterior(capacidad, Entrada{0, SIN_SLOT});
+    anterior.swap(m_tabla);
+    for (const Entrada& entrada : anterior) {
+        if (entrada.slot != SIN_SLOT) colocar(entrada);
+    }
+}
+
+// Entrada de un código presente: el par (hash, slot) la identifica
+std::size_t IndiceCodigos::posicion(const std::uint32_t hash, const std::uint32_t slot) const noexcept {
+    const std::size_t mascara = m_tabla.size() - 1;
+    std::size_t i = hash & mascara;
+    while (m_tabla[i].slot != slot || m_tabla[i].hash != hash) i = (i + 1) & mascara;
+    return i;
+}
+
+void IndiceCodigos::colocar(const Entrada entrada) noexcept {
+    const std::size_t mascara = m_tabla.size() - 1;
+    std::size_t i = entrada.hash & mascara;
+    while (m_tabla[i].slot != SIN_SLOT) i = (i + 1) & mascara;
+    m_tabla[i] = entrada;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file indice_ordenado.cpp
+ * @brief Leaf blocks and rank tree of the ordered slot index
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/indice_ordenado.hpp"
+#include <algorithm>
+#include <limits>
+#include <new>
+
+// Primera entrada que no va antes de la clave (fin: bloque == m_bloques.size())
+IndiceOrdenado::Posicion IndiceOrdenado::buscar(const Entrada& clave) const noexcept {
+    const auto ultimo = std::lower_bound(m_ultimos.begin(), m_ultimos.end(), clave, antes);
+    const auto bloque = static_cast<std::size_t>(ultimo - m_ultimos.begin());
+    if (bloque == m_bloques.size()) return {bloque, 0};
+    const std::vector<Entrada>& entradas = m_bloques[bloque];
+    const auto indice = std::lower_bound(entradas.begin(), entradas.end(), clave, antes) - entradas.begin();
+    return {bloque, static_cast<std::size_t>(indice)};
+}
+
+// Cantidad de entradas que van antes de la clave
+std::size_t IndiceOrdenado::rango(const Entrada& clave) const noexcept {
+    const Posicion posicion = buscar(clave);
+    if (posicion.bloque == m_bloques.size()) return m_cantidad;
+    return prefijo(posicion.bloque) + posicion.indice;
+}
+
+// Suma de los tamaños de los bloques [0, bloque)
+std::size_t IndiceOrdenado::prefijo(std::size_t bloque) const noexcept {
+    std::size_t suma = 0;
+    for (; bloque > 0; bloque &= bloque - 1) suma += m_arbol[bloque];
+    return suma;
+}
+
+void IndiceOrdenado::sumarEnArbol(const std::size_t bloque, const bool suma) noexcept {
+    for (std::size_t i = bloque + 1; i < m_arbol.size(); i += i & (~i + 1)) {
+        if (suma) ++m_arbol[i];
+        else --m_arbol[i];
+    }
+}
+
+// Solo cuando cambia el número de bloques: O(bloques). No reserva memoria
+// si m_arbol ya tiene capacidad para un nodo por bloque
+void IndiceOrdenado::rehacerArbol() {
+    m_arbol.assign(m_bloques.size() + 1, 0);
+    for (std::size_t i = 1; i < m_arbol.size(); ++i) {
+        m_arbol[i] += m_bloques[i - 1].size();
+        const std::size_t padre = i + (i & (~i + 1));
+        if (padre < m_arbol.size()) m_arbol[padre] += m_arbol[i];
+    }
+}
+
+// Todo lo que reserva memoria va antes del primer cambio: si algo falla
+// el índice queda como estaba
+void IndiceOrdenado::dividir(const std::size_t bloque) {
+    // Reservar m_bloques mueve los bloques: las referencias se toman después
+    m_ultimos.reserve(m_ultimos.size() + 1);
+    m_bloques.reserve(m_bloques.size() + 1);
+    m_arbol.reserve(m_bloques.size() + 2);
+    std::vector<Entrada>& entradas = m_bloques[bloque];
+    const auto mitad = entradas.begin() + static_cast<std::ptrdiff_t>(entradas.size() / 2);
+    std::vector<Entrada> derecha(mitad, entradas.end());
+    entradas.erase(mitad, entradas.end());
+    m_ultimos[bloque] = entradas.back();
+    m_ultimos.insert(m_ultimos.begin() + static_cast<std::ptrdiff_t>(bloque) + 1, derecha.back());
+    m_bloques.insert(m_bloques.begin() + static_cast<std::ptrdiff_t>(bloque) + 1, std::move(derecha));
+    rehacerArbol();
+}
+
+// Une el bloque siguiente al indicado; sin memoria para ello devuelve
+// false y no cambia nada (un bloque casi vacío sigue siendo válido)
+bool IndiceOrdenado::fusionar(const std::size_t bloque) noexcept {
+    std::vector<Entrada>& entradas = m_bloques[bloque];
+    const std::vector<Entrada>& siguiente = m_bloques[bloque + 1];
+    try {
+        entradas.reserve(entradas.size() + siguiente.size());
+    } catch (const std::bad_alloc&) {
+        return false;
+    }
+    entradas.insert(entradas.end(), siguiente.begin(), siguiente.end());
+    m_ultimos[bloque] = entradas.back();
+    m_ultimos.erase(m_ultimos.begin() + static_cast<std::ptrdiff_t>(bloque) + 1);
+    m_bloques.erase(m_bloques.begin() + static_cast<std::ptrdiff_t>(bloque) + 1);
+    rehacerArbol();
+    return true;
+}
+
+void IndiceOrdenado::agregar(const double valor, const std::uint32_t slot) {
+    const Entrada entrada{valor, slot};
+    if (m_bloques.empty()) {
+        m_ultimos.reserve(1);
+        m_arbol.reserve(2);
+        m_bloques.emplace_back(1, entrada);
+        m_ultimos.push_back(entrada);
+        rehacerArbol();
+        m_cantidad = 1;
+        return;
+    }
+    // Por encima del máximo va al último bloque
+    std::size_t bloque = static_cast<std::size_t>(
+        std::lower_bound(m_ultimos.begin(), m_ultimos.end(), entrada, antes) - m_ultimos.begin());
+    if (bloque == m_bloques.size()) --bloque;
+    std::vector<Entrada>& entradas = m_bloques[bloque];
+    const auto insertada = entradas.insert(std::lower_bound(entradas.begin(), entradas.end(), entrada, antes), entrada);
+    if (entradas.size() > 2 * TAMANO_BLOQUE) {
+        try {
+            dividir(bloque);
+        } catch (...) {
+            m_bloques[bloque].erase(insertada);  // mover un bloque no invalida sus iteradores
+            throw;
+        }
+    } else {
+        m_ultimos[bloque] = entradas.back();
+        sumarEnArbol(bloque, true);
+    }
+    ++m_cantidad;
+}
+
+void IndiceOrdenado::quitar(const double valor, const std::uint32_t slot) noexcept {
+    const Posicion posicion = buscar({valor, slot});
+    if (posicion.bloque == m_bloques.size()) return;
+    std::vector<Entrada>& entradas = m_bloques[posicion.bloque];
+    if (entradas[posicion.indice].valor != valor || entradas[posicion.indice].slot != slot) return;
+    entradas.erase(entradas.begin() + static_cast<std::ptrdiff_t>(posicion.indice));
+    --m_cantidad;
+    if (m_bloques.size() == 1) {
+        if (entradas.empty()) {
+            limpiar();
+        } else {
+            m_ultimos[0] = entradas.back();
+            sumarEnArbol(0, false);
+        }
+        return;
+    }
+    // Un bloque casi vacío se une a un vecino si caben juntos
+    if (entradas.size() < TAMANO_BLOQUE / 4) {
+        const std::size_t izquierdo = (posicion.bloque > 0) ? posicion.bloque - 1 : 0;
+        if (m_bloques[izquierdo].size() + m_bloques[izquierdo + 1].size() <= 2 * TAMANO_BLOQUE &&
+            fusionar(izquierdo)) {
+            return;
+        }
+    }
+    // Solo si no se pudo fusionar: quitar un bloque no reserva memoria
+    if (entradas.empty()) {
+        m_ultimos.erase(m_ultimos.begin() + static_cast<std::ptrdiff_t>(posicion.bloque));
+        m_bloques.erase(m_bloques.begin() + static_cast<std::ptrdiff_t>(posicion.bloque));
+        rehacerArbol();
+        return;
+    }
+    m_ultimos[posicion.bloque] = entradas.back();
+    sumarEnArbol(posicion.bloque, false);
+}
+
+void IndiceOrdenado::reconstruir(std::vector<Entrada>&& entradas) {
+    std::sort(entradas.begin(), entradas.end(), antes);
+
+    // Bloques a medio llenar: las altas siguientes no los dividen enseguida
+    m_bloques.clear();
+    m_ultimos.clear();
+    for (std::size_t desde = 0; desde < entradas.size(); desde += TAMANO_BLOQUE) {
+        const std::size_t hasta = std::min(entradas.size(), desde + TAMANO_BLOQUE);
+        m_bloques.emplace_back(entradas.begin() + static_cast<std::ptrdiff_t>(desde),
+                               entradas.begin() + static_cast<std::ptrdiff_t>(hasta));
+        m_ultimos.push_back(entradas[hasta - 1]);
+    }
+    m_cantidad = entradas.size();
+    rehacerArbol();
+}
+
+void IndiceOrdenado::limpiar() noexcept {
+    m_bloques.clear();
+    m_ultimos.clear();
+    m_arbol.clear();
+    m_cantidad = 0;
+}
+
+// Descenso por el árbol de Fenwick hasta el bloque que contiene la posición
+const IndiceOrdenado::Entrada& IndiceOrdenado::enPosicion(std::size_t posicion) const {
+    std::size_t bloque = 0;
+    std::size_t paso = 1;
+    while (paso * 2 < m_arbol.size()) paso *= 2;
+    for (; paso > 0; paso /= 2) {
+        if (bloque + paso < m_arbol.size() && m_arbol[bloque + paso] <= posicion) {
+            bloque += paso;
+            posicion -= m_arbol[bloque];
+        }
+    }
+    return m_bloques[bloque][posicion];
+}
+
+const IndiceOrdenado::Entrada& IndiceOrdenado::maximo() const {
+    const Posicion posicion = buscar({m_ultimos.back().valor, 0});
+    return m_bloques[posicion.bloque][posicion.indice];
+}
+
+std::size_t IndiceOrdenado::contarEntre(const double minimo, const double maximo) const {
+    if (!(minimo <= maximo)) return 0;
+    // Ningún slot vale el máximo de uint32: la clave queda tras todos los 'maximo'
+    return rango({maximo, std::numeric_limits<std::uint32_t>::max()}) - rango({minimo, 0});
+}
@@ -1,61 +1,395 @@
 #include "../include/inventario.hpp"
+#include "../include/snapshot_inventario.hpp"
+#include "../include/archivo_columnar.hpp"
+#include "../include/codec_enums.hpp"
 #include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <limits>
-#include <fstream>
-#include <sstream>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
 
-// Agrega un nuevo artículo al inventario si el código no existe
+using MedicalInventory::Domain::ArticleChange;
+
+Inventario::Inventario(Inventario&& otro) noexcept
+    : equipos(std::move(otro.equipos)),
+      mobiliarios(std::move(otro.mobiliarios)),
+      articulos(std::move(otro.articulos)),
+      indiceCodigos(std::move(otro.indiceCodigos)),
+      columnas(std::move(otro.columnas)),
+      bitmaps(std::move(otro.bitmaps)),
+      ordenUnitario(std::move(otro.ordenUnitario)),
+      ordenTotal(std::move(otro.ordenTotal)),
+      ordenIngreso(std::move(otro.ordenIngreso)),
+      contadores(otro.contadores),
+      rankingTecnicos(std::move(otro.rankingTecnicos)),
+      fechaCorte(otro.fechaCorte),
+      agregador(otro.agregador),
+      diario(std::move(otro.diario)),
+      cambios(std::move(otro.cambios)),
+      reubicados(std::move(otro.reubicados)),
+      archivoBase(std::move(otro.archivoBase)),
+      sumaBase(otro.sumaBase) {
+    reenlazarArticulos();
+}
+
+Inventario& Inventario::operator=(Inventario&& otro) noexcept {
+    if (this != &otro) {
+        equipos = std::move(otro.equipos);
+        mobiliarios = std::move(otro.mobiliarios);
+        articulos = std::move(otro.articulos);
+        indiceCodigos = std::move(otro.indiceCodigos);
+        columnas = std::move(otro.columnas);
+        bitmaps = std::move(otro.bitmaps);
+        ordenUnitario = std::move(otro.ordenUnitario);
+        ordenTotal = std::move(otro.ordenTotal);
+        ordenIngreso = std::move(otro.ordenIngreso);
+        contadores = otro.contadores;
+        rankingTecnicos = std::move(otro.rankingTecnicos);
+        fechaCorte = otro.fechaCorte;
+        agregador = otro.agregador;
+        diario = std::move(otro.diario);
+        cambios = std::move(otro.cambios);
+        reubicados = std::move(otro.reubicados);
+        archivoBase = std::move(otro.archivoBase);
+        sumaBase = otro.sumaBase;
+        reenlazarArticulos();
+    }
+    return *this;
+}
+
+void Inventario::reenlazarArticulos() noexcept {
+    for (size_t slot = 0; slot < articulos.size(); ++slot) {
+        articulos[slot]->AttachObserver(this, static_cast<std::uint32_t>(slot));
+    }
+}
+
+// Agrega un nuevo artículo al inventario si el código no existe.
+// El objeto se traslada al contenedor de su tipo concreto.
 void Inventario::agregarArticulo(std::unique_ptr<Articulo> articulo) {
-    if (articulo && !existeCodigo(articulo->getCodigo())) {
-        articulos.push_back(std::move(articulo));
+    if (!articulo) return;
+    if (articulo->GetType() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
+        agregarArticulo(std::move(static_cast<EquipoMedico&>(*articulo)));
+    } else {
+        agregarArticulo(std::move(static_cast<MobiliarioClinico&>(*articulo)));
+    }
+}
+
+void Inventario::agregarArticulo(EquipoMedico&& equipo) {
+    if (existeCodigo(equipo.GetCode())) return;
+    EquipoMedico& almacenado = equipos.crear(std::move(equipo));
+    try {
+        registrarArticulo(almacenado);
+    } catch (...) {
+        equipos.destruir(almacenado);
+        throw;
+    }
+}
+
+void Inventario::agregarArticulo(MobiliarioClinico&& mobiliario) {
+    if (existeCodigo(mobiliario.GetCode())) return;
+    MobiliarioClinico& almacenado = mobiliarios.crear(std::move(mobiliario));
+    try {
+        registrarArticulo(almacenado);
+    } catch (...) {
+        mobiliarios.destruir(almacenado);
+        throw;
+    }
+}
+
+// Asigna slot al artículo ya almacenado y lo da de alta en índices y columnas.
+// Si un paso falla se deshacen los anteriores en orden inverso y el
+// inventario queda como estaba; los pasos que no fallan van al final
+void Inventario::registrarArticulo(Articulo& articulo) {
+    const auto slot = static_cast<std::uint32_t>(articulos.size());
+    // Solo reservan memoria: no hace falta deshacerlos
+    if (articulos.size() == articulos.capacity()) articulos.reserve(std::max<size_t>(16, 2 * articulos.size()));
+    cambios.agregarSlot(slot, false);
+    reubicados.agregarSlot(slot, false);
+
+    indiceCodigos.insertar(articulo.GetCode(), slot);
+    try {
+        columnas.agregar(articulo, fechaCorte);
+        try {
+            bitmaps.agregar(columnas, slot);
+            if (!indicesDiferidos) {
+                ordenUnitario.agregar(columnas.costoUnitario[slot], slot);
+                ordenTotal.agregar(columnas.costoTotal[slot], slot);
+                ordenIngreso.agregar(columnas.diaIngreso[slot], slot);
+            }
+            // Un técnico registrado sin equipos no aparece en el ranking
+            if (columnas.tecnico[slot] != TablaSimbolos::SIN_ID) rankingTecnicos.registrar(columnas.tecnico[slot]);
+        } catch (...) {
+            // Quitar lo que no llegó a agregarse no hace nada
+            ordenIngreso.quitar(columnas.diaIngreso[slot], slot);
+            ordenTotal.quitar(columnas.costoTotal[slot], slot);
+            ordenUnitario.quitar(columnas.costoUnitario[slot], slot);
+            bitmaps.quitar(columnas, slot);
+            columnas.quitar(slot);
+            throw;
+        }
+    } catch (...) {
+        indiceCodigos.eliminar(articulo.GetCode(), slot);
+        throw;
+    }
+
+    cambios.marcar(slot);
+    contadores.agregar(columnas.tipo[slot], columnas.estado[slot], columnas.costoTotal[slot]);
+    if (columnas.tecnico[slot] != TablaSimbolos::SIN_ID) rankingTecnicos.incrementar(columnas.tecnico[slot]);
+    articulo.AttachObserver(this, slot);
+    articulos.push_back(&articulo);
+    if (diario) diario->registrarAlta(articulo, slot);
+}
+
+// Da de baja el artículo de un slot; el último pasa a ocupar su lugar.
+// Como en registrarArticulo, lo que puede fallar va primero: el último se
+// da de alta con su nuevo slot en los índices ordenados y los bitmaps, y
+// si algo falla se deshace y el inventario queda como estaba. Después solo
+// quedan bajas que no fallan, y el artículo se destruye al final
+void Inventario::quitarSlot(const std::uint32_t slot) {
+    const auto ultimo = static_cast<std::uint32_t>(articulos.size() - 1);
+    if (slot != ultimo) {
+        int hechos = 0;
+        try {
+            if (!indicesDiferidos) {
+                ordenUnitario.agregar(columnas.costoUnitario[ultimo], slot);
+                ++hechos;
+                ordenTotal.agregar(columnas.costoTotal[ultimo], slot);
+                ++hechos;
+                ordenIngreso.agregar(columnas.diaIngreso[ultimo], slot);
+                ++hechos;
+            }
+            bitmaps.reemplazar(columnas, slot, ultimo);
+        } catch (...) {
+            if (hechos > 2) ordenIngreso.quitar(columnas.diaIngreso[ultimo], slot);
+            if (hechos > 1) ordenTotal.quitar(columnas.costoTotal[ultimo], slot);
+            if (hechos > 0) ordenUnitario.quitar(columnas.costoUnitario[ultimo], slot);
+            throw;
+        }
+    } else {
+        bitmaps.quitar(columnas, slot);
+    }
+
+    if (!indicesDiferidos) {
+        ordenUnitario.quitar(columnas.costoUnitario[slot], slot);
+        ordenTotal.quitar(columnas.costoTotal[slot], slot);
+        ordenIngreso.quitar(columnas.diaIngreso[slot], slot);
+        if (slot != ultimo) {
+            ordenUnitario.quitar(columnas.costoUnitario[ultimo], ultimo);
+            ordenTotal.quitar(columnas.costoTotal[ultimo], ultimo);
+            ordenIngreso.quitar(columnas.diaIngreso[ultimo], ultimo);
+        }
+    }
+    Articulo& articulo = *articulos[slot];
+    const bool esEquipo =
+        columnas.tipo[slot] == static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+    indiceCodigos.eliminar(articulo.GetCode(), slot);
+    contadores.quitar(columnas.tipo[slot], columnas.estado[slot], columnas.costoTotal[slot]);
+    if (columnas.tecnico[slot] != TablaSimbolos::SIN_ID) rankingTecnicos.decrementar(columnas.tecnico[slot]);
+    if (diario) diario->registrarBaja(slot);
+    if (slot != ultimo) {
+        Articulo& movido = *articulos[ultimo];
+        indiceCodigos.reubicar(movido.GetCode(), ultimo, slot);
+        movido.AttachObserver(this, slot);
+        articulos[slot] = &movido;
+        cambios.marcar(slot);
+        if (reubicados.contiene(ultimo)) reubicados.marcar(slot);
+    }
+    columnas.quitar(slot);
+    articulos.pop_back();
+    // Destruir en el pool no reserva memoria: su lista libre va en las celdas
+    if (esEquipo) {
+        equipos.destruir(static_cast<EquipoMedico&>(articulo));
+    } else {
+        mobiliarios.destruir(static_cast<MobiliarioClinico&>(articulo));
+    }
+}
+
+bool Inventario::eliminarArticulo(const std::string_view codigo) {
+    const std::uint32_t slot = buscarSlot(codigo);
+    if (slot == IndiceCodigos::SIN_SLOT) return false;
+    quitarSlot(slot);
+    return true;
+}
+
+// Se da de alta una copia en el destino antes de la baja: si el alta
+// falla, el artículo sigue aquí
+bool Inventario::trasladarArticulo(const std::string_view codigo, Inventario& destino) {
+    const std::uint32_t slot = buscarSlot(codigo);
+    if (slot == IndiceCodigos::SIN_SLOT || &destino == this || destino.existeCodigo(codigo)) return false;
+    const Articulo& articulo = *articulos[slot];
+    if (articulo.GetType() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
+        const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+        destino.agregarArticulo(EquipoMedico(equipo.GetCode(), equipo.GetEntryDate(), equipo.GetStatus(),
+                                             equipo.GetUnitCost(), equipo.getMarca(), equipo.getVidaUtilAnios(),
+                                             equipo.getTecnicoAsignado(), equipo.getAreaUso()));
+    } else {
+        const auto& mobiliario = static_cast<const MobiliarioClinico&>(articulo);
+        destino.agregarArticulo(MobiliarioClinico(mobiliario.GetCode(), mobiliario.GetEntryDate(),
+                                                  mobiliario.GetStatus(), mobiliario.GetUnitCost(),
+                                                  mobiliario.getMaterial(), mobiliario.getAreaUbicacion()));
+    }
+    quitarSlot(slot);
+    return true;
+}
+
+std::vector<Articulo*> Inventario::extraerReubicados() {
+    std::vector<Articulo*> resultado;
+    for (const std::uint32_t slot : reubicados.slots()) {
+        if (slot < articulos.size()) resultado.push_back(articulos[slot]);  // no dado de baja
+    }
+    reubicados.limpiar();
+    return resultado;
+}
+
+// Ordenar todo de una vez cuesta una fracción de las altas una a una
+void Inventario::reconstruirIndicesOrdenados() {
+    indicesDiferidos = false;
+    ordenUnitario.reconstruir(columnas.costoUnitario);
+    ordenTotal.reconstruir(columnas.costoTotal);
+    ordenIngreso.reconstruir(columnas.diaIngreso);
+}
+
+void Inventario::reservar(const size_t cantidad) {
+    articulos.reserve(cantidad);
+    indiceCodigos.reservar(cantidad);
+    columnas.reservar(cantidad);
+    cambios.reservar(cantidad);
+    reubicados.reservar(cantidad);
+}
+
+void Inventario::OnArticleChanged(const Articulo& articulo, const ArticleChange cambio) {
+    const std::uint32_t slot = articulo.GetSlot();
+    if (cambio == ArticleChange::TECHNICIAN) {
+        const std::uint32_t nuevo = static_cast<const EquipoMedico&>(articulo).getTecnicoId();
+        if (nuevo != columnas.tecnico[slot]) {
+            // Solo registrar reserva memoria; un técnico sin equipos no
+            // aparece en el ranking, así que no hay nada que deshacer
+            rankingTecnicos.registrar(nuevo);
+            rankingTecnicos.decrementar(columnas.tecnico[slot]);
+            rankingTecnicos.incrementar(nuevo);
+            columnas.tecnico[slot] = nuevo;
+        }
+    } else {
+        releerFila(slot, articulo);
+    }
+    cambios.marcar(slot);
+    if (cambio == ArticleChange::LOCATION) reubicados.marcar(slot);
+    if (diario) diario->registrarCambio(articulo, cambio);
+}
+
+// Refleja en columnas, índices y contadores los valores actuales de la
+// fila. Las altas en los índices van primero y se deshacen si alguna
+// falla, junto con las columnas; las bajas y los contadores no fallan
+void Inventario::releerFila(const std::uint32_t slot, const Articulo& articulo) {
+    const std::uint8_t estadoAnterior = columnas.estado[slot];
+    const std::uint8_t areaAnterior = columnas.area[slot];
+    const double unitarioAnterior = columnas.costoUnitario[slot];
+    const double totalAnterior = columnas.costoTotal[slot];
+    columnas.actualizar(slot, articulo, fechaCorte);
+    const bool cambiaUnitario = columnas.costoUnitario[slot] != unitarioAnterior;
+    const bool cambiaTotal = columnas.costoTotal[slot] != totalAnterior;
+    int hechos = 0;
+    try {
+        if (cambiaUnitario) ordenUnitario.agregar(columnas.costoUnitario[slot], slot);
+        ++hechos;
+        if (cambiaTotal) ordenTotal.agregar(columnas.costoTotal[slot], slot);
+        ++hechos;
+        bitmaps.actualizar(columnas, slot, estadoAnterior, areaAnterior);
+    } catch (...) {
+        if (hechos > 1 && cambiaTotal) ordenTotal.quitar(columnas.costoTotal[slot], slot);
+        if (hechos > 0 && cambiaUnitario) ordenUnitario.quitar(columnas.costoUnitario[slot], slot);
+        columnas.estado[slot] = estadoAnterior;
+        columnas.area[slot] = areaAnterior;
+        columnas.costoUnitario[slot] = unitarioAnterior;
+        columnas.costoTotal[slot] = totalAnterior;
+        throw;
+    }
+    if (cambiaUnitario) ordenUnitario.quitar(unitarioAnterior, slot);
+    if (cambiaTotal) ordenTotal.quitar(totalAnterior, slot);
+    contadores.quitar(columnas.tipo[slot], estadoAnterior, totalAnterior);
+    contadores.agregar(columnas.tipo[slot], columnas.estado[slot], columnas.costoTotal[slot]);
+}
+
+// Posición del artículo en 'articulos' o IndiceCodigos::SIN_SLOT
+std::uint32_t Inventario::buscarSlot(const std::string_view codigo) const {
+    return indiceCodigos.buscar(codigo, [this](const std::uint32_t slot) -> const std::string& {
+        return articulos[slot]->GetCode();
+    });
+}
+
+// Recalcula los costos totales (y sus acumulados) con una nueva fecha de corte
+void Inventario::actualizarFechaCorte(const FechaCorte& corte) {
+    fechaCorte = corte;
+    // Cada bloque escribe filas distintas de las columnas
+    agregador.paraBloques(articulos.size(), [this](const size_t desde, const size_t hasta) {
+        for (size_t slot = desde; slot < hasta; ++slot) {
+            columnas.actualizar(static_cast<std::uint32_t>(slot), *articulos[slot], fechaCorte);
+        }
+    });
+    contadores = agregador.reducir<ContadoresInventario>(articulos.size(),
+        [this](ContadoresInventario& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                parcial.agregar(columnas.tipo[slot], columnas.estado[slot], columnas.costoTotal[slot]);
+            }
+        },
+        [](ContadoresInventario& total, ContadoresInventario&& bloque) { total.combinar(bloque); });
+    // Cambian casi todos los costos totales: sale más barato reordenar
+    ordenTotal.reconstruir(columnas.costoTotal);
+}
+
+// La depreciación solo depende del año: en el mismo año basta con mover el día
+bool Inventario::refrescarFechaCorte(const FechaCorte& hoy) {
+    if (hoy.dia <= fechaCorte.dia) return false;
+    if (hoy.anio == fechaCorte.anio) {
+        fechaCorte = hoy;
+    } else {
+        actualizarFechaCorte(hoy);
     }
+    return true;
 }
 
-// Agrupa equipos médicos por marca y área
+// Agrupa equipos médicos por marca y área, cada grupo en orden de slot
 std::map<std::pair<MarcaEquipo, AreaUso>, std::vector<EquipoMedico*>> 
 Inventario::agruparEquiposPorMarcaYArea() const {
     std::map<std::pair<MarcaEquipo, AreaUso>, std::vector<EquipoMedico*>> agrupados;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
-            auto* equipo = dynamic_cast<EquipoMedico*>(articulo.get());
-            if (equipo) {
-                agrupados[{equipo->getMarca(), equipo->getAreaUso()}].push_back(equipo);
-            }
-        }
+    const auto tipoEquipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+    for (size_t slot = 0; slot < articulos.size(); ++slot) {
+        if (columnas.tipo[slot] != tipoEquipo) continue;
+        auto* equipo = static_cast<EquipoMedico*>(articulos[slot]);
+        agrupados[{equipo->getMarca(), equipo->getAreaUso()}].push_back(equipo);
     }
     return agrupados;
 }
 
 // Devuelve todos los artículos dañados
 std::vector<Articulo*> Inventario::obtenerArticulosDanados() const {
-    std::vector<Articulo*> danados;
-    for (const auto& articulo : articulos) {
-        if (articulo->getEstado() == MedicalInventory::Domain::ArticleStatus::DAMAGED) {
-            danados.push_back(articulo.get());
-        }
-    }
-    return danados;
+    return filtrarPorEstado(MedicalInventory::Domain::ArticleStatus::DAMAGED);
 }
 
 std::map<MedicalInventory::Domain::ArticleType, std::vector<Articulo*>> Inventario::agruparDanadosPorTipo() const {
     std::map<MedicalInventory::Domain::ArticleType, std::vector<Articulo*>> danadosPorTipo;
-    for (const auto& articulo : articulos) {
-        if (articulo->getEstado() == MedicalInventory::Domain::ArticleStatus::DAMAGED) {
-            danadosPorTipo[articulo->getTipo()].push_back(articulo.get());
-        }
+    const MapaBits& danados = bitmaps.estado(MedicalInventory::Domain::ArticleStatus::DAMAGED);
+    for (const auto tipo : {MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT,
+                            MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE}) {
+        std::vector<Articulo*> delTipo = obtenerArticulos(danados & bitmaps.tipo(tipo));
+        if (!delTipo.empty()) danadosPorTipo[tipo] = std::move(delTipo);
     }
     return danadosPorTipo;
 }
 
+// Los slots se visitan en orden ascendente, igual que en los escaneos
+std::vector<Articulo*> Inventario::obtenerArticulos(const MapaBits& slots) const {
+    std::vector<Articulo*> resultado;
+    resultado.reserve(slots.cardinalidad());
+    slots.paraCada([this, &resultado](const std::uint32_t slot) { resultado.push_back(articulos[slot]); });
+    return resultado;
+}
+
 // Calcula el costo total de una categoría
 double Inventario::calcularCostoTotalPorCategoria(const MedicalInventory::Domain::ArticleType tipo) const {
-    double total = 0.0;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == tipo) {
-            total += articulo->calcularCostoTotal();
-        }
-    }
-    return total;
+    return contadores.costoPorTipo[static_cast<size_t>(tipo)].valor();
 }
 
 std::map<MedicalInventory::Domain::ArticleType, double> Inventario::calcularCostosPorCategoria() const {
@@ -65,171 +399,673 @@ std::map<MedicalInventory::Domain::ArticleType, double> Inventario::calcularCost
     return costos;
 }
 
+double Inventario::calcularCostoTotalPorEstado(const EstadoArticulo estado) const {
+    return contadores.costoPorEstado[static_cast<size_t>(estado)].valor();
+}
+
 // Devuelve el costo mínimo y máximo de los artículos
 std::pair<double, double> Inventario::obtenerCostosMinMax() const {
-    if (articulos.empty()) return {0.0, 0.0};
-    double minCosto = std::numeric_limits<double>::max();
-    double maxCosto = std::numeric_limits<double>::min();
-    for (const auto& articulo : articulos) {
-        const double costo = articulo->getCostoUnitario();
-        minCosto = std::min(minCosto, costo);
-        maxCosto = std::max(maxCosto, costo);
-    }
-    return {minCosto, maxCosto};
+    const ResumenCostos resumen = obtenerResumenCostos();
+    return {resumen.minimo, resumen.maximo};
 }
 
 Articulo* Inventario::obtenerArticuloMasCaro() const {
-    if (articulos.empty()) return nullptr;
-    const auto it = std::max_element(articulos.begin(), articulos.end(),
-        [](const std::unique_ptr<Articulo>& a, const std::unique_ptr<Articulo>& b) {
-            return a->getCostoUnitario() < b->getCostoUnitario();
-        });
-    return it->get();
+    return obtenerResumenCostos().masCaro;
 }
 
 Articulo* Inventario::obtenerArticuloMasBarato() const {
-    if (articulos.empty()) return nullptr;
-    const auto it = std::min_element(articulos.begin(), articulos.end(),
-        [](const std::unique_ptr<Articulo>& a, const std::unique_ptr<Articulo>& b) {
-            return a->getCostoUnitario() < b->getCostoUnitario();
-        });
-    return it->get();
+    return obtenerResumenCostos().masBarato;
+}
+
+// Extremos leídos del índice ordenado; ante empates, el primer slot
+ResumenCostos Inventario::obtenerResumenCostos(const CriterioCosto criterio) const {
+    ResumenCostos resumen;
+    if (articulos.empty()) return resumen;
+    const IndiceOrdenado& indice = indiceCostos(criterio);
+    const IndiceOrdenado::Entrada& minimo = indice.enPosicion(0);
+    const IndiceOrdenado::Entrada& maximo = indice.maximo();
+    resumen.minimo = minimo.valor;
+    resumen.maximo = maximo.valor;
+    resumen.masBarato = articulos[minimo.slot];
+    resumen.masCaro = articulos[maximo.slot];
+    return resumen;
+}
+
+std::vector<Articulo*> Inventario::obtenerArticulosEntreCostos(const double minimo, const double maximo,
+                                                               const CriterioCosto criterio) const {
+    const IndiceOrdenado& indice = indiceCostos(criterio);
+    std::vector<Articulo*> resultado;
+    resultado.reserve(indice.contarEntre(minimo, maximo));
+    indice.paraCadaEntre(minimo, maximo, [this, &resultado](const std::uint32_t slot) {
+        resultado.push_back(articulos[slot]);
+    });
+    return resultado;
+}
+
+size_t Inventario::contarArticulosEntreCostos(const double minimo, const double maximo,
+                                              const CriterioCosto criterio) const {
+    return indiceCostos(criterio).contarEntre(minimo, maximo);
+}
+
+std::vector<Articulo*> Inventario::obtenerArticulosMasCaros(const size_t k, const CriterioCosto criterio) const {
+    std::vector<Articulo*> resultado;
+    resultado.reserve(std::min(k, articulos.size()));
+    if (k == 0) return resultado;
+    indiceCostos(criterio).recorrerDescendente([this, k, &resultado](const std::uint32_t slot) {
+        resultado.push_back(articulos[slot]);
+        return resultado.size() < k;
+    });
+    return resultado;
+}
+
+std::vector<Articulo*> Inventario::obtenerArticulosMasBaratos(const size_t k, const CriterioCosto criterio) const {
+    std::vector<Articulo*> resultado;
+    resultado.reserve(std::min(k, articulos.size()));
+    if (k == 0) return resultado;
+    indiceCostos(criterio).recorrerAscendente([this, k, &resultado](const std::uint32_t slot) {
+        resultado.push_back(articulos[slot]);
+        return resultado.size() < k;
+    });
+    return resultado;
+}
+
+// Recorre de mayor a menor costo hasta reunir k candidatos
+std::vector<Articulo*> Inventario::obtenerArticulosMasCaros(const size_t k, const MapaBits& candidatos,
+                                                            const CriterioCosto criterio) const {
+    std::vector<Articulo*> resultado;
+    const size_t objetivo = std::min(k, candidatos.cardinalidad());
+    resultado.reserve(objetivo);
+    if (objetivo == 0) return resultado;
+    indiceCostos(criterio).recorrerDescendente([this, objetivo, &candidatos, &resultado](const std::uint32_t slot) {
+        if (candidatos.contiene(slot)) resultado.push_back(articulos[slot]);
+        return resultado.size() < objetivo;
+    });
+    return resultado;
+}
+
+double Inventario::obtenerPercentilCosto(const double percentil, const CriterioCosto criterio) const {
+    if (!(percentil >= 0.0 && percentil <= 100.0)) {
+        throw std::invalid_argument("[Inventario] Percentil fuera de [0, 100]: " + std::to_string(percentil));
+    }
+    const IndiceOrdenado& indice = indiceCostos(criterio);
+    if (indice.vacio()) return 0.0;
+    // Rango más cercano: el menor valor que deja al menos el percentil por debajo
+    const auto rango = static_cast<size_t>(std::ceil(percentil / 100.0 * static_cast<double>(indice.size())));
+    return indice.enPosicion(rango > 0 ? rango - 1 : 0).valor;
 }
 
 // Devuelve el técnico con más equipos asignados
 std::string Inventario::obtenerTecnicoConMasEquipos() const {
-    const auto conteo = contarEquiposPorTecnico();
-    if (conteo.empty()) return "";
-    const auto it = std::max_element(conteo.begin(), conteo.end(),
-        [](const auto& a, const auto& b) {
-            return a.second < b.second;
-        });
-    return it->first;
+    const std::uint32_t tecnico = rankingTecnicos.primero();
+    return (tecnico != RankingTecnicos::SIN_TECNICO) ? rankingTecnicos.nombre(tecnico) : "";
 }
 
 std::map<std::string, int> Inventario::contarEquiposPorTecnico() const {
-    std::map<std::string, int> conteo;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
-            auto* equipo = dynamic_cast<EquipoMedico*>(articulo.get());
-            if (equipo) {
-                conteo[equipo->getTecnicoAsignado()]++;
-            }
-        }
-    }
-    return conteo;
+    const auto cargas = rankingTecnicos.todos();
+    return std::map<std::string, int>(cargas.begin(), cargas.end());
 }
 
-// Calcula el valor con plus para cada mobiliario clínico
+// Los k técnicos con más equipos asignados, de mayor a menor carga
+std::vector<std::pair<std::string, int>> Inventario::obtenerTecnicosConMasEquipos(const size_t k) const {
+    return rankingTecnicos.mejores(k);
+}
+
+// Calcula el valor con plus para cada mobiliario clínico, en orden de slot
 std::vector<std::pair<MobiliarioClinico*, double>> Inventario::calcularValoresConPlus() const {
     std::vector<std::pair<MobiliarioClinico*, double>> valoresConPlus;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE) {
-            auto* mobiliario = dynamic_cast<MobiliarioClinico*>(articulo.get());
-            if (mobiliario) {
-                valoresConPlus.emplace_back(mobiliario, mobiliario->calcularValorConPlus());
-            }
-        }
+    valoresConPlus.reserve(mobiliarios.size());
+    for (MobiliarioClinico* mobiliario : obtenerMobiliario()) {
+        valoresConPlus.emplace_back(mobiliario, mobiliario->calcularValorConPlus());
     }
     return valoresConPlus;
 }
 
 // Devuelve todos los artículos del inventario
 std::vector<Articulo*> Inventario::obtenerTodosLosArticulos() const {
-    std::vector<Articulo*> todos;
-    for (const auto& articulo : articulos) {
-        todos.push_back(articulo.get());
-    }
-    return todos;
+    return articulos;
 }
 
+// Los de un tipo en orden de slot (el de alta mientras no haya bajas);
+// la columna de tipo evita tocar cada artículo para descartarlo
 std::vector<EquipoMedico*> Inventario::obtenerEquiposMedicos() const {
-    std::vector<EquipoMedico*> equipos;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
-            auto* equipo = dynamic_cast<EquipoMedico*>(articulo.get());
-            if (equipo) {
-                equipos.push_back(equipo);
-            }
-        }
+    std::vector<EquipoMedico*> resultado;
+    resultado.reserve(equipos.size());
+    const auto tipoEquipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+    for (size_t slot = 0; slot < articulos.size(); ++slot) {
+        if (columnas.tipo[slot] == tipoEquipo) resultado.push_back(static_cast<EquipoMedico*>(articulos[slot]));
     }
-    return equipos;
+    return resultado;
 }
 
 std::vector<MobiliarioClinico*> Inventario::obtenerMobiliario() const {
-    std::vector<MobiliarioClinico*> mobiliario;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE) {
-            auto* mob = dynamic_cast<MobiliarioClinico*>(articulo.get());
-            if (mob) {
-                mobiliario.push_back(mob);
-            }
+    std::vector<MobiliarioClinico*> resultado;
+    resultado.reserve(mobiliarios.size());
+    const auto tipoMobiliario = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE);
+    for (size_t slot = 0; slot < articulos.size(); ++slot) {
+        if (columnas.tipo[slot] == tipoMobiliario) {
+            resultado.push_back(static_cast<MobiliarioClinico*>(articulos[slot]));
         }
     }
-    return mobiliario;
+    return resultado;
+}
+
+// Un valor igual al actual no genera cambio (ni registro en el diario)
+size_t Inventario::aplicarEventos(const std::vector<EventoInventario>& eventos) {
+    size_t aplicados = 0;
+    for (const EventoInventario& evento : eventos) {
+        const std::uint32_t slot = buscarSlot(evento.codigo());
+        if (slot == IndiceCodigos::SIN_SLOT) continue;
+        Articulo& articulo = *articulos[slot];
+        if (evento.tipo == EventoInventario::Tipo::ESTADO) {
+            if (articulo.GetStatus() != evento.estado) articulo.SetStatus(evento.estado);
+        } else if (articulo.GetUnitCost() != evento.costo) {
+            articulo.SetUnitCost(evento.costo);
+        }
+        ++aplicados;
+    }
+    return aplicados;
 }
 
 // Busca un artículo por su código
 Articulo* Inventario::buscarPorCodigo(const std::string& codigo) const {
-    const auto it = std::find_if(articulos.begin(), articulos.end(),
-        [&codigo](const std::unique_ptr<Articulo>& articulo) {
-            return articulo->getCodigo() == codigo;
-        });
-    return (it != articulos.end()) ? it->get() : nullptr;
+    const std::uint32_t slot = buscarSlot(codigo);
+    return (slot != IndiceCodigos::SIN_SLOT) ? articulos[slot] : nullptr;
 }
 
 std::vector<Articulo*> Inventario::filtrarPorEstado(const EstadoArticulo estado) const {
-    std::vector<Articulo*> filtrados;
-    for (const auto& articulo : articulos) {
-        if (articulo->getEstado() == estado) {
-            filtrados.push_back(articulo.get());
-        }
-    }
-    return filtrados;
+    return filtrar(Filtro::estado(estado));
 }
 
 std::vector<Articulo*> Inventario::filtrarPorTipo(const MedicalInventory::Domain::ArticleType tipo) const {
-    std::vector<Articulo*> filtrados;
-    for (const auto& articulo : articulos) {
-        if (articulo->getTipo() == tipo) {
-            filtrados.push_back(articulo.get());
-        }
-    }
-    return filtrados;
+    return filtrar(Filtro::tipo(tipo));
+}
+
+// Equipos en revisión o dañados (EquipoMedico::necesitaMantenimiento)
+std::vector<EquipoMedico*> Inventario::obtenerEquiposQueNecesitanMantenimiento() const {
+    const std::vector<Articulo*> candidatos = filtrar(
+        Filtro::tipo(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) &&
+        !Filtro::estado(MedicalInventory::Domain::ArticleStatus::OPERATIONAL));
+    std::vector<EquipoMedico*> resultado;
+    resultado.reserve(candidatos.size());
+    for (Articulo* articulo : candidatos) resultado.push_back(static_cast<EquipoMedico*>(articulo));
+    return resultado;
 }
 
 size_t Inventario::obtenerCantidadPorTipo(const MedicalInventory::Domain::ArticleType tipo) const {
-    return std::count_if(articulos.begin(), articulos.end(),
-        [tipo](const std::unique_ptr<Articulo>& articulo) {
-            return articulo->getTipo() == tipo;
-        });
+    return contadores.cantidadPorTipo[static_cast<size_t>(tipo)];
 }
 
 size_t Inventario::obtenerCantidadPorEstado(const EstadoArticulo estado) const {
-    return std::count_if(articulos.begin(), articulos.end(),
-        [estado](const std::unique_ptr<Articulo>& articulo) {
-            return articulo->getEstado() == estado;
+    return contadores.cantidadPorEstado[static_cast<size_t>(estado)];
+}
+
+// Suma el valor actual (costo total a la fecha de corte) de los equipos de cada técnico
+std::map<std::string, double> Inventario::calcularValorTotalPorTecnico() const {
+    using Parcial = std::unordered_map<std::uint32_t, SumaCompensada>;
+    const Parcial porTecnico = agregador.reducir<Parcial>(columnas.size(),
+        [this](Parcial& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                if (columnas.tecnico[slot] != TablaSimbolos::SIN_ID) {
+                    parcial[columnas.tecnico[slot]].sumar(columnas.costoTotal[slot]);
+                }
+            }
+        },
+        [](Parcial& total, Parcial&& bloque) {
+            for (const auto& [tecnico, suma] : bloque) total[tecnico].sumar(suma.valor());
+        });
+
+    std::map<std::string, double> valores;
+    for (const auto& [tecnico, suma] : porTecnico) {
+        valores[TablaSimbolos::global().texto(tecnico)] = suma.valor();
+    }
+    return valores;
+}
+
+// Depreciación acumulada de todos los equipos médicos a la fecha de corte
+double Inventario::calcularDepreciacionTotal() const {
+    const auto equipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+    const SumaCompensada total = agregador.reducir<SumaCompensada>(columnas.size(),
+        [this, equipo](SumaCompensada& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                if (columnas.tipo[slot] == equipo) {
+                    parcial.sumar(static_cast<const EquipoMedico*>(articulos[slot])->calcularDepreciacion(fechaCorte));
+                }
+            }
+        },
+        [](SumaCompensada& suma, SumaCompensada&& bloque) { suma.sumar(bloque.valor()); });
+    return total.valor();
+}
+
+std::vector<Articulo*> Inventario::obtenerArticulosRecientes(const int dias) const {
+    if (dias < 0) return {};
+    return obtenerArticulosIngresadosEntre(fechaCorte.dia - dias, fechaCorte.dia);
+}
+
+std::vector<Articulo*> Inventario::obtenerArticulosIngresadosEntre(const std::int32_t desde,
+                                                                   const std::int32_t hasta) const {
+    std::vector<Articulo*> resultado;
+    resultado.reserve(ordenIngreso.contarEntre(desde, hasta));
+    ordenIngreso.paraCadaEntre(desde, hasta, [this, &resultado](const std::uint32_t slot) {
+        resultado.push_back(articulos[slot]);
+    });
+    return resultado;
+}
+
+// Filtro::ingresoEntre valida las fechas y las convierte en días
+std::vector<Articulo*> Inventario::obtenerArticulosIngresadosEntre(const std::string_view desde,
+                                                                   const std::string_view hasta) const {
+    const Filtro::IngresoEntre rango = Filtro::ingresoEntre(desde, hasta);
+    return obtenerArticulosIngresadosEntre(rango.minimo, rango.maximo);
+}
+
+size_t Inventario::contarArticulosIngresadosEntre(const std::int32_t desde, const std::int32_t hasta) const {
+    return ordenIngreso.contarEntre(desde, hasta);
+}
+
+namespace {
+    // Primer día del periodo que contiene 'dia' (las semanas empiezan en él)
+    std::int32_t inicioDePeriodo(const PeriodoIngreso periodo, const std::int32_t dia) noexcept {
+        const Fecha::Civil fecha = Fecha::civilDeDias(dia);
+        switch (periodo) {
+            case PeriodoIngreso::MES: return Fecha::diasDesdeCivil(fecha.anio, fecha.mes, 1);
+            case PeriodoIngreso::ANIO: return Fecha::diasDesdeCivil(fecha.anio, 1, 1);
+            default: return dia;
+        }
+    }
+
+    std::int32_t siguientePeriodo(const PeriodoIngreso periodo, const std::int32_t inicio) noexcept {
+        const Fecha::Civil fecha = Fecha::civilDeDias(inicio);
+        switch (periodo) {
+            case PeriodoIngreso::DIA: return inicio + 1;
+            case PeriodoIngreso::SEMANA: return inicio + 7;
+            case PeriodoIngreso::MES:
+                return (fecha.mes == 12) ? Fecha::diasDesdeCivil(fecha.anio + 1, 1, 1)
+                                         : Fecha::diasDesdeCivil(fecha.anio, fecha.mes + 1, 1);
+            default: return Fecha::diasDesdeCivil(fecha.anio + 1, 1, 1);
+        }
+    }
+}
+
+// Los ingresos del intervalo salen en orden de fecha: un solo recorrido
+// los reparte avanzando de periodo en periodo. El intervalo se recorta a
+// las fechas representables, así que hay a lo sumo un periodo por día
+// entre 01/01/0000 y 31/12/9999 y el avance no desborda
+std::vector<IngresosPeriodo> Inventario::obtenerIngresosPorPeriodo(const PeriodoIngreso periodo,
+                                                                   std::int32_t desde,
+                                                                   std::int32_t hasta) const {
+    std::vector<IngresosPeriodo> periodos;
+    desde = std::max(desde, Fecha::PRIMER_DIA);
+    hasta = std::min(hasta, Fecha::ULTIMO_DIA);
+    if (desde > hasta) return periodos;
+    for (std::int32_t inicio = inicioDePeriodo(periodo, desde); inicio <= hasta;
+         inicio = siguientePeriodo(periodo, inicio)) {
+        periodos.push_back({inicio, 0, 0.0});
+    }
+    std::vector<SumaCompensada> costos(periodos.size());
+    size_t actual = 0;
+    ordenIngreso.paraCadaEntre(desde, hasta, [&](const std::uint32_t slot) {
+        while (actual + 1 < periodos.size() && periodos[actual + 1].inicio <= columnas.diaIngreso[slot]) ++actual;
+        ++periodos[actual].cantidad;
+        costos[actual].sumar(columnas.costoUnitario[slot]);
+    });
+    for (size_t i = 0; i < periodos.size(); ++i) periodos[i].costo = costos[i].valor();
+    return periodos;
+}
+
+// Conteo por valor de la columna de área para un tipo de artículo
+std::array<int, 256> Inventario::contarPorArea(const MedicalInventory::Domain::ArticleType tipo) const {
+    using Parcial = std::array<int, 256>;
+    const auto tipoBuscado = static_cast<std::uint8_t>(tipo);
+    return agregador.reducir<Parcial>(columnas.size(),
+        [this, tipoBuscado](Parcial& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                if (columnas.tipo[slot] == tipoBuscado) ++parcial[columnas.area[slot]];
+            }
+        },
+        [](Parcial& total, Parcial&& bloque) {
+            for (size_t area = 0; area < total.size(); ++area) total[area] += bloque[area];
         });
 }
 
-bool Inventario::existeCodigo(const std::string& codigo) const {
-    return buscarPorCodigo(codigo) != nullptr;
+std::map<AreaUso, int> Inventario::contarEquiposPorArea() const {
+    const auto porArea = contarPorArea(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+    std::map<AreaUso, int> conteo;
+    for (size_t area = 0; area < porArea.size(); ++area) {
+        if (porArea[area] > 0) conteo[static_cast<AreaUso>(area)] = porArea[area];
+    }
+    return conteo;
 }
 
-// Guarda el inventario en un archivo (implementación básica)
+std::map<AreaUbicacion, int> Inventario::contarMobiliarioPorArea() const {
+    const auto porArea = contarPorArea(MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE);
+    std::map<AreaUbicacion, int> conteo;
+    for (size_t area = 0; area < porArea.size(); ++area) {
+        if (porArea[area] > 0) conteo[static_cast<AreaUbicacion>(area)] = porArea[area];
+    }
+    return conteo;
+}
+
+bool Inventario::existeCodigo(const std::string_view codigo) const {
+    return buscarSlot(codigo) != IndiceCodigos::SIN_SLOT;
+}
+
+EscritorSnapshot Inventario::crearSnapshot() const {
+    EscritorSnapshot escritor(articulos.size());
+    for (const Articulo* articulo : articulos) {
+        escritor.agregar(*articulo);
+    }
+    return escritor;
+}
+
+// Guarda el inventario como snapshot binario, en orden de slot
 void Inventario::guardarEnArchivo(const std::string& nombreArchivo) const {
-    std::ofstream archivo(nombreArchivo);
-    if (!archivo.is_open()) return;
-    for (const auto& articulo : articulos) {
-        archivo << articulo->getInformacion() << "\n---\n";
+    crearSnapshot().escribir(nombreArchivo);
+}
+
+namespace {
+    // Artículo de un registro de snapshot o de delta
+    template <typename Lector>
+    void agregarRegistro(Inventario& inventario, const RegistroSnapshot& r, const Lector& origen) {
+        const auto estado = static_cast<EstadoArticulo>(r.estado);
+        if (r.tipo == static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT)) {
+            inventario.agregarArticulo(EquipoMedico(origen.texto(r.codigo), origen.texto(r.fechaIngreso), estado,
+                                                    r.costoUnitario, static_cast<MarcaEquipo>(r.marca),
+                                                    r.vidaUtilAnios, origen.texto(r.texto),
+                                                    static_cast<AreaUso>(r.area)));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico(origen.texto(r.codigo), origen.texto(r.fechaIngreso), estado,
+                                                         r.costoUnitario, origen.texto(r.texto),
+                                                         static_cast<AreaUbicacion>(r.area)));
+        }
     }
-    archivo.close();
 }
 
+// Da de alta la base y, si corresponde a ella, su delta en un inventario
+// vacío; los slots del delta quedan como modificados. Devuelve la
+// generación del snapshot
+std::uint32_t Inventario::cargarBase(const std::string& nombreArchivo) {
+    const LectorSnapshot snapshot(nombreArchivo);
+    std::optional<LectorDelta> delta;
+    const std::string rutaDelta = SnapshotInventario::rutaDelta(nombreArchivo);
+    if (std::filesystem::exists(rutaDelta)) {
+        delta.emplace(rutaDelta);
+        // Un delta de una base anterior ya está incluido en esta
+        if (delta->sumaBase() != snapshot.sumaVerificacion()) {
+            delta.reset();
+        } else if (delta->cantidadTotal() > snapshot.size() + delta->size()) {
+            throw std::runtime_error("[Inventario] El delta '" + rutaDelta + "' deja slots sin artículo");
+        }
+    }
+
+    constexpr std::uint32_t SIN_DELTA = std::numeric_limits<std::uint32_t>::max();
+    const size_t total = delta ? static_cast<size_t>(delta->cantidadTotal()) : snapshot.size();
+    std::vector<std::uint32_t> registroDelta;  // registro del delta de cada slot
+    if (delta) {
+        registroDelta.assign(total, SIN_DELTA);
+        for (size_t i = 0; i < delta->size(); ++i) registroDelta[delta->slot(i)] = static_cast<std::uint32_t>(i);
+    }
+
+    reservar(total);
+    // Si la carga falla, el inventario a medio cargar se descarta
+    indicesDiferidos = true;
+    for (size_t slot = 0; slot < total; ++slot) {
+        if (delta && registroDelta[slot] != SIN_DELTA) {
+            agregarRegistro(*this, delta->registro(registroDelta[slot]), *delta);
+        } else if (slot < snapshot.size()) {
+            agregarRegistro(*this, snapshot.registro(slot), snapshot);
+        } else {
+            throw std::runtime_error("[Inventario] El delta de '" + nombreArchivo + "' deja slots sin artículo");
+        }
+        if (articulos.size() != slot + 1) {
+            throw std::runtime_error("[Inventario] Código duplicado en '" + nombreArchivo + "'");
+        }
+    }
+    reconstruirIndicesOrdenados();
+
+    cambios.limpiar();
+    if (delta) {
+        for (size_t i = 0; i < delta->size(); ++i) cambios.marcar(delta->slot(i));
+    }
+    archivoBase = nombreArchivo;
+    sumaBase = snapshot.sumaVerificacion();
+    return snapshot.generacion();
+}
+
+// Reemplaza el contenido por el de un snapshot (y su delta); si un archivo
+// es inválido lanza una excepción y el inventario queda como estaba
 void Inventario::cargarDeArchivo(const std::string& nombreArchivo) {
-    // Implementación básica - en un proyecto real se haría parsing completo
-    std::ifstream archivo(nombreArchivo);
-    if (!archivo.is_open()) return;
-    // Por ahora solo se implementa la estructura
-    archivo.close();
+    Inventario cargado;
+    cargado.fechaCorte = fechaCorte;
+    cargado.agregador = agregador;
+    cargado.cargarBase(nombreArchivo);
+    // El diario describe el contenido anterior, no el cargado
+    cerrarDiario();
+    *this = std::move(cargado);
+}
+
+void Inventario::exportarColumnar(const std::string& nombreArchivo) const {
+    EscritorColumnar escritor(articulos.size());
+    for (const Articulo* articulo : articulos) {
+        escritor.agregar(*articulo);
+    }
+    escritor.escribir(nombreArchivo);
+}
+
+// Como cargarDeArchivo: si el archivo es inválido el inventario queda como estaba
+void Inventario::importarColumnar(const std::string& nombreArchivo) {
+    const LectorColumnar lector(nombreArchivo);
+    Inventario cargado;
+    cargado.fechaCorte = fechaCorte;
+    cargado.agregador = agregador;
+    cargado.reservar(lector.size());
+    cargado.indicesDiferidos = true;
+
+    CursorColumnar cursor(lector, FormatoColumnar::TODAS);
+    BloqueColumnar bloque;
+    char fecha[10];
+    const auto equipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+    while (cursor.siguiente(bloque)) {
+        for (size_t i = 0; i < bloque.cantidad; ++i) {
+            Fecha::textoDeDias(bloque.diaIngreso[i], fecha);
+            const std::string_view fechaIngreso(fecha, sizeof fecha);
+            const auto estado = static_cast<EstadoArticulo>(bloque.estado[i]);
+            if (bloque.tipo[i] == equipo) {
+                if (bloque.vidaUtilAnios[i] <= 0) {
+                    throw std::runtime_error("[Inventario] Vida útil no positiva en '" + nombreArchivo + "'");
+                }
+                cargado.agregarArticulo(EquipoMedico(bloque.codigo[i], fechaIngreso, estado, bloque.costoUnitario[i],
+                                                     static_cast<MarcaEquipo>(bloque.marca[i]),
+                                                     bloque.vidaUtilAnios[i], lector.texto(bloque.texto[i]),
+                                                     static_cast<AreaUso>(bloque.area[i])));
+            } else {
+                cargado.agregarArticulo(MobiliarioClinico(bloque.codigo[i], fechaIngreso, estado,
+                                                          bloque.costoUnitario[i], lector.texto(bloque.texto[i]),
+                                                          static_cast<AreaUbicacion>(bloque.area[i])));
+            }
+            if (cargado.articulos.size() != bloque.primeraFila + i + 1) {
+                throw std::runtime_error("[Inventario] Código duplicado en '" + nombreArchivo + "'");
+            }
+        }
+    }
+    cargado.reconstruirIndicesOrdenados();
+    cerrarDiario();
+    *this = std::move(cargado);
+}
+
+// El delta es acumulativo: reescribirlo cuesta lo que los cambios desde la
+// base. Sin base vigente, o con más de un cuarto del inventario modificado,
+// sale más a cuenta reescribir la base
+void Inventario::guardarCambios(const std::string& nombreArchivo) {
+    const bool baseVigente = nombreArchivo == archivoBase && sumaBase != 0 &&
+                             LectorSnapshot::sumaDeArchivo(nombreArchivo) == sumaBase;
+    if (!baseVigente || cambios.size() > articulos.size() / 4) {
+        fusionarCambios(nombreArchivo);
+        return;
+    }
+    // Tras una baja pueden quedar marcados slots que ya no existen
+    std::vector<std::uint32_t> slots;
+    slots.reserve(cambios.size());
+    for (const std::uint32_t slot : cambios.slots()) {
+        if (slot < articulos.size()) slots.push_back(slot);
+    }
+    EscritorSnapshot escritor(slots.size());
+    for (const std::uint32_t slot : slots) {
+        escritor.agregar(*articulos[slot]);
+    }
+    escritor.escribirDelta(nombreArchivo, slots, articulos.size(), sumaBase);
+}
+
+void Inventario::fusionarCambios(const std::string& nombreArchivo) {
+    sumaBase = crearSnapshot().escribir(nombreArchivo);
+    archivoBase = nombreArchivo;
+    cambios.limpiar();
+}
+
+// Rehace una mutación del diario; los valores se validan igual que al
+// leer un snapshot porque el diario viene de disco
+void Inventario::aplicarRegistro(const RegistroDiario& registro, const std::string& rutaDiario) {
+    const auto inconsistente = [&rutaDiario](const char* motivo) {
+        throw std::runtime_error("[Inventario] Diario '" + rutaDiario + "' inconsistente: " + motivo);
+    };
+    const auto equipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+
+    if (registro.operacion == OperacionDiario::ALTA) {
+        if (registro.slot != articulos.size()) inconsistente("alta fuera de orden");
+        if (registro.tipo >= CodecEnums::TIPO.cantidad() || registro.estado >= CodecEnums::ESTADO.cantidad()) {
+            inconsistente("valor de enumeración desconocido");
+        }
+        const auto estado = static_cast<EstadoArticulo>(registro.estado);
+        if (registro.tipo == equipo) {
+            if (registro.marca >= CodecEnums::MARCA.cantidad() || registro.area >= CodecEnums::AREA_USO.cantidad()) {
+                inconsistente("valor de enumeración desconocido");
+            }
+            if (registro.vidaUtilAnios <= 0) inconsistente("vida útil no positiva");
+            agregarArticulo(EquipoMedico(registro.codigo, registro.fechaIngreso, estado, registro.costoUnitario,
+                                         static_cast<MarcaEquipo>(registro.marca), registro.vidaUtilAnios,
+                                         registro.texto, static_cast<AreaUso>(registro.area)));
+        } else {
+            if (registro.area >= CodecEnums::AREA_UBICACION.cantidad()) inconsistente("valor de enumeración desconocido");
+            agregarArticulo(MobiliarioClinico(registro.codigo, registro.fechaIngreso, estado, registro.costoUnitario,
+                                              registro.texto, static_cast<AreaUbicacion>(registro.area)));
+        }
+        if (articulos.size() != registro.slot + size_t{1}) inconsistente("código duplicado");
+        return;
+    }
+
+    if (registro.slot >= articulos.size()) inconsistente("slot inexistente");
+    if (registro.operacion == OperacionDiario::BAJA) {
+        quitarSlot(registro.slot);
+        return;
+    }
+    Articulo& articulo = *articulos[registro.slot];
+    const bool esEquipo = columnas.tipo[registro.slot] == equipo;
+    switch (registro.operacion) {
+        case OperacionDiario::ESTADO:
+            if (registro.estado >= CodecEnums::ESTADO.cantidad()) inconsistente("valor de enumeración desconocido");
+            articulo.SetStatus(static_cast<EstadoArticulo>(registro.estado));
+            break;
+        case OperacionDiario::COSTO:
+            articulo.SetUnitCost(registro.costoUnitario);
+            break;
+        case OperacionDiario::UBICACION:
+            if (esEquipo) {
+                if (registro.area >= CodecEnums::AREA_USO.cantidad()) inconsistente("valor de enumeración desconocido");
+                static_cast<EquipoMedico&>(articulo).setAreaUso(static_cast<AreaUso>(registro.area));
+            } else {
+                if (registro.area >= CodecEnums::AREA_UBICACION.cantidad()) inconsistente("valor de enumeración desconocido");
+                static_cast<MobiliarioClinico&>(articulo).setAreaUbicacion(static_cast<AreaUbicacion>(registro.area));
+            }
+            break;
+        case OperacionDiario::VIDA_UTIL:
+            if (!esEquipo) inconsistente("vida útil de un mobiliario");
+            if (registro.vidaUtilAnios <= 0) inconsistente("vida útil no positiva");
+            static_cast<EquipoMedico&>(articulo).setVidaUtilAnios(registro.vidaUtilAnios);
+            break;
+        case OperacionDiario::TECNICO:
+            if (!esEquipo) inconsistente("técnico de un mobiliario");
+            static_cast<EquipoMedico&>(articulo).setTecnicoAsignado(std::string(registro.texto));
+            break;
+        case OperacionDiario::MATERIAL:
+            if (esEquipo) inconsistente("material de un equipo");
+            static_cast<MobiliarioClinico&>(articulo).setMaterial(std::string(registro.texto));
+            break;
+        default:
+            inconsistente("operación desconocida");
+    }
+}
+
+// Recupera snapshot + diarios en un inventario nuevo y solo entonces
+// sustituye el contenido; sin nada en disco, el contenido actual pasa a
+// ser el snapshot inicial
+ResultadoRecuperacion Inventario::abrirDiario(const std::string& rutaSnapshot, const OpcionesDiario& opciones) {
+    namespace fs = std::filesystem;
+    cerrarDiario();
+    const std::string rutaActual = DiarioInventario::rutaDiario(rutaSnapshot);
+    const std::string rutaAnterior = DiarioInventario::rutaDiarioAnterior(rutaSnapshot);
+    ResultadoRecuperacion resultado;
+
+    if (!fs::exists(rutaSnapshot) && !fs::exists(rutaActual) && !fs::exists(rutaAnterior)) {
+        auto nuevo = std::make_unique<DiarioInventario>(rutaSnapshot, 0, 0, opciones);
+        nuevo->puntoDeControl(crearSnapshot());
+        diario = std::move(nuevo);
+        return resultado;
+    }
+
+    Inventario recuperado;
+    recuperado.fechaCorte = fechaCorte;
+    recuperado.agregador = agregador;
+    std::uint32_t generacion = 0;
+    if (fs::exists(rutaSnapshot)) generacion = recuperado.cargarBase(rutaSnapshot);
+
+    // El diario rotado por una compactación sin terminar va antes que el
+    // actual; los de generación menor ya están dentro del snapshot
+    std::uint32_t esperada = generacion;
+    std::uint32_t generacionDiario = generacion;
+    std::uint64_t bytesValidos = 0;
+    bool cortado = false;
+    for (const std::string* ruta : {&rutaAnterior, &rutaActual}) {
+        if (!fs::exists(*ruta)) continue;
+        LectorDiario lector(*ruta);
+        if (lector.generacion() < generacion) continue;
+        if (lector.generacion() != esperada || cortado) {
+            throw std::runtime_error("[Inventario] El diario '" + *ruta + "' no sigue al snapshot '" +
+                                     rutaSnapshot + "'");
+        }
+        RegistroDiario registro;
+        while (lector.siguiente(registro)) {
+            recuperado.aplicarRegistro(registro, *ruta);
+            ++resultado.registrosAplicados;
+        }
+        cortado = lector.bytesValidos() != lector.size();
+        resultado.bytesDescartados += lector.size() - lector.bytesValidos();
+        esperada = lector.generacion() + 1;
+        generacionDiario = esperada;
+        if (ruta == &rutaActual) {
+            generacionDiario = lector.generacion();
+            bytesValidos = lector.bytesValidos();
+        }
+    }
+
+    auto nuevo = std::make_unique<DiarioInventario>(rutaSnapshot, generacionDiario, bytesValidos, opciones);
+    if (fs::exists(rutaAnterior)) nuevo->puntoDeControl(recuperado.crearSnapshot());
+    *this = std::move(recuperado);
+    diario = std::move(nuevo);
+    return resultado;
+}
+
+void Inventario::confirmarCambios() {
+    if (diario) diario->confirmar();
+}
+
+void Inventario::compactarDiario() {
+    if (!diario) throw std::runtime_error("[Inventario] No hay un diario abierto");
+    diario->compactar(crearSnapshot());
+}
+
+// Espera a que todo lo registrado esté en disco antes de soltar el diario
+void Inventario::cerrarDiario() {
+    if (!diario) return;
+    const std::unique_ptr<DiarioInventario> cerrando = std::move(diario);
+    cerrando->confirmar();
+    cerrando->esperarCompactacion();
 }
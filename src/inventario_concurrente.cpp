@@ -0,0 +1,460 @@
+/**
+ * @file inventario_concurrente.cpp
+ * @brief Implementation of the copy-on-write concurrent inventory
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/inventario_concurrente.hpp"
+#include "../include/inventario.hpp"
+#include "../include/suma_compensada.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    using MedicalInventory::Domain::ArticleType;
+
+    // Valor a la fecha de corte; la etiqueta de tipo garantiza el cast
+    double costoTotal(const Articulo& articulo, const FechaCorte& corte) noexcept {
+        if (articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+            return static_cast<const EquipoMedico&>(articulo).CalculateTotalCost(corte);
+        }
+        return static_cast<const MobiliarioClinico&>(articulo).CalculateTotalCost(corte);
+    }
+
+    // Los artículos no se copian (tienen observador): se reconstruyen campo a campo
+    std::unique_ptr<Articulo> copiar(const Articulo& articulo) {
+        if (articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+            const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+            return std::make_unique<EquipoMedico>(equipo.GetCode(), equipo.GetEntryDate(), equipo.GetStatus(),
+                                                  equipo.GetUnitCost(), equipo.getMarca(), equipo.getVidaUtilAnios(),
+                                                  equipo.getTecnicoAsignado(), equipo.getAreaUso());
+        }
+        const auto& mobiliario = static_cast<const MobiliarioClinico&>(articulo);
+        return std::make_unique<MobiliarioClinico>(mobiliario.GetCode(), mobiliario.GetEntryDate(),
+                                                   mobiliario.GetStatus(), mobiliario.GetUnitCost(),
+                                                   mobiliario.getMaterial(), mobiliario.getAreaUbicacion());
+    }
+
+    // Hueco para un push_back que no lance, con crecimiento geométrico
+    template <typename T>
+    void reservarUnoMas(std::vector<T>& vector) {
+        if (vector.size() == vector.capacity()) vector.reserve(std::max<std::size_t>(16, vector.size() * 2));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// InventarioConcurrente
+
+std::uint32_t InventarioConcurrente::Version::buscarSlot(const std::string_view codigo) const {
+    const TrozoIndice* trozo = indice->trozos[trozoDeCodigo(codigo)];
+    if (!trozo) return IndiceCodigos::SIN_SLOT;
+    return trozo->indice.buscar(codigo, [this](const std::uint32_t slot) -> const std::string& {
+        return articulo(slot)->GetCode();
+    });
+}
+
+InventarioConcurrente::InventarioConcurrente() {
+    auto version = std::make_unique<Version>();
+    auto indice = std::make_unique<DirectorioIndice>();
+    version->numero = indice->version = m_ultimaVersion;
+    version->indice = indice.release();
+    m_version.store(version.release());
+}
+
+InventarioConcurrente::InventarioConcurrente(const Inventario& origen) : InventarioConcurrente() {
+    const std::vector<Articulo*> articulos = origen.obtenerTodosLosArticulos();
+    modificar([&](EscrituraInventario& escritura) {
+        escritura.actualizarFechaCorte(origen.obtenerFechaCorte());
+        for (const Articulo* articulo : articulos) escritura.insertar(copiar(*articulo));
+    });
+}
+
+// La versión vigente es dueña de todo lo que alcanza; lo retirado lo libera m_epocas
+InventarioConcurrente::~InventarioConcurrente() {
+    const Version* version = m_version.load();
+    for (size_t slot = 0; slot < version->cantidad; ++slot) delete version->articulo(slot);
+    for (const TrozoArticulos* trozo : version->trozos) delete trozo;
+    for (const TrozoIndice* trozo : version->indice->trozos) delete trozo;
+    delete version->indice;
+    delete version;
+}
+
+LecturaInventario InventarioConcurrente::leer() const noexcept {
+    GestorEpocas::Guarda guarda = m_epocas.entrar();
+    return LecturaInventario(std::move(guarda), m_version.load());
+}
+
+bool InventarioConcurrente::agregarArticulo(EquipoMedico&& equipo) {
+    bool agregado = false;
+    modificar([&](EscrituraInventario& escritura) { agregado = escritura.agregarArticulo(std::move(equipo)); });
+    return agregado;
+}
+
+bool InventarioConcurrente::agregarArticulo(MobiliarioClinico&& mobiliario) {
+    bool agregado = false;
+    modificar([&](EscrituraInventario& escritura) { agregado = escritura.agregarArticulo(std::move(mobiliario)); });
+    return agregado;
+}
+
+bool InventarioConcurrente::actualizarEstado(const std::string_view codigo, const EstadoArticulo estado) {
+    bool encontrado = false;
+    modificar([&](EscrituraInventario& escritura) {
+        const Articulo* actual = escritura.buscarPorCodigo(codigo);
+        encontrado = actual != nullptr;
+        if (actual && actual->GetStatus() != estado) escritura.editar(actual->GetSlot()).SetStatus(estado);
+    });
+    return encontrado;
+}
+
+bool InventarioConcurrente::actualizarCosto(const std::string_view codigo, const double costo) {
+    bool encontrado = false;
+    modificar([&](EscrituraInventario& escritura) {
+        Articulo* articulo = escritura.editar(codigo);
+        encontrado = articulo != nullptr;
+        if (articulo) articulo->SetUnitCost(costo);
+    });
+    return encontrado;
+}
+
+void InventarioConcurrente::actualizarFechaCorte(const FechaCorte& corte) {
+    modificar([&corte](EscrituraInventario& escritura) { escritura.actualizarFechaCorte(corte); });
+}
+
+std::size_t InventarioConcurrente::aplicarEventos(const std::vector<EventoInventario>& eventos) {
+    std::size_t aplicados = 0;
+    modificar([&](EscrituraInventario& escritura) {
+        aplicados = 0;
+        for (const EventoInventario& evento : eventos) {
+            const Articulo* actual = escritura.buscarPorCodigo(evento.codigo());
+            if (!actual) continue;
+            if (evento.tipo == EventoInventario::Tipo::ESTADO) {
+                if (actual->GetStatus() != evento.estado) escritura.editar(actual->GetSlot()).SetStatus(evento.estado);
+            } else if (actual->GetUnitCost() != evento.costo) {
+                escritura.editar(actual->GetSlot()).SetUnitCost(evento.costo);
+            }
+            ++aplicados;
+        }
+    });
+    return aplicados;
+}
+
+std::size_t InventarioConcurrente::obtenerPendientesDeLiberar() const {
+    std::lock_guard<std::mutex> bloqueo(m_escritura);
+    return m_epocas.pendientes();
+}
+
+// Se llama con m_escritura tomado
+void InventarioConcurrente::publicar(EscrituraInventario& escritura) {
+    if (!escritura.hayCambios()) return;
+    Version& borrador = *escritura.m_borrador;
+
+    if (escritura.m_fechaCambiada) {
+        // Cambian los valores depreciados de todo el inventario
+        const AgregadorParalelo agregador;
+        borrador.contadores = agregador.reducir<ContadoresInventario>(borrador.cantidad,
+            [&borrador](ContadoresInventario& parcial, const size_t desde, const size_t hasta) {
+                for (size_t slot = desde; slot < hasta; ++slot) {
+                    const Articulo& articulo = *borrador.articulo(slot);
+                    parcial.agregar(static_cast<std::uint8_t>(articulo.GetType()),
+                                    static_cast<std::uint8_t>(articulo.GetStatus()),
+                                    costoTotal(articulo, borrador.fechaCorte));
+                }
+            },
+            [](ContadoresInventario& total, ContadoresInventario&& bloque) { total.combinar(bloque); });
+    } else {
+        for (const auto& [slot, original] : escritura.m_tocados) {
+            if (original) borrador.contadores.quitar(original->tipo, original->estado, original->costoTotal);
+            const Articulo& articulo = *borrador.articulo(slot);
+            borrador.contadores.agregar(static_cast<std::uint8_t>(articulo.GetType()),
+                                        static_cast<std::uint8_t>(articulo.GetStatus()),
+                                        costoTotal(articulo, borrador.fechaCorte));
+        }
+    }
+
+    m_epocas.reservar(escritura.m_trozosReemplazados.size() + escritura.m_indicesReemplazados.size() +
+                      escritura.m_articulosReemplazados.size() + 2);
+
+    // Desde aquí nada lanza: las piezas nuevas pasan a la versión publicada
+    for (auto& trozo : escritura.m_trozosNuevos) static_cast<void>(trozo.release());
+    for (auto& trozo : escritura.m_indicesNuevos) static_cast<void>(trozo.release());
+    for (auto& articulo : escritura.m_articulosNuevos) static_cast<void>(articulo.release());
+    const Version* anterior = escritura.m_anterior;
+    m_ultimaVersion = borrador.numero;
+    m_version.store(escritura.m_borrador.release());
+
+    if (escritura.m_indice) {
+        static_cast<void>(escritura.m_indice.release());
+        m_epocas.retirar(anterior->indice);
+    }
+    for (const TrozoArticulos* trozo : escritura.m_trozosReemplazados) m_epocas.retirar(trozo);
+    for (const TrozoIndice* trozo : escritura.m_indicesReemplazados) m_epocas.retirar(trozo);
+    for (const Articulo* articulo : escritura.m_articulosReemplazados) m_epocas.retirar(articulo);
+    m_epocas.retirar(anterior);
+    m_epocas.avanzar();
+}
+
+// ---------------------------------------------------------------------------
+// LecturaInventario
+
+const Articulo& LecturaInventario::articulo(const std::size_t slot) const {
+    if (slot >= m_version->cantidad) throw std::out_of_range("[InventarioConcurrente] Slot fuera del inventario");
+    return *m_version->articulo(slot);
+}
+
+const Articulo* LecturaInventario::buscarPorCodigo(const std::string_view codigo) const {
+    const std::uint32_t slot = m_version->buscarSlot(codigo);
+    return slot == IndiceCodigos::SIN_SLOT ? nullptr : m_version->articulo(slot);
+}
+
+template <typename Predicado>
+std::vector<const Articulo*> LecturaInventario::filtrar(Predicado&& predicado) const {
+    using Parcial = std::vector<const Articulo*>;
+    return m_agregador.reducir<Parcial>(m_version->cantidad,
+        [this, &predicado](Parcial& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                const Articulo* articulo = m_version->articulo(slot);
+                if (predicado(*articulo)) parcial.push_back(articulo);
+            }
+        },
+        [](Parcial& total, Parcial&& bloque) { total.insert(total.end(), bloque.begin(), bloque.end()); });
+}
+
+std::vector<const Articulo*> LecturaInventario::filtrarPorEstado(const EstadoArticulo estado) const {
+    return filtrar([estado](const Articulo& articulo) { return articulo.GetStatus() == estado; });
+}
+
+std::vector<const Articulo*> LecturaInventario::filtrarPorTipo(const TipoArticulo tipo) const {
+    return filtrar([tipo](const Articulo& articulo) { return articulo.GetType() == tipo; });
+}
+
+std::map<std::string, int> LecturaInventario::contarEquiposPorTecnico() const {
+    using Parcial = std::unordered_map<TablaSimbolos::Id, int>;
+    const Parcial porId = m_agregador.reducir<Parcial>(m_version->cantidad,
+        [this](Parcial& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                const Articulo& articulo = *m_version->articulo(slot);
+                if (articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+                    ++parcial[static_cast<const EquipoMedico&>(articulo).getTecnicoId()];
+                }
+            }
+        },
+        [](Parcial& total, Parcial&& bloque) {
+            for (const auto& [tecnico, cantidad] : bloque) total[tecnico] += cantidad;
+        });
+
+    std::map<std::string, int> conteo;
+    const TablaSimbolos& simbolos = TablaSimbolos::global();
+    for (const auto& [tecnico, cantidad] : porId) conteo[simbolos.texto(tecnico)] = cantidad;
+    return conteo;
+}
+
+std::array<int, 256> LecturaInventario::contarPorArea(const TipoArticulo tipo) const {
+    using Parcial = std::array<int, 256>;
+    return m_agregador.reducir<Parcial>(m_version->cantidad,
+        [this, tipo](Parcial& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                const Articulo& articulo = *m_version->articulo(slot);
+                if (articulo.GetType() != tipo) continue;
+                const auto area = tipo == ArticleType::MEDICAL_EQUIPMENT
+                    ? static_cast<size_t>(static_cast<const EquipoMedico&>(articulo).getAreaUso())
+                    : static_cast<size_t>(static_cast<const MobiliarioClinico&>(articulo).getAreaUbicacion());
+                ++parcial[area];
+            }
+        },
+        [](Parcial& total, Parcial&& bloque) {
+            for (size_t area = 0; area < total.size(); ++area) total[area] += bloque[area];
+        });
+}
+
+std::map<AreaUso, int> LecturaInventario::contarEquiposPorArea() const {
+    const auto porArea = contarPorArea(ArticleType::MEDICAL_EQUIPMENT);
+    std::map<AreaUso, int> conteo;
+    for (size_t area = 0; area < porArea.size(); ++area) {
+        if (porArea[area] > 0) conteo[static_cast<AreaUso>(area)] = porArea[area];
+    }
+    return conteo;
+}
+
+std::map<AreaUbicacion, int> LecturaInventario::contarMobiliarioPorArea() const {
+    const auto porArea = contarPorArea(ArticleType::CLINICAL_FURNITURE);
+    std::map<AreaUbicacion, int> conteo;
+    for (size_t area = 0; area < porArea.size(); ++area) {
+        if (porArea[area] > 0) conteo[static_cast<AreaUbicacion>(area)] = porArea[area];
+    }
+    return conteo;
+}
+
+std::size_t LecturaInventario::obtenerCantidadPorTipo(const TipoArticulo tipo) const noexcept {
+    return m_version->contadores.cantidadPorTipo[static_cast<size_t>(tipo)];
+}
+
+std::size_t LecturaInventario::obtenerCantidadPorEstado(const EstadoArticulo estado) const noexcept {
+    return m_version->contadores.cantidadPorEstado[static_cast<size_t>(estado)];
+}
+
+double LecturaInventario::calcularCostoTotalPorCategoria(const TipoArticulo tipo) const noexcept {
+    return m_version->contadores.costoPorTipo[static_cast<size_t>(tipo)].valor();
+}
+
+std::map<TipoArticulo, double> LecturaInventario::calcularCostosPorCategoria() const {
+    std::map<TipoArticulo, double> costos;
+    for (size_t tipo = 0; tipo < ContadoresInventario::TIPOS; ++tipo) {
+        costos[static_cast<TipoArticulo>(tipo)] = m_version->contadores.costoPorTipo[tipo].valor();
+    }
+    return costos;
+}
+
+double LecturaInventario::calcularCostoTotalPorEstado(const EstadoArticulo estado) const noexcept {
+    return m_version->contadores.costoPorEstado[static_cast<size_t>(estado)].valor();
+}
+
+std::pair<double, double> LecturaInventario::obtenerCostosMinMax() const {
+    struct Extremos {
+        double minimo = std::numeric_limits<double>::infinity();
+        double maximo = -std::numeric_limits<double>::infinity();
+    };
+    const Extremos extremos = m_agregador.reducir<Extremos>(m_version->cantidad,
+        [this](Extremos& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                const double costo = m_version->articulo(slot)->GetUnitCost();
+                parcial.minimo = std::min(parcial.minimo, costo);
+                parcial.maximo = std::max(parcial.maximo, costo);
+            }
+        },
+        [](Extremos& total, Extremos&& bloque) {
+            total.minimo = std::min(total.minimo, bloque.minimo);
+            total.maximo = std::max(total.maximo, bloque.maximo);
+        });
+    if (m_version->cantidad == 0) return {0.0, 0.0};
+    return {extremos.minimo, extremos.maximo};
+}
+
+double LecturaInventario::calcularDepreciacionTotal() const {
+    const SumaCompensada total = m_agregador.reducir<SumaCompensada>(m_version->cantidad,
+        [this](SumaCompensada& parcial, const size_t desde, const size_t hasta) {
+            for (size_t slot = desde; slot < hasta; ++slot) {
+                const Articulo& articulo = *m_version->articulo(slot);
+                if (articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+                    parcial.sumar(static_cast<const EquipoMedico&>(articulo).calcularDepreciacion(m_version->fechaCorte));
+                }
+            }
+        },
+        [](SumaCompensada& suma, SumaCompensada&& bloque) { suma.sumar(bloque.valor()); });
+    return total.valor();
+}
+
+// ---------------------------------------------------------------------------
+// EscrituraInventario
+
+EscrituraInventario::EscrituraInventario(InventarioConcurrente& inventario)
+    : m_inventario(inventario),
+      m_anterior(inventario.m_version.load()),
+      m_borrador(std::make_unique<InventarioConcurrente::Version>(*m_anterior)) {
+    m_borrador->numero = inventario.m_ultimaVersion + 1;
+}
+
+EscrituraInventario::~EscrituraInventario() = default;
+
+const Articulo* EscrituraInventario::buscarPorCodigo(const std::string_view codigo) const {
+    const std::uint32_t slot = m_borrador->buscarSlot(codigo);
+    return slot == IndiceCodigos::SIN_SLOT ? nullptr : m_borrador->articulo(slot);
+}
+
+// Trozo que contiene 'slot', copiado al borrador la primera vez que se toca
+InventarioConcurrente::TrozoArticulos& EscrituraInventario::trozoPropio(const std::size_t slot) {
+    using Trozo = InventarioConcurrente::TrozoArticulos;
+    const size_t indice = slot / InventarioConcurrente::ARTICULOS_POR_TROZO;
+    if (indice == m_borrador->trozos.size()) {
+        reservarUnoMas(m_borrador->trozos);
+        m_trozosNuevos.push_back(std::make_unique<Trozo>());
+        m_trozosNuevos.back()->version = m_borrador->numero;
+        m_borrador->trozos.push_back(m_trozosNuevos.back().get());
+    }
+    const Trozo* actual = m_borrador->trozos[indice];
+    if (actual->version != m_borrador->numero) {
+        reservarUnoMas(m_trozosReemplazados);
+        m_trozosNuevos.push_back(std::make_unique<Trozo>(*actual));
+        m_trozosNuevos.back()->version = m_borrador->numero;
+        m_borrador->trozos[indice] = m_trozosNuevos.back().get();
+        m_trozosReemplazados.push_back(actual);
+    }
+    return const_cast<Trozo&>(*m_borrador->trozos[indice]);  // propio del borrador
+}
+
+InventarioConcurrente::TrozoIndice& EscrituraInventario::indicePropio(const std::size_t particion) {
+    using Trozo = InventarioConcurrente::TrozoIndice;
+    if (!m_indice) {
+        m_indice = std::make_unique<InventarioConcurrente::DirectorioIndice>(*m_anterior->indice);
+        m_indice->version = m_borrador->numero;
+        m_borrador->indice = m_indice.get();
+    }
+    const Trozo* actual = m_indice->trozos[particion];
+    if (!actual || actual->version != m_borrador->numero) {
+        reservarUnoMas(m_indicesReemplazados);
+        m_indicesNuevos.push_back(actual ? std::make_unique<Trozo>(*actual) : std::make_unique<Trozo>());
+        m_indicesNuevos.back()->version = m_borrador->numero;
+        m_indice->trozos[particion] = m_indicesNuevos.back().get();
+        if (actual) m_indicesReemplazados.push_back(actual);
+    }
+    return const_cast<Trozo&>(*m_indice->trozos[particion]);
+}
+
+// Las reservas van primero: si algo lanza, el borrador sigue coherente
+bool EscrituraInventario::insertar(std::unique_ptr<Articulo> articulo) {
+    if (buscarPorCodigo(articulo->GetCode())) return false;
+    const auto slot = static_cast<std::uint32_t>(m_borrador->cantidad);
+    InventarioConcurrente::TrozoArticulos& trozo = trozoPropio(slot);
+    IndiceCodigos& indice = indicePropio(InventarioConcurrente::trozoDeCodigo(articulo->GetCode())).indice;
+    indice.reservar(indice.size() + 1);
+    reservarUnoMas(m_articulosNuevos);
+    m_tocados.emplace(slot, std::nullopt);
+
+    articulo->AttachObserver(nullptr, slot);
+    indice.insertar(articulo->GetCode(), slot);
+    trozo.articulos[slot % InventarioConcurrente::ARTICULOS_POR_TROZO] = articulo.get();
+    m_articulosNuevos.push_back(std::move(articulo));
+    ++m_borrador->cantidad;
+    return true;
+}
+
+bool EscrituraInventario::agregarArticulo(EquipoMedico&& equipo) {
+    return insertar(std::make_unique<EquipoMedico>(std::move(equipo)));
+}
+
+bool EscrituraInventario::agregarArticulo(MobiliarioClinico&& mobiliario) {
+    return insertar(std::make_unique<MobiliarioClinico>(std::move(mobiliario)));
+}
+
+Articulo& EscrituraInventario::editar(const std::size_t slot) {
+    if (slot >= m_borrador->cantidad) throw std::out_of_range("[InventarioConcurrente] Slot fuera del inventario");
+    const auto clave = static_cast<std::uint32_t>(slot);
+    const Articulo* actual = m_borrador->articulo(slot);
+    if (m_tocados.count(clave)) return const_cast<Articulo&>(*actual);  // ya es copia del borrador
+
+    std::unique_ptr<Articulo> copia = copiar(*actual);
+    copia->AttachObserver(nullptr, clave);
+    InventarioConcurrente::TrozoArticulos& trozo = trozoPropio(slot);
+    reservarUnoMas(m_articulosNuevos);
+    reservarUnoMas(m_articulosReemplazados);
+    m_tocados.emplace(clave, Original{static_cast<std::uint8_t>(actual->GetType()),
+                                      static_cast<std::uint8_t>(actual->GetStatus()),
+                                      costoTotal(*actual, m_borrador->fechaCorte)});
+
+    Articulo& editable = *copia;
+    trozo.articulos[slot % InventarioConcurrente::ARTICULOS_POR_TROZO] = copia.get();
+    m_articulosNuevos.push_back(std::move(copia));
+    m_articulosReemplazados.push_back(actual);
+    return editable;
+}
+
+Articulo* EscrituraInventario::editar(const std::string_view codigo) {
+    const std::uint32_t slot = m_borrador->buscarSlot(codigo);
+    return slot == IndiceCodigos::SIN_SLOT ? nullptr : &editar(slot);
+}
+
+void EscrituraInventario::actualizarFechaCorte(const FechaCorte& corte) noexcept {
+    m_borrador->fechaCorte = corte;
+    m_fechaCambiada = true;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file inventario_por_areas.cpp
+ * @brief Implementation of the inventory partitioned by hospital area
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/inventario_por_areas.hpp"
+#include "../include/suma_compensada.hpp"
+
+using MedicalInventory::Domain::ArticleType;
+
+AreaHospital InventarioPorAreas::areaDe(const AreaUso area) noexcept {
+    switch (area) {
+        case AreaUso::PEDIATRIA: return AreaHospital::PEDIATRIA;
+        case AreaUso::QUIROFANO: return AreaHospital::QUIROFANO;
+        default: return AreaHospital::EMERGENCIA;
+    }
+}
+
+AreaHospital InventarioPorAreas::areaDe(const AreaUbicacion area) noexcept {
+    switch (area) {
+        case AreaUbicacion::EMERGENCIA: return AreaHospital::EMERGENCIA;
+        case AreaUbicacion::QUIROFANO: return AreaHospital::QUIROFANO;
+        default: return AreaHospital::CONSULTA;
+    }
+}
+
+AreaHospital InventarioPorAreas::areaDe(const Articulo& articulo) noexcept {
+    if (articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+        return areaDe(static_cast<const EquipoMedico&>(articulo).getAreaUso());
+    }
+    return areaDe(static_cast<const MobiliarioClinico&>(articulo).getAreaUbicacion());
+}
+
+// Área que contiene el código o AREAS si no está en ninguna
+std::size_t InventarioPorAreas::areaConCodigo(const std::string_view codigo) const {
+    std::size_t area = 0;
+    while (area < AREAS && !m_areas[area].existeCodigo(codigo)) ++area;
+    return area;
+}
+
+// Un hilo por área solo si ninguna llega sola al umbral: las que llegan
+// reparten ya sus propios bloques entre todos los núcleos, y anidar ambos
+// repartos lanzaría hasta AREAS veces más hilos que núcleos
+bool InventarioPorAreas::areasEnParalelo() const noexcept {
+    if (obtenerCantidadTotal() < m_agregador.umbral()) return false;
+    for (const Inventario& inventario : m_areas) {
+        if (inventario.obtenerCantidadTotal() >= inventario.obtenerUmbralParalelo()) return false;
+    }
+    return true;
+}
+
+void InventarioPorAreas::agregarArticulo(std::unique_ptr<Articulo> articulo) {
+    if (!articulo) return;
+    if (articulo->GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+        agregarArticulo(std::move(static_cast<EquipoMedico&>(*articulo)));
+    } else {
+        agregarArticulo(std::move(static_cast<MobiliarioClinico&>(*articulo)));
+    }
+}
+
+void InventarioPorAreas::agregarArticulo(EquipoMedico&& equipo) {
+    sincronizarAreas();
+    if (existeCodigo(equipo.GetCode())) return;
+    inventarioDe(areaDe(equipo.getAreaUso())).agregarArticulo(std::move(equipo));
+}
+
+void InventarioPorAreas::agregarArticulo(MobiliarioClinico&& mobiliario) {
+    sincronizarAreas();
+    if (existeCodigo(mobiliario.GetCode())) return;
+    inventarioDe(areaDe(mobiliario.getAreaUbicacion())).agregarArticulo(std::move(mobiliario));
+}
+
+bool InventarioPorAreas::eliminarArticulo(const std::string_view codigo) {
+    sincronizarAreas();
+    const std::size_t area = areaConCodigo(codigo);
+    return area < AREAS && m_areas[area].eliminarArticulo(codigo);
+}
+
+bool InventarioPorAreas::cambiarArea(const std::string_view codigo, const AreaUso area) {
+    Articulo* articulo = buscarPorCodigo(codigo);
+    if (articulo == nullptr || articulo->GetType() != ArticleType::MEDICAL_EQUIPMENT) return false;
+    static_cast<EquipoMedico*>(articulo)->setAreaUso(area);
+    sincronizarAreas();
+    return true;
+}
+
+bool InventarioPorAreas::cambiarArea(const std::string_view codigo, const AreaUbicacion area) {
+    Articulo* articulo = buscarPorCodigo(codigo);
+    if (articulo == nullptr || articulo->GetType() != ArticleType::CLINICAL_FURNITURE) return false;
+    static_cast<MobiliarioClinico*>(articulo)->setAreaUbicacion(area);
+    sincronizarAreas();
+    return true;
+}
+
+// Cada inventario anota los slots cuya área cambió; solo esos se revisan
+std::size_t InventarioPorAreas::sincronizarAreas() {
+    std::size_t trasladados = 0;
+    for (std::size_t origen = 0; origen < AREAS; ++origen) {
+        for (const Articulo* articulo : m_areas[origen].extraerReubicados()) {
+            const auto destino = static_cast<std::size_t>(areaDe(*articulo));
+            if (destino == origen) continue;
+            // El traslado destruye el original: el código se copia antes
+            const std::string codigo = articulo->GetCode();
+            if (m_areas[origen].trasladarArticulo(codigo, m_areas[destino])) ++trasladados;
+        }
+    }
+    return trasladados;
+}
+
+void InventarioPorAreas::configurarUmbralParalelo(const std::size_t umbral) noexcept {
+    m_agregador.configurarUmbral(umbral);
+    for (Inventario& inventario : m_areas) inventario.configurarUmbralParalelo(umbral);
+}
+
+void InventarioPorAreas::actualizarFechaCorte(const FechaCorte& corte) {
+    sincronizarAreas();
+    const auto tarea = [this, &corte](const std::size_t area) { m_areas[area].actualizarFechaCorte(corte); };
+    if (areasEnParalelo()) {
+        m_agregador.ejecutar(AREAS, tarea);
+    } else {
+        for (std::size_t area = 0; area < AREAS; ++area) tarea(area);
+    }
+}
+
+Articulo* InventarioPorAreas::buscarPorCodigo(const std::string_view codigo) const {
+    const std::string clave(codigo);
+    for (const Inventario& inventario : m_areas) {
+        if (Articulo* articulo = inventario.buscarPorCodigo(clave)) return articulo;
+    }
+    return nullptr;
+}
+
+bool InventarioPorAreas::existeCodigo(const std::string_view codigo) const {
+    return areaConCodigo(codigo) < AREAS;
+}
+
+std::vector<Articulo*> InventarioPorAreas::concatenar(std::array<std::vector<Articulo*>, AREAS>&& partes) {
+    size_t total = 0;
+    for (const auto& parte : partes) total += parte.size();
+    std::vector<Articulo*> resultado;
+    resultado.reserve(total);
+    for (const auto& parte : partes) resultado.insert(resultado.end(), parte.begin(), parte.end());
+    return resultado;
+}
+
+std::vector<Articulo*> InventarioPorAreas::obtenerTodosLosArticulos() const {
+    return concatenar(consultarAreas<std::vector<Articulo*>>(
+        [](const Inventario& inventario) { return inventario.obtenerTodosLosArticulos(); }));
+}
+
+std::vector<Articulo*> InventarioPorAreas::filtrarPorEstado(const EstadoArticulo estado) const {
+    return concatenar(consultarAreas<std::vector<Articulo*>>(
+        [estado](const Inventario& inventario) { return inventario.filtrarPorEstado(estado); }));
+}
+
+std::vector<Articulo*> InventarioPorAreas::filtrarPorTipo(const TipoArticulo tipo) const {
+    return concatenar(consultarAreas<std::vector<Articulo*>>(
+        [tipo](const Inventario& inventario) { return inventario.filtrarPorTipo(tipo); }));
+}
+
+// Los conteos y costos por tipo o estado ya están al día en cada área
+size_t InventarioPorAreas::obtenerCantidadTotal() const noexcept {
+    size_t total = 0;
+    for (const Inventario& inventario : m_areas) total += inventario.obtenerCantidadTotal();
+    return total;
+}
+
+size_t InventarioPorAreas::obtenerCantidadPorTipo(const TipoArticulo tipo) const {
+    size_t total = 0;
+    for (const Inventario& inventario : m_areas) total += inventario.obtenerCantidadPorTipo(tipo);
+    return total;
+}
+
+size_t InventarioPorAreas::obtenerCantidadPorEstado(const EstadoArticulo estado) const {
+    size_t total = 0;
+    for (const Inventario& inventario : m_areas) total += inventario.obtenerCantidadPorEstado(estado);
+    return total;
+}
+
+double InventarioPorAreas::calcularCostoTotalPorCategoria(const TipoArticulo tipo) const {
+    SumaCompensada total;
+    for (const Inventario& inventario : m_areas) total.sumar(inventario.calcularCostoTotalPorCategoria(tipo));
+    return total.valor();
+}
+
+double InventarioPorAreas::calcularCostoTotalPorEstado(const EstadoArticulo estado) const {
+    SumaCompensada total;
+    for (const Inventario& inventario : m_areas) total.sumar(inventario.calcularCostoTotalPorEstado(estado));
+    return total.valor();
+}
+
+double InventarioPorAreas::calcularDepreciacionTotal() const {
+    const auto porArea = consultarAreas<double>(
+        [](const Inventario& inventario) { return inventario.calcularDepreciacionTotal(); });
+    SumaCompensada total;
+    for (const double depreciacion : porArea) total.sumar(depreciacion);
+    return total.valor();
+}
+
+// Ante empates gana el área anterior, como el primer slot en Inventario
+ResumenCostos InventarioPorAreas::obtenerResumenCostos(const CriterioCosto criterio) const {
+    const auto porArea = consultarAreas<ResumenCostos>(
+        [criterio](const Inventario& inventario) { return inventario.obtenerResumenCostos(criterio); });
+    ResumenCostos resumen;
+    for (const ResumenCostos& parcial : porArea) {
+        if (parcial.masBarato == nullptr) continue;
+        if (resumen.masBarato == nullptr || parcial.minimo < resumen.minimo) {
+            resumen.minimo = parcial.minimo;
+            resumen.masBarato = parcial.masBarato;
+        }
+        if (resumen.masCaro == nullptr || parcial.maximo > resumen.maximo) {
+            resumen.maximo = parcial.maximo;
+            resumen.masCaro = parcial.masCaro;
+        }
+    }
+    return resumen;
+}
+
+// Un técnico puede tener equipos en varias áreas: el ranking de cada una
+// no basta y se combinan los conteos
+std::string InventarioPorAreas::obtenerTecnicoConMasEquipos() const {
+    std::string mejor;
+    int maximo = 0;
+    for (const auto& [tecnico, cantidad] : contarEquiposPorTecnico()) {
+        if (cantidad > maximo) {
+            mejor = tecnico;
+            maximo = cantidad;
+        }
+    }
+    return mejor;
+}
+
+std::map<std::string, int> InventarioPorAreas::contarEquiposPorTecnico() const {
+    std::map<std::string, int> conteo;
+    for (const Inventario& inventario : m_areas) {
+        for (const auto& [tecnico, cantidad] : inventario.contarEquiposPorTecnico()) conteo[tecnico] += cantidad;
+    }
+    return conteo;
+}
+
+std::map<std::string, double> InventarioPorAreas::calcularValorTotalPorTecnico() const {
+    const auto porArea = consultarAreas<std::map<std::string, double>>(
+        [](const Inventario& inventario) { return inventario.calcularValorTotalPorTecnico(); });
+    std::map<std::string, SumaCompensada> sumas;
+    for (const auto& valores : porArea) {
+        for (const auto& [tecnico, valor] : valores) sumas[tecnico].sumar(valor);
+    }
+    std::map<std::string, double> valores;
+    for (const auto& [tecnico, suma] : sumas) valores.emplace_hint(valores.end(), tecnico, suma.valor());
+    return valores;
+}
+
+// Cada área solo guarda sus artículos: basta con los contadores por tipo
+std::map<AreaUso, int> InventarioPorAreas::contarEquiposPorArea() const {
+    std::map<AreaUso, int> conteo;
+    for (const AreaUso uso : {AreaUso::EMERGENCIA, AreaUso::PEDIATRIA, AreaUso::QUIROFANO}) {
+        const size_t cantidad = area(areaDe(uso)).obtenerCantidadPorTipo(ArticleType::MEDICAL_EQUIPMENT);
+        if (cantidad > 0) conteo[uso] = static_cast<int>(cantidad);
+    }
+    return conteo;
+}
+
+std::map<AreaUbicacion, int> InventarioPorAreas::contarMobiliarioPorArea() const {
+    std::map<AreaUbicacion, int> conteo;
+    for (const AreaUbicacion ubicacion : {AreaUbicacion::CONSULTA, AreaUbicacion::EMERGENCIA, AreaUbicacion::QUIROFANO}) {
+        const size_t cantidad = area(areaDe(ubicacion)).obtenerCantidadPorTipo(ArticleType::CLINICAL_FURNITURE);
+        if (cantidad > 0) conteo[ubicacion] = static_cast<int>(cantidad);
+    }
+    return conteo;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file kernels_costos.cpp
+ * @brief Implementation of the vectorized cost kernels
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/kernels_costos.hpp"
+
+// En x86-64 SSE2 siempre está disponible; AVX se elige al ejecutar
+// (GCC/Clang) o al compilar (MSVC con /arch:AVX)
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define KERNELS_COSTOS_X86 1
+#if defined(__GNUC__) || defined(__clang__)
+#define KERNELS_COSTOS_DESPACHO 1
+#define KERNELS_COSTOS_DESTINO(isa) __attribute__((target(isa)))
+#else
+#define KERNELS_COSTOS_DESTINO(isa)
+#endif
+#endif
+
+namespace {
+    using Kernel = ExtremosCostos (*)(const double*, std::size_t) noexcept;
+
+    void completarEscalar(ExtremosCostos& r, const double* costos, std::size_t desde,
+                          const std::size_t cantidad) noexcept {
+        for (; desde < cantidad; ++desde) {
+            if (costos[desde] < r.minimo) {
+                r.minimo = costos[desde];
+                r.indiceMinimo = desde;
+            }
+            if (costos[desde] > r.maximo) {
+                r.maximo = costos[desde];
+                r.indiceMaximo = desde;
+            }
+        }
+    }
+
+#if defined(KERNELS_COSTOS_X86)
+    // Reducción entre carriles (empate: la posición más baja) y cola escalar
+    ExtremosCostos reducir(const double* minimos, const double* maximos, const double* posMin,
+                           const double* posMax, const std::size_t carriles, const double* costos,
+                           const std::size_t desde, const std::size_t cantidad) noexcept {
+        ExtremosCostos r;
+        r.minimo = minimos[0];
+        r.maximo = maximos[0];
+        r.indiceMinimo = static_cast<std::size_t>(posMin[0]);
+        r.indiceMaximo = static_cast<std::size_t>(posMax[0]);
+        for (std::size_t c = 1; c < carriles; ++c) {
+            const auto iMin = static_cast<std::size_t>(posMin[c]);
+            const auto iMax = static_cast<std::size_t>(posMax[c]);
+            if (minimos[c] < r.minimo || (minimos[c] == r.minimo && iMin < r.indiceMinimo)) {
+                r.minimo = minimos[c];
+                r.indiceMinimo = iMin;
+            }
+            if (maximos[c] > r.maximo || (maximos[c] == r.maximo && iMax < r.indiceMaximo)) {
+                r.maximo = maximos[c];
+                r.indiceMaximo = iMax;
+            }
+        }
+        completarEscalar(r, costos, desde, cantidad);
+        return r;
+    }
+
+    // Las posiciones se llevan como double (exactas hasta 2^53) para poder
+    // seleccionarlas con la máscara de la comparación (and/andnot/or: GCC
+    // convierte blendv en saltos por carril fuera de -mavx). Los valores se
+    // acumulan con min/max, que no esperan a la máscara, y con dos
+    // acumuladores por extremo: cada iteración no encadena con la anterior
+    KERNELS_COSTOS_DESTINO("avx")
+    inline __m256d elegir(const __m256d mascara, const __m256d si, const __m256d no) noexcept {
+        return _mm256_or_pd(_mm256_and_pd(mascara, si), _mm256_andnot_pd(mascara, no));
+    }
+
+    KERNELS_COSTOS_DESTINO("avx")
+    ExtremosCostos extremosAvx(const double* costos, const std::size_t cantidad) noexcept {
+        constexpr std::size_t CARRILES = 8;
+        if (cantidad < 2 * CARRILES) return KernelsCostos::calcularExtremosEscalar(costos, cantidad);
+
+        __m256d vMinA = _mm256_loadu_pd(costos);
+        __m256d vMinB = _mm256_loadu_pd(costos + 4);
+        __m256d vMaxA = vMinA;
+        __m256d vMaxB = vMinB;
+        __m256d iActualA = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+        __m256d iActualB = _mm256_set_pd(7.0, 6.0, 5.0, 4.0);
+        __m256d iMinA = iActualA, iMaxA = iActualA;
+        __m256d iMinB = iActualB, iMaxB = iActualB;
+        const __m256d paso = _mm256_set1_pd(static_cast<double>(CARRILES));
+        std::size_t i = CARRILES;
+        for (; i + CARRILES <= cantidad; i += CARRILES) {
+            const __m256d a = _mm256_loadu_pd(costos + i);
+            const __m256d b = _mm256_loadu_pd(costos + i + 4);
+            iActualA = _mm256_add_pd(iActualA, paso);
+            iActualB = _mm256_add_pd(iActualB, paso);
+            iMinA = elegir(_mm256_cmp_pd(a, vMinA, _CMP_LT_OQ), iActualA, iMinA);
+            iMinB = elegir(_mm256_cmp_pd(b, vMinB, _CMP_LT_OQ), iActualB, iMinB);
+            iMaxA = elegir(_mm256_cmp_pd(a, vMaxA, _CMP_GT_OQ), iActualA, iMaxA);
+            iMaxB = elegir(_mm256_cmp_pd(b, vMaxB, _CMP_GT_OQ), iActualB, iMaxB);
+            vMinA = _mm256_min_pd(a, vMinA);
+            vMinB = _mm256_min_pd(b, vMinB);
+            vMaxA = _mm256_max_pd(a, vMaxA);
+            vMaxB = _mm256_max_pd(b, vMaxB);
+        }
+        alignas(32) double minimos[CARRILES], maximos[CARRILES], posMin[CARRILES], posMax[CARRILES];
+        _mm256_store_pd(minimos, vMinA);
+        _mm256_store_pd(minimos + 4, vMinB);
+        _mm256_store_pd(maximos, vMaxA);
+        _mm256_store_pd(maximos + 4, vMaxB);
+        _mm256_store_pd(posMin, iMinA);
+        _mm256_store_pd(posMin + 4, iMinB);
+        _mm256_store_pd(posMax, iMaxA);
+        _mm256_store_pd(posMax + 4, iMaxB);
+        return reducir(minimos, maximos, posMin, posMax, CARRILES, costos, i, cantidad);
+    }
+
+    inline __m128d elegir(const __m128d mascara, const __m128d si, const __m128d no) noexcept {
+        return _mm_or_pd(_mm_and_pd(mascara, si), _mm_andnot_pd(mascara, no));
+    }
+
+    // El mismo esquema con registros de 128 bits
+    ExtremosCostos extremosSse2(const double* costos, const std::size_t cantidad) noexcept {
+        constexpr std::size_t CARRILES = 4;
+        if (cantidad < 2 * CARRILES) return KernelsCostos::calcularExtremosEscalar(costos, cantidad);
+
+        __m128d vMinA = _mm_loadu_pd(costos);
+        __m128d vMinB = _mm_loadu_pd(costos + 2);
+        __m128d vMaxA = vMinA;
+        __m128d vMaxB = vMinB;
+        __m128d iActualA = _mm_set_pd(1.0, 0.0);
+        __m128d iActualB = _mm_set_pd(3.0, 2.0);
+        __m128d iMinA = iActualA, iMaxA = iActualA;
+        __m128d iMinB = iActualB, iMaxB = iActualB;
+        const __m128d paso = _mm_set1_pd(static_cast<double>(CARRILES));
+        std::size_t i = CARRILES;
+        for (; i + CARRILES <= cantidad; i += CARRILES) {
+            const __m128d a = _mm_loadu_pd(costos + i);
+            const __m128d b = _mm_loadu_pd(costos + i + 2);
+            iActualA = _mm_add_pd(iActualA, paso);
+            iActualB = _mm_add_pd(iActualB, paso);
+            iMinA = elegir(_mm_cmplt_pd(a, vMinA), iActualA, iMinA);
+            iMinB = elegir(_mm_cmplt_pd(b, vMinB), iActualB, iMinB);
+            iMaxA = elegir(_mm_cmpgt_pd(a, vMaxA), iActualA, iMaxA);
+            iMaxB = elegir(_mm_cmpgt_pd(b, vMaxB), iActualB, iMaxB);
+            vMinA = _mm_min_pd(a, vMinA);
+            vMinB = _mm_min_pd(b, vMinB);
+            vMaxA = _mm_max_pd(a, vMaxA);
+            vMaxB = _mm_max_pd(b, vMaxB);
+        }
+        alignas(16) double minimos[CARRILES], maximos[CARRILES], posMin[CARRILES], posMax[CARRILES];
+        _mm_store_pd(minimos, vMinA);
+        _mm_store_pd(minimos + 2, vMinB);
+        _mm_store_pd(maximos, vMaxA);
+        _mm_store_pd(maximos + 2, vMaxB);
+        _mm_store_pd(posMin, iMinA);
+        _mm_store_pd(posMin + 2, iMinB);
+        _mm_store_pd(posMax, iMaxA);
+        _mm_store_pd(posMax + 2, iMaxB);
+        return reducir(minimos, maximos, posMin, posMax, CARRILES, costos, i, cantidad);
+    }
+#endif
+
+    struct Variante {
+        Kernel kernel;
+        const char* nombre;
+    };
+
+    // Se decide una vez, con lo que ofrece el procesador que ejecuta
+    Variante elegirVariante() noexcept {
+#if defined(KERNELS_COSTOS_DESPACHO)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx")) return {extremosAvx, "avx"};
+        return {extremosSse2, "sse2"};
+#elif defined(KERNELS_COSTOS_X86) && defined(__AVX__)
+        return {extremosAvx, "avx"};
+#elif defined(KERNELS_COSTOS_X86)
+        return {extremosSse2, "sse2"};
+#else
+        return {KernelsCostos::calcularExtremosEscalar, "escalar"};
+#endif
+    }
+
+    const Variante& variante() noexcept {
+        static const Variante elegida = elegirVariante();
+        return elegida;
+    }
+}
+
+ExtremosCostos KernelsCostos::calcularExtremosEscalar(const double* costos, const std::size_t cantidad) noexcept {
+    ExtremosCostos r;
+    if (cantidad == 0) return r;
+    r.minimo = r.maximo = costos[0];
+    completarEscalar(r, costos, 1, cantidad);
+    return r;
+}
+
+ExtremosCostos KernelsCostos::calcularExtremos(const double* costos, const std::size_t cantidad) noexcept {
+    return variante().kernel(costos, cantidad);
+}
+
+const char* KernelsCostos::varianteActiva() noexcept {
+    return variante().nombre;
+}
@@ -0,0 +1,334 @@
+/**
+ * @file mapa_bits.cpp
+ * @brief Implementation of the compressed slot bitmap
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/mapa_bits.hpp"
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+namespace {
+    std::size_t contarBits(const std::uint64_t palabra) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(palabra));
+#else
+        std::uint64_t v = palabra - ((palabra >> 1) & 0x5555555555555555ull);
+        v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<std::size_t>((v * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    bool bitActivo(const std::vector<std::uint64_t>& palabras, const std::uint16_t valor) noexcept {
+        return (palabras[valor >> 6] >> (valor & 63)) & 1u;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Contenedor
+
+bool MapaBits::Contenedor::contiene(const std::uint16_t valor) const noexcept {
+    if (esMapa()) return bitActivo(palabras, valor);
+    return std::binary_search(arreglo.begin(), arreglo.end(), valor);
+}
+
+void MapaBits::Contenedor::agregar(const std::uint16_t valor) {
+    if (esMapa()) {
+        std::uint64_t& palabra = palabras[valor >> 6];
+        const std::uint64_t bit = std::uint64_t{1} << (valor & 63);
+        if ((palabra & bit) == 0) {
+            palabra |= bit;
+            ++cantidad;
+        }
+        return;
+    }
+    // Las altas llegan casi siempre en orden de slot: agregar al final
+    auto it = arreglo.end();
+    if (arreglo.empty() || arreglo.back() < valor) {
+        arreglo.push_back(valor);
+        it = arreglo.end() - 1;
+    } else {
+        it = std::lower_bound(arreglo.begin(), arreglo.end(), valor);
+        if (*it == valor) return;
+        it = arreglo.insert(it, valor);
+    }
+    if (arreglo.size() > UMBRAL_ARREGLO) {
+        try {
+            aMapa();
+        } catch (...) {
+            arreglo.erase(it);
+            throw;
+        }
+    }
+    ++cantidad;
+}
+
+void MapaBits::Contenedor::quitar(const std::uint16_t valor) noexcept {
+    if (esMapa()) {
+        std::uint64_t& palabra = palabras[valor >> 6];
+        const std::uint64_t bit = std::uint64_t{1} << (valor & 63);
+        if ((palabra & bit) == 0) return;
+        palabra &= ~bit;
+        --cantidad;
+        // Histéresis: no alternar de representación en cada alta y baja
+        if (cantidad <= UMBRAL_ARREGLO / 2) {
+            try {
+                aArreglo();
+            } catch (const std::bad_alloc&) {
+                // Sigue como mapa; la próxima baja lo vuelve a intentar
+            }
+        }
+        return;
+    }
+    const auto it = std::lower_bound(arreglo.begin(), arreglo.end(), valor);
+    if (it == arreglo.end() || *it != valor) return;
+    arreglo.erase(it);
+    --cantidad;
+}
+
+void MapaBits::Contenedor::aMapa() {
+    std::vector<std::uint64_t> nuevas(PALABRAS, 0);
+    for (const std::uint16_t valor : arreglo) nuevas[valor >> 6] |= std::uint64_t{1} << (valor & 63);
+    palabras.swap(nuevas);
+    std::vector<std::uint16_t>().swap(arreglo);
+}
+
+void MapaBits::Contenedor::aArreglo() {
+    std::vector<std::uint16_t> valores;
+    valores.reserve(cantidad);
+    for (std::size_t p = 0; p < PALABRAS; ++p) {
+        std::uint64_t palabra = palabras[p];
+        while (palabra != 0) {
+            valores.push_back(static_cast<std::uint16_t>(p * 64 + contarCerosFinales(palabra)));
+            palabra &= palabra - 1;
+        }
+    }
+    arreglo.swap(valores);
+    std::vector<std::uint64_t>().swap(palabras);
+}
+
+void MapaBits::Contenedor::ajustar() {
+    if (esMapa() && cantidad <= UMBRAL_ARREGLO) aArreglo();
+    else if (!esMapa() && cantidad > UMBRAL_ARREGLO) aMapa();
+}
+
+// ---------------------------------------------------------------------------
+// MapaBits
+
+void MapaBits::agregar(const std::uint32_t valor) {
+    const auto alto = static_cast<std::uint16_t>(valor >> 16);
+    const auto bajo = static_cast<std::uint16_t>(valor);
+    // Un contenedor nuevo se crea con su primer valor y solo entonces se
+    // inserta: si algo falla no queda uno vacío
+    const auto nuevo = [bajo] {
+        Contenedor contenedor;
+        contenedor.agregar(bajo);
+        return contenedor;
+    };
+    if (m_claves.empty() || m_claves.back() < alto) {
+        m_contenedores.push_back(nuevo());
+        try {
+            m_claves.push_back(alto);
+        } catch (...) {
+            m_contenedores.pop_back();
+            throw;
+        }
+        return;
+    }
+    const auto it = std::lower_bound(m_claves.begin(), m_claves.end(), alto);
+    const auto i = static_cast<std::size_t>(it - m_claves.begin());
+    if (*it == alto) {
+        m_contenedores[i].agregar(bajo);
+        return;
+    }
+    const auto contenedor = m_contenedores.insert(m_contenedores.begin() + static_cast<std::ptrdiff_t>(i), nuevo());
+    try {
+        m_claves.insert(it, alto);
+    } catch (...) {
+        m_contenedores.erase(contenedor);
+        throw;
+    }
+}
+
+void MapaBits::quitar(const std::uint32_t valor) noexcept {
+    const auto alto = static_cast<std::uint16_t>(valor >> 16);
+    const auto it = std::lower_bound(m_claves.begin(), m_claves.end(), alto);
+    if (it == m_claves.end() || *it != alto) return;
+    const auto i = static_cast<std::size_t>(it - m_claves.begin());
+    m_contenedores[i].quitar(static_cast<std::uint16_t>(valor));
+    if (m_contenedores[i].cantidad == 0) {
+        m_contenedores.erase(m_contenedores.begin() + static_cast<std::ptrdiff_t>(i));
+        m_claves.erase(it);
+    }
+}
+
+bool MapaBits::contiene(const std::uint32_t valor) const noexcept {
+    const auto alto = static_cast<std::uint16_t>(valor >> 16);
+    const auto it = std::lower_bound(m_claves.begin(), m_claves.end(), alto);
+    if (it == m_claves.end() || *it != alto) return false;
+    return m_contenedores[static_cast<std::size_t>(it - m_claves.begin())].contiene(static_cast<std::uint16_t>(valor));
+}
+
+std::size_t MapaBits::cardinalidad() const noexcept {
+    std::size_t total = 0;
+    for (const Contenedor& contenedor : m_contenedores) total += contenedor.cantidad;
+    return total;
+}
+
+void MapaBits::limpiar() noexcept {
+    m_claves.clear();
+    m_contenedores.clear();
+}
+
+std::size_t MapaBits::memoriaUsada() const noexcept {
+    std::size_t bytes = m_claves.capacity() * sizeof(std::uint16_t) + m_contenedores.capacity() * sizeof(Contenedor);
+    for (const Contenedor& contenedor : m_contenedores) {
+        bytes += contenedor.arreglo.capacity() * sizeof(std::uint16_t) +
+                 contenedor.palabras.capacity() * sizeof(std::uint64_t);
+    }
+    return bytes;
+}
+
+MapaBits::Contenedor MapaBits::interseccion(const Contenedor& a, const Contenedor& b) {
+    Contenedor resultado;
+    if (a.esMapa() && b.esMapa()) {
+        resultado.palabras.resize(PALABRAS);
+        for (std::size_t p = 0; p < PALABRAS; ++p) {
+            resultado.palabras[p] = a.palabras[p] & b.palabras[p];
+            resultado.cantidad += static_cast<std::uint32_t>(contarBits(resultado.palabras[p]));
+        }
+        resultado.ajustar();
+        return resultado;
+    }
+    if (a.esMapa() || b.esMapa()) {
+        const Contenedor& arreglo = a.esMapa() ? b : a;
+        const Contenedor& mapa = a.esMapa() ? a : b;
+        for (const std::uint16_t valor : arreglo.arreglo) {
+            if (bitActivo(mapa.palabras, valor)) resultado.arreglo.push_back(valor);
+        }
+    } else {
+        std::set_intersection(a.arreglo.begin(), a.arreglo.end(), b.arreglo.begin(), b.arreglo.end(),
+                              std::back_inserter(resultado.arreglo));
+    }
+    resultado.cantidad = static_cast<std::uint32_t>(resultado.arreglo.size());
+    return resultado;
+}
+
+void MapaBits::unir(Contenedor& destino, const Contenedor& otro) {
+    if (!destino.esMapa() && !otro.esMapa() && destino.cantidad + otro.cantidad <= UMBRAL_ARREGLO) {
+        std::vector<std::uint16_t> unidos;
+        unidos.reserve(destino.cantidad + otro.cantidad);
+        std::set_union(destino.arreglo.begin(), destino.arreglo.end(), otro.arreglo.begin(), otro.arreglo.end(),
+                       std::back_inserter(unidos));
+        destino.arreglo.swap(unidos);
+        destino.cantidad = static_cast<std::uint32_t>(destino.arreglo.size());
+        return;
+    }
+    if (!destino.esMapa()) destino.aMapa();
+    if (otro.esMapa()) {
+        destino.cantidad = 0;
+        for (std::size_t p = 0; p < PALABRAS; ++p) {
+            destino.palabras[p] |= otro.palabras[p];
+            destino.cantidad += static_cast<std::uint32_t>(contarBits(destino.palabras[p]));
+        }
+    } else {
+        for (const std::uint16_t valor : otro.arreglo) {
+            std::uint64_t& palabra = destino.palabras[valor >> 6];
+            const std::uint64_t bit = std::uint64_t{1} << (valor & 63);
+            destino.cantidad += (palabra & bit) == 0 ? 1 : 0;
+            palabra |= bit;
+        }
+    }
+    destino.ajustar();
+}
+
+std::size_t MapaBits::contarInterseccion(const Contenedor& a, const Contenedor& b) noexcept {
+    std::size_t total = 0;
+    if (a.esMapa() && b.esMapa()) {
+        for (std::size_t p = 0; p < PALABRAS; ++p) total += contarBits(a.palabras[p] & b.palabras[p]);
+    } else if (a.esMapa() || b.esMapa()) {
+        const Contenedor& arreglo = a.esMapa() ? b : a;
+        const Contenedor& mapa = a.esMapa() ? a : b;
+        for (const std::uint16_t valor : arreglo.arreglo) total += bitActivo(mapa.palabras, valor) ? 1 : 0;
+    } else {
+        auto i = a.arreglo.begin();
+        auto j = b.arreglo.begin();
+        while (i != a.arreglo.end() && j != b.arreglo.end()) {
+            if (*i < *j) {
+                ++i;
+            } else if (*j < *i) {
+                ++j;
+            } else {
+                ++total;
+                ++i;
+                ++j;
+            }
+        }
+    }
+    return total;
+}
+
+MapaBits operator&(const MapaBits& a, const MapaBits& b) {
+    MapaBits resultado;
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < a.m_claves.size(); ++i) {
+        while (j < b.m_claves.size() && b.m_claves[j] < a.m_claves[i]) ++j;
+        if (j == b.m_claves.size()) break;
+        if (b.m_claves[j] != a.m_claves[i]) continue;
+        MapaBits::Contenedor comun = MapaBits::interseccion(a.m_contenedores[i], b.m_contenedores[j]);
+        if (comun.cantidad == 0) continue;
+        resultado.m_claves.push_back(a.m_claves[i]);
+        resultado.m_contenedores.push_back(std::move(comun));
+    }
+    return resultado;
+}
+
+MapaBits& MapaBits::operator&=(const MapaBits& otro) {
+    *this = *this & otro;
+    return *this;
+}
+
+MapaBits& MapaBits::operator|=(const MapaBits& otro) {
+    std::vector<std::uint16_t> claves;
+    std::vector<Contenedor> contenedores;
+    claves.reserve(m_claves.size() + otro.m_claves.size());
+    contenedores.reserve(m_claves.size() + otro.m_claves.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < m_claves.size() || j < otro.m_claves.size()) {
+        if (j == otro.m_claves.size() || (i < m_claves.size() && m_claves[i] < otro.m_claves[j])) {
+            claves.push_back(m_claves[i]);
+            contenedores.push_back(std::move(m_contenedores[i++]));
+        } else if (i == m_claves.size() || otro.m_claves[j] < m_claves[i]) {
+            claves.push_back(otro.m_claves[j]);
+            contenedores.push_back(otro.m_contenedores[j++]);
+        } else {
+            claves.push_back(m_claves[i]);
+            contenedores.push_back(std::move(m_contenedores[i++]));
+            unir(contenedores.back(), otro.m_contenedores[j++]);
+        }
+    }
+    m_claves.swap(claves);
+    m_contenedores.swap(contenedores);
+    return *this;
+}
+
+std::size_t MapaBits::contarInterseccion(const MapaBits& a, const MapaBits& b) noexcept {
+    std::size_t total = 0;
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < a.m_claves.size() && j < b.m_claves.size(); ++i) {
+        while (j < b.m_claves.size() && b.m_claves[j] < a.m_claves[i]) ++j;
+        if (j < b.m_claves.size() && b.m_claves[j] == a.m_claves[i]) {
+            total += contarInterseccion(a.m_contenedores[i], b.m_contenedores[j]);
+        }
+    }
+    return total;
+}
+
+MapaBits operator|(MapaBits a, const MapaBits& b) {
+    a |= b;
+    return a;
+}
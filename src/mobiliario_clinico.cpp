@@ -1,5 +1,6 @@
 
 #include "../include/mobiliario_clinico.hpp"
+#include "../include/codec_enums.hpp"
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
@@ -9,37 +10,55 @@ const double MobiliarioClinico::PLUS_CONSULTA = 200.0;
 const double MobiliarioClinico::PLUS_EMERGENCIA = 300.0;
 const double MobiliarioClinico::PLUS_QUIROFANO = 500.0;
 
-MobiliarioClinico::MobiliarioClinico(const std::string& codigo, const std::string& fechaIngreso,
+MobiliarioClinico::MobiliarioClinico(const std::string_view codigo, const std::string_view fechaIngreso,
                                      const EstadoArticulo estado, const double costoUnitario, 
-                                     const std::string& material, const AreaUbicacion area)
+                                     const std::string_view material, const AreaUbicacion area)
     : Articulo(codigo, MedicalInventory::Domain::ArticleType::CLINICAL_FURNITURE, fechaIngreso, estado, costoUnitario),
-      material(material), areaUbicacion(area) {
+      materialId(TablaSimbolos::SIN_ID), areaUbicacion(area) {
     if (codigo.empty()) throw std::invalid_argument("[MobiliarioClinico] Código vacío.");
     if (fechaIngreso.empty()) throw std::invalid_argument("[MobiliarioClinico] Fecha de ingreso vacía.");
     if (costoUnitario < 0) throw std::invalid_argument("[MobiliarioClinico] Costo unitario negativo.");
     if (material.empty()) throw std::invalid_argument("[MobiliarioClinico] Material vacío.");
+    materialId = TablaSimbolos::global().internar(material);
 }
 
-std::string MobiliarioClinico::getInformacion() const {
+std::string MobiliarioClinico::GetDetailedInfo() const {
     std::ostringstream info;
     info << std::fixed << std::setprecision(2);
     info << "=== MOBILIARIO CLÍNICO ===\n"
          << "Código: " << GetCode() << '\n'
-         << "Tipo: " << tipoToString(GetType()) << '\n'
+         << "Tipo: " << TypeName(GetType()) << '\n'
          << "Fecha de Ingreso: " << GetEntryDate() << '\n'
-         << "Estado: " << estadoToString(GetStatus()) << '\n'
+         << "Estado: " << StatusName(GetStatus()) << '\n'
          << "Costo Unitario: $" << GetUnitCost() << '\n'
-         << "Material: " << material << '\n'
-         << "Área de Ubicación: " << areaUbicacionToString(areaUbicacion) << '\n'
+         << "Material: " << getMaterial() << '\n'
+         << "Área de Ubicación: " << nombreAreaUbicacion(areaUbicacion) << '\n'
          << "Plus por Área: $" << calcularPlusPorArea() << '\n'
          << "Valor Total con Plus: $" << calcularValorConPlus() << '\n';
     return info.str();
 }
 
-double MobiliarioClinico::calcularCostoTotal() const {
+// Implementación del método legacy para compatibilidad
+std::string MobiliarioClinico::getInformacion() const {
+    return GetDetailedInfo();
+}
+
+double MobiliarioClinico::CalculateTotalCost() const {
     return calcularValorConPlus();
 }
 
+// Implementación del método legacy para compatibilidad
+double MobiliarioClinico::calcularCostoTotal() const {
+    return CalculateTotalCost();
+}
+
+void MobiliarioClinico::setMaterial(const std::string& nuevoMaterial) {
+    if (nuevoMaterial.empty()) {
+        throw std::invalid_argument("[MobiliarioClinico] Material vacío.");
+    }
+    AssignAndNotify(materialId, TablaSimbolos::global().internar(nuevoMaterial), ArticleChange::MATERIAL);
+}
+
 double MobiliarioClinico::calcularPlusPorArea() const {
     return getPlusPorArea(areaUbicacion);
 }
@@ -50,19 +69,19 @@ double MobiliarioClinico::calcularValorConPlus() const {
 
 
 std::string MobiliarioClinico::areaUbicacionToString(const AreaUbicacion area) {
-    switch (area) {
-        case AreaUbicacion::CONSULTA:   return "Consulta";
-        case AreaUbicacion::EMERGENCIA: return "Emergencia";
-        case AreaUbicacion::QUIROFANO:  return "Quirófano";
-        default:                        return "Desconocido";
-    }
+    return std::string(nombreAreaUbicacion(area));
+}
+
+std::string_view MobiliarioClinico::nombreAreaUbicacion(const AreaUbicacion area) noexcept {
+    return CodecEnums::AREA_UBICACION.nombre(area);
 }
 
-AreaUbicacion MobiliarioClinico::stringToAreaUbicacion(const std::string& str) {
-    if (str == "Consulta" || str == "CONSULTA") return AreaUbicacion::CONSULTA;
-    if (str == "Emergencia" || str == "EMERGENCIA") return AreaUbicacion::EMERGENCIA;
-    if (str == "Quirófano" || str == "QUIROFANO") return AreaUbicacion::QUIROFANO;
-    throw std::invalid_argument("[MobiliarioClinico] Área de ubicación inválida: " + str);
+AreaUbicacion MobiliarioClinico::stringToAreaUbicacion(const std::string_view str) {
+    AreaUbicacion area{};
+    if (!CodecEnums::AREA_UBICACION.parsear(str, area)) {
+        throw std::invalid_argument("[MobiliarioClinico] Área de ubicación inválida: " + std::string(str));
+    }
+    return area;
 }
 
 double MobiliarioClinico::getPlusPorArea(const AreaUbicacion area) {
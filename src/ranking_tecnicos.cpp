@@ -0,0 +1,111 @@
+/**
+ * @file ranking_tecnicos.cpp
+ * @brief Implementation of the technician workload leaderboard
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/ranking_tecnicos.hpp"
+#include <queue>
+
+void RankingTecnicos::registrar(const TablaSimbolos::Id tecnico) {
+    if (tecnico < m_posiciones.size() && m_posiciones[tecnico] != SIN_POSICION) return;
+    if (tecnico >= m_posiciones.size()) {
+        m_nombres.resize(tecnico + 1, nullptr);
+        m_cantidades.resize(tecnico + 1, 0);
+        m_posiciones.resize(tecnico + 1, SIN_POSICION);
+    }
+    m_monticulo.reserve(m_monticulo.size() + 1);
+    m_nombres[tecnico] = &TablaSimbolos::global().texto(tecnico);
+    m_posiciones[tecnico] = m_monticulo.size();
+    m_monticulo.push_back(tecnico);
+    subir(m_monticulo.size() - 1);
+}
+
+void RankingTecnicos::incrementar(const TablaSimbolos::Id tecnico) noexcept {
+    ++m_cantidades[tecnico];
+    subir(m_posiciones[tecnico]);
+}
+
+void RankingTecnicos::decrementar(const TablaSimbolos::Id tecnico) noexcept {
+    --m_cantidades[tecnico];
+    bajar(m_posiciones[tecnico]);
+}
+
+std::uint32_t RankingTecnicos::primero() const noexcept {
+    if (m_monticulo.empty() || m_cantidades[m_monticulo.front()] == 0) return SIN_TECNICO;
+    return m_monticulo.front();
+}
+
+std::vector<std::pair<std::string, int>> RankingTecnicos::mejores(const std::size_t k) const {
+    std::vector<std::pair<std::string, int>> resultado;
+    if (m_monticulo.empty() || k == 0) return resultado;
+
+    // Recorrido del montículo en orden: la frontera sólo crece en 1 por paso
+    const auto peor = [this](const std::size_t a, const std::size_t b) {
+        return antes(m_monticulo[b], m_monticulo[a]);
+    };
+    std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(peor)> frontera(peor);
+    frontera.push(0);
+    while (!frontera.empty() && resultado.size() < k) {
+        const std::size_t posicion = frontera.top();
+        frontera.pop();
+        const std::uint32_t id = m_monticulo[posicion];
+        if (m_cantidades[id] == 0) break;
+        resultado.emplace_back(*m_nombres[id], m_cantidades[id]);
+        for (std::size_t hijo = 2 * posicion + 1; hijo <= 2 * posicion + 2; ++hijo) {
+            if (hijo < m_monticulo.size()) frontera.push(hijo);
+        }
+    }
+    return resultado;
+}
+
+std::vector<std::pair<std::string, int>> RankingTecnicos::todos() const {
+    std::vector<std::pair<std::string, int>> resultado;
+    for (const std::uint32_t id : m_monticulo) {
+        if (m_cantidades[id] > 0) resultado.emplace_back(*m_nombres[id], m_cantidades[id]);
+    }
+    return resultado;
+}
+
+void RankingTecnicos::limpiar() noexcept {
+    m_nombres.clear();
+    m_cantidades.clear();
+    m_posiciones.clear();
+    m_monticulo.clear();
+}
+
+// Orden del montículo: más equipos primero, empate por nombre
+bool RankingTecnicos::antes(const std::uint32_t a, const std::uint32_t b) const noexcept {
+    if (m_cantidades[a] != m_cantidades[b]) return m_cantidades[a] > m_cantidades[b];
+    return *m_nombres[a] < *m_nombres[b];
+}
+
+void RankingTecnicos::subir(std::size_t posicion) noexcept {
+    while (posicion > 0) {
+        const std::size_t padre = (posicion - 1) / 2;
+        if (!antes(m_monticulo[posicion], m_monticulo[padre])) break;
+        intercambiar(posicion, padre);
+        posicion = padre;
+    }
+}
+
+void RankingTecnicos::bajar(std::size_t posicion) noexcept {
+    const std::size_t n = m_monticulo.size();
+    while (true) {
+        std::size_t mejor = posicion;
+        const std::size_t izquierdo = 2 * posicion + 1;
+        const std::size_t derecho = izquierdo + 1;
+        if (izquierdo < n && antes(m_monticulo[izquierdo], m_monticulo[mejor])) mejor = izquierdo;
+        if (derecho < n && antes(m_monticulo[derecho], m_monticulo[mejor])) mejor = derecho;
+        if (mejor == posicion) return;
+        intercambiar(posicion, mejor);
+        posicion = mejor;
+    }
+}
+
+void RankingTecnicos::intercambiar(const std::size_t a, const std::size_t b) noexcept {
+    std::swap(m_monticulo[a], m_monticulo[b]);
+    m_posiciones[m_monticulo[a]] = a;
+    m_posiciones[m_monticulo[b]] = b;
+}
@@ -0,0 +1,323 @@
+/**
+ * @file snapshot_inventario.cpp
+ * @brief Writer and validating reader of the binary inventory snapshot
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/snapshot_inventario.hpp"
+#include "../include/codec_enums.hpp"
+#include "../include/equipo_medico.hpp"
+#include "../include/mobiliario_clinico.hpp"
+#include "../include/suma_verificacion.hpp"
+#include "../include/archivo_secuencial.hpp"
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    [[noreturn]] void corrupto(const std::string& ruta, const char* motivo) {
+        throw std::runtime_error("[SnapshotInventario] Archivo '" + ruta + "' inválido: " + motivo);
+    }
+
+    constexpr std::uint32_t SIN_TEXTO = std::numeric_limits<std::uint32_t>::max();
+
+    bool textosValidos(const RegistroSnapshot& r, const std::uint64_t tamanoHeap) noexcept {
+        const auto textoValido = [tamanoHeap](const RefTexto ref) {
+            return std::uint64_t{ref.desplazamiento} + ref.longitud <= tamanoHeap;
+        };
+        return textoValido(r.codigo) && textoValido(r.fechaIngreso) && textoValido(r.texto);
+    }
+
+    // La vida útil la exige el constructor de EquipoMedico
+    bool vidaUtilValida(const RegistroSnapshot& r) noexcept {
+        const auto equipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+        return r.tipo != equipo || r.vidaUtilAnios > 0;
+    }
+
+    bool enumeracionesValidas(const RegistroSnapshot& r) noexcept {
+        const auto equipo = static_cast<std::uint8_t>(MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT);
+        const bool esEquipo = r.tipo == equipo;
+        return r.tipo < CodecEnums::TIPO.cantidad() &&
+               r.estado < CodecEnums::ESTADO.cantidad() &&
+               (esEquipo ? r.marca < CodecEnums::MARCA.cantidad() && r.area < CodecEnums::AREA_USO.cantidad()
+                         : r.area < CodecEnums::AREA_UBICACION.cantidad());
+    }
+
+    // Referencias de texto dentro del heap y enumeraciones conocidas
+    void validarRegistros(const std::string& ruta, const unsigned char* registros, const std::size_t cantidad,
+                          const std::uint64_t tamanoHeap) {
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            RegistroSnapshot r;
+            std::memcpy(&r, registros + i * sizeof(RegistroSnapshot), sizeof r);
+            if (!textosValidos(r, tamanoHeap)) corrupto(ruta, "referencia de texto fuera del heap");
+            if (!enumeracionesValidas(r)) corrupto(ruta, "valor de enumeración desconocido");
+            if (!vidaUtilValida(r)) corrupto(ruta, "vida útil no positiva");
+        }
+    }
+
+    std::uint64_t hashCodigo(const std::string_view codigo) noexcept {
+        return sumaVerificacion(codigo.data(), codigo.size());
+    }
+
+    std::size_t alinear8(const std::size_t bytes) noexcept {
+        return (bytes + 7) & ~std::size_t{7};
+    }
+}
+
+EscritorSnapshot::EscritorSnapshot(const std::size_t cantidadEstimada) {
+    m_registros.reserve(cantidadEstimada);
+    m_heap.reserve(cantidadEstimada * 12);
+}
+
+void EscritorSnapshot::agregar(const Articulo& articulo) {
+    RegistroSnapshot registro{};
+    registro.costoUnitario = articulo.GetUnitCost();
+    registro.codigo = agregarTexto(articulo.GetCode());
+    registro.fechaIngreso = agregarSimbolo(articulo.GetEntryDateId());
+    registro.tipo = static_cast<std::uint8_t>(articulo.GetType());
+    registro.estado = static_cast<std::uint8_t>(articulo.GetStatus());
+    if (articulo.GetType() == MedicalInventory::Domain::ArticleType::MEDICAL_EQUIPMENT) {
+        const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+        registro.texto = agregarSimbolo(equipo.getTecnicoId());
+        registro.vidaUtilAnios = equipo.getVidaUtilAnios();
+        registro.marca = static_cast<std::uint8_t>(equipo.getMarca());
+        registro.area = static_cast<std::uint8_t>(equipo.getAreaUso());
+    } else {
+        const auto& mobiliario = static_cast<const MobiliarioClinico&>(articulo);
+        registro.texto = agregarSimbolo(mobiliario.getMaterialId());
+        registro.area = static_cast<std::uint8_t>(mobiliario.getAreaUbicacion());
+    }
+    m_registros.push_back(registro);
+}
+
+RefTexto EscritorSnapshot::agregarTexto(const std::string_view texto) {
+    if (m_heap.size() + texto.size() >= SIN_TEXTO) {
+        throw std::length_error("[SnapshotInventario] El heap de textos supera 4 GiB");
+    }
+    const RefTexto ref{static_cast<std::uint32_t>(m_heap.size()), static_cast<std::uint32_t>(texto.size())};
+    m_heap.append(texto);
+    return ref;
+}
+
+// Los textos internados se escriben una sola vez y se comparten entre registros
+RefTexto EscritorSnapshot::agregarSimbolo(const TablaSimbolos::Id id) {
+    if (id >= m_porSimbolo.size()) m_porSimbolo.resize(id + 1, RefTexto{SIN_TEXTO, 0});
+    if (m_porSimbolo[id].desplazamiento == SIN_TEXTO) {
+        m_porSimbolo[id] = agregarTexto(TablaSimbolos::global().texto(id));
+    }
+    return m_porSimbolo[id];
+}
+
+std::uint64_t EscritorSnapshot::escribir(const std::string& ruta, const std::uint32_t generacion) const {
+    const std::size_t bytesRegistros = m_registros.size() * sizeof(RegistroSnapshot);
+
+    CabeceraSnapshot cabecera{};
+    std::memcpy(cabecera.firma, SnapshotInventario::FIRMA, sizeof cabecera.firma);
+    cabecera.version = SnapshotInventario::VERSION;
+    cabecera.tamanoRegistro = sizeof(RegistroSnapshot);
+    cabecera.cantidadRegistros = m_registros.size();
+    cabecera.desplazamientoRegistros = sizeof(CabeceraSnapshot);
+    cabecera.desplazamientoHeap = sizeof(CabeceraSnapshot) + bytesRegistros;
+    cabecera.tamanoHeap = m_heap.size();
+    cabecera.marcaOrden = SnapshotInventario::MARCA_ORDEN;
+    cabecera.generacion = generacion;
+
+    // Índice de códigos: relleno hasta 8 bytes, cantidad de ranuras y ranuras
+    std::uint64_t cantidadRanuras = 1;
+    while (cantidadRanuras < 2 * m_registros.size()) cantidadRanuras *= 2;
+    std::vector<std::uint32_t> indice(static_cast<std::size_t>(cantidadRanuras), SnapshotInventario::SIN_SLOT);
+    for (std::size_t slot = 0; slot < m_registros.size(); ++slot) {
+        const RefTexto codigo = m_registros[slot].codigo;
+        const std::string_view texto = std::string_view(m_heap).substr(codigo.desplazamiento, codigo.longitud);
+        std::uint64_t ranura = hashCodigo(texto) & (cantidadRanuras - 1);
+        while (indice[ranura] != SnapshotInventario::SIN_SLOT) ranura = (ranura + 1) & (cantidadRanuras - 1);
+        indice[ranura] = static_cast<std::uint32_t>(slot);
+    }
+    std::string cabeceraIndice(alinear8(m_heap.size()) - m_heap.size(), '\0');
+    cabeceraIndice.append(reinterpret_cast<const char*>(&cantidadRanuras), sizeof cantidadRanuras);
+    const std::size_t bytesIndice = indice.size() * sizeof(std::uint32_t);
+
+    // Las secciones son contiguas en el archivo: la suma encadena los tramos
+    std::uint64_t suma = sumaVerificacion(m_registros.data(), bytesRegistros);
+    suma = sumaVerificacion(m_heap.data(), m_heap.size(), suma);
+    suma = sumaVerificacion(cabeceraIndice.data(), cabeceraIndice.size(), suma);
+    cabecera.sumaVerificacion = sumaVerificacion(indice.data(), bytesIndice, suma);
+
+    ArchivoSecuencial::reemplazar(ruta, {{&cabecera, sizeof cabecera},
+                                         {m_registros.data(), bytesRegistros},
+                                         {m_heap.data(), m_heap.size()},
+                                         {cabeceraIndice.data(), cabeceraIndice.size()},
+                                         {indice.data(), bytesIndice}});
+    // El delta describía cambios sobre la base anterior
+    std::remove(SnapshotInventario::rutaDelta(ruta).c_str());
+    return cabecera.sumaVerificacion;
+}
+
+void EscritorSnapshot::escribirDelta(const std::string& rutaBase, const std::vector<std::uint32_t>& slots,
+                                     const std::uint64_t cantidadTotal, const std::uint64_t sumaBase) const {
+    if (slots.size() != m_registros.size()) {
+        throw std::invalid_argument("[SnapshotInventario] Un slot por registro del delta");
+    }
+    const std::size_t bytesRegistros = m_registros.size() * sizeof(RegistroSnapshot);
+    const std::size_t bytesSlots = slots.size() * sizeof(std::uint32_t);
+    const std::uint64_t relleno = 0;
+
+    CabeceraDelta cabecera{};
+    std::memcpy(cabecera.firma, SnapshotInventario::FIRMA_DELTA, sizeof cabecera.firma);
+    cabecera.version = SnapshotInventario::VERSION_DELTA;
+    cabecera.tamanoRegistro = sizeof(RegistroSnapshot);
+    cabecera.cantidadRegistros = m_registros.size();
+    cabecera.cantidadTotal = cantidadTotal;
+    cabecera.sumaBase = sumaBase;
+    cabecera.tamanoHeap = m_heap.size();
+    cabecera.marcaOrden = SnapshotInventario::MARCA_ORDEN;
+    std::uint64_t suma = sumaVerificacion(m_registros.data(), bytesRegistros);
+    suma = sumaVerificacion(slots.data(), bytesSlots, suma);
+    cabecera.sumaVerificacion = sumaVerificacion(m_heap.data(), m_heap.size(), suma);
+
+    ArchivoSecuencial::reemplazar(SnapshotInventario::rutaDelta(rutaBase),
+                                  {{&cabecera, sizeof cabecera},
+                                   {m_registros.data(), bytesRegistros},
+                                   {slots.data(), bytesSlots},
+                                   {&relleno, alinear8(bytesSlots) - bytesSlots},
+                                   {m_heap.data(), m_heap.size()}});
+}
+
+LectorSnapshot::LectorSnapshot(const std::string& ruta, const Verificacion verificacion) : m_archivo(ruta) {
+    const unsigned char* const base = m_archivo.datos();
+    const std::size_t tamano = m_archivo.size();
+    if (tamano < sizeof(CabeceraSnapshot)) corrupto(ruta, "truncado");
+
+    CabeceraSnapshot cabecera;
+    std::memcpy(&cabecera, base, sizeof cabecera);
+    if (std::memcmp(cabecera.firma, SnapshotInventario::FIRMA, sizeof cabecera.firma) != 0) {
+        corrupto(ruta, "firma desconocida");
+    }
+    if (cabecera.marcaOrden != SnapshotInventario::MARCA_ORDEN) corrupto(ruta, "orden de bytes distinto");
+    if (cabecera.version != 1 && cabecera.version != SnapshotInventario::VERSION) {
+        corrupto(ruta, "versión no soportada");
+    }
+    if (cabecera.tamanoRegistro != sizeof(RegistroSnapshot)) corrupto(ruta, "tamaño de registro inesperado");
+
+    // Límites de las secciones, sin desbordamientos aunque los campos sean arbitrarios
+    const std::size_t cuerpo = tamano - sizeof(CabeceraSnapshot);
+    if (cabecera.desplazamientoRegistros != sizeof(CabeceraSnapshot) ||
+        cabecera.cantidadRegistros > cuerpo / sizeof(RegistroSnapshot)) {
+        corrupto(ruta, "sección de registros fuera del archivo");
+    }
+    const std::size_t bytesRegistros = static_cast<std::size_t>(cabecera.cantidadRegistros) * sizeof(RegistroSnapshot);
+    const bool conIndice = cabecera.version >= 2;
+    if (cabecera.desplazamientoHeap != sizeof(CabeceraSnapshot) + bytesRegistros ||
+        (conIndice ? cabecera.tamanoHeap > cuerpo - bytesRegistros : cabecera.tamanoHeap != cuerpo - bytesRegistros)) {
+        corrupto(ruta, "heap de textos fuera del archivo");
+    }
+    const std::size_t finHeap = static_cast<std::size_t>(cabecera.desplazamientoHeap + cabecera.tamanoHeap);
+    if (conIndice) {
+        const std::size_t desplazamientoIndice = alinear8(finHeap);
+        std::uint64_t cantidadRanuras = 0;
+        if (desplazamientoIndice > tamano || tamano - desplazamientoIndice < sizeof cantidadRanuras) {
+            corrupto(ruta, "índice de códigos fuera del archivo");
+        }
+        std::memcpy(&cantidadRanuras, base + desplazamientoIndice, sizeof cantidadRanuras);
+        const std::size_t bytesIndice = tamano - desplazamientoIndice - sizeof cantidadRanuras;
+        const bool potenciaDeDos = cantidadRanuras != 0 && (cantidadRanuras & (cantidadRanuras - 1)) == 0;
+        if (!potenciaDeDos || cantidadRanuras <= cabecera.cantidadRegistros ||
+            cantidadRanuras != bytesIndice / sizeof(std::uint32_t) || bytesIndice % sizeof(std::uint32_t) != 0) {
+            corrupto(ruta, "índice de códigos inválido");
+        }
+        m_ranuras = base + desplazamientoIndice + sizeof cantidadRanuras;
+        m_cantidadRanuras = static_cast<std::size_t>(cantidadRanuras);
+    }
+
+    m_registros = base + sizeof(CabeceraSnapshot);
+    m_heap = base + cabecera.desplazamientoHeap;
+    m_cantidad = static_cast<std::size_t>(cabecera.cantidadRegistros);
+    m_tamanoHeap = cabecera.tamanoHeap;
+    m_generacion = cabecera.generacion;
+    m_suma = cabecera.sumaVerificacion;
+    if (verificacion == Verificacion::DIFERIDA) return;
+
+    // Lo que sigue al heap (relleno e índice) continúa la misma suma
+    std::uint64_t suma = ::sumaVerificacion(m_registros, bytesRegistros);
+    suma = ::sumaVerificacion(m_heap, static_cast<std::size_t>(cabecera.tamanoHeap), suma);
+    if (conIndice) {
+        suma = ::sumaVerificacion(base + finHeap, static_cast<std::size_t>(m_ranuras - (base + finHeap)), suma);
+        suma = ::sumaVerificacion(m_ranuras, m_cantidadRanuras * sizeof(std::uint32_t), suma);
+    }
+    if (suma != cabecera.sumaVerificacion) corrupto(ruta, "suma de verificación incorrecta");
+    validarRegistros(ruta, m_registros, m_cantidad, cabecera.tamanoHeap);
+}
+
+bool LectorSnapshot::registroValido(const RegistroSnapshot& registro) const noexcept {
+    return textosValidos(registro, m_tamanoHeap) && enumeracionesValidas(registro);
+}
+
+std::uint32_t LectorSnapshot::buscar(const std::string_view codigo) const noexcept {
+    const std::size_t mascara = m_cantidadRanuras - 1;
+    std::size_t ranura = static_cast<std::size_t>(hashCodigo(codigo)) & mascara;
+    // Como mucho una vuelta completa, aunque el índice esté dañado
+    for (std::size_t intentos = 0; intentos < m_cantidadRanuras; ++intentos, ranura = (ranura + 1) & mascara) {
+        std::uint32_t slot;
+        std::memcpy(&slot, m_ranuras + ranura * sizeof slot, sizeof slot);
+        if (slot == SnapshotInventario::SIN_SLOT) break;
+        if (slot >= m_cantidad) continue;
+        const RegistroSnapshot candidato = registro(slot);
+        if (textosValidos(candidato, m_tamanoHeap) && texto(candidato.codigo) == codigo) return slot;
+    }
+    return SnapshotInventario::SIN_SLOT;
+}
+
+std::uint64_t LectorSnapshot::sumaDeArchivo(const std::string& ruta) noexcept {
+    CabeceraSnapshot cabecera{};
+    std::ifstream archivo(ruta, std::ios::binary);
+    if (!archivo.read(reinterpret_cast<char*>(&cabecera), sizeof cabecera) ||
+        std::memcmp(cabecera.firma, SnapshotInventario::FIRMA, sizeof cabecera.firma) != 0) {
+        return 0;
+    }
+    return cabecera.sumaVerificacion;
+}
+
+LectorDelta::LectorDelta(const std::string& ruta) : m_archivo(ruta) {
+    const unsigned char* const base = m_archivo.datos();
+    const std::size_t tamano = m_archivo.size();
+    if (tamano < sizeof(CabeceraDelta)) corrupto(ruta, "truncado");
+
+    CabeceraDelta cabecera;
+    std::memcpy(&cabecera, base, sizeof cabecera);
+    if (std::memcmp(cabecera.firma, SnapshotInventario::FIRMA_DELTA, sizeof cabecera.firma) != 0) {
+        corrupto(ruta, "firma desconocida");
+    }
+    if (cabecera.marcaOrden != SnapshotInventario::MARCA_ORDEN) corrupto(ruta, "orden de bytes distinto");
+    if (cabecera.version != SnapshotInventario::VERSION_DELTA) corrupto(ruta, "versión no soportada");
+    if (cabecera.tamanoRegistro != sizeof(RegistroSnapshot)) corrupto(ruta, "tamaño de registro inesperado");
+
+    // Cada registro ocupa 40 bytes más 4 de slot (y hasta 4 de relleno)
+    const std::size_t cuerpo = tamano - sizeof(CabeceraDelta);
+    if (cabecera.cantidadRegistros > cuerpo / (sizeof(RegistroSnapshot) + sizeof(std::uint32_t))) {
+        corrupto(ruta, "sección de registros fuera del archivo");
+    }
+    m_cantidad = static_cast<std::size_t>(cabecera.cantidadRegistros);
+    const std::size_t bytesRegistros = m_cantidad * sizeof(RegistroSnapshot);
+    const std::size_t bytesSlots = m_cantidad * sizeof(std::uint32_t);
+    const std::size_t desplazamientoHeap = sizeof(CabeceraDelta) + bytesRegistros + alinear8(bytesSlots);
+    if (desplazamientoHeap > tamano || cabecera.tamanoHeap != tamano - desplazamientoHeap) {
+        corrupto(ruta, "heap de textos fuera del archivo");
+    }
+    m_registros = base + sizeof(CabeceraDelta);
+    m_slots = m_registros + bytesRegistros;
+    m_heap = base + desplazamientoHeap;
+    std::uint64_t suma = sumaVerificacion(m_registros, bytesRegistros);
+    suma = sumaVerificacion(m_slots, bytesSlots, suma);
+    suma = sumaVerificacion(m_heap, static_cast<std::size_t>(cabecera.tamanoHeap), suma);
+    if (suma != cabecera.sumaVerificacion) corrupto(ruta, "suma de verificación incorrecta");
+
+    for (std::size_t i = 0; i < m_cantidad; ++i) {
+        if (slot(i) >= cabecera.cantidadTotal) corrupto(ruta, "slot fuera del inventario");
+    }
+    m_cantidadTotal = cabecera.cantidadTotal;
+    m_sumaBase = cabecera.sumaBase;
+    m_tamanoHeap = cabecera.tamanoHeap;
+    validarRegistros(ruta, m_registros, m_cantidad, cabecera.tamanoHeap);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file tabla_simbolos.cpp
+ * @brief Implementation of the process-wide symbol table
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/tabla_simbolos.hpp"
+#include <mutex>
+
+TablaSimbolos::~TablaSimbolos() {
+    for (std::atomic<std::string*>& bloque : m_bloques) delete[] bloque.load(std::memory_order_relaxed);
+}
+
+TablaSimbolos& TablaSimbolos::global() {
+    static TablaSimbolos tabla;
+    return tabla;
+}
+
+// El texto se escribe antes de publicar el bloque y la nueva cantidad: un
+// lector que recibe el id ve el texto completo
+TablaSimbolos::Id TablaSimbolos::internar(const std::string_view texto) {
+    {
+        std::shared_lock<std::shared_mutex> lectura(m_mutex);
+        const auto it = m_ids.find(texto);
+        if (it != m_ids.end()) return it->second;
+    }
+    std::unique_lock<std::shared_mutex> escritura(m_mutex);
+    const auto it = m_ids.find(texto);
+    if (it != m_ids.end()) return it->second;
+
+    const auto id = static_cast<Id>(m_cantidad.load(std::memory_order_relaxed));
+    const Posicion posicion = ubicar(id);
+    std::string* bloque = m_bloques[posicion.bloque].load(std::memory_order_relaxed);
+    if (bloque == nullptr) {
+        bloque = new std::string[std::size_t{1} << (BITS_PRIMER_BLOQUE + posicion.bloque)];
+        m_bloques[posicion.bloque].store(bloque, std::memory_order_release);
+    }
+    std::string& destino = bloque[posicion.indice];
+    destino.assign(texto.data(), texto.size());
+    try {
+        m_ids.emplace(destino, id);
+    } catch (...) {
+        std::string().swap(destino);
+        throw;
+    }
+    m_cantidad.store(std::size_t{id} + 1, std::memory_order_release);
+    return id;
+}
+
+TablaSimbolos::Id TablaSimbolos::buscar(const std::string_view texto) const {
+    std::shared_lock<std::shared_mutex> lectura(m_mutex);
+    const auto it = m_ids.find(texto);
+    return (it != m_ids.end()) ? it->second : SIN_ID;
+}
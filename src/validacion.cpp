@@ -0,0 +1,94 @@
+/**
+ * @file validacion.cpp
+ * @brief Batch validators for article codes and entry dates
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/validacion.hpp"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VALIDACION_SSE2 1
+#endif
+
+namespace {
+    constexpr std::size_t MAX_CODIGO = MedicalInventory::Domain::Validation::MAX_CODE_LENGTH;
+
+#if defined(VALIDACION_SSE2)
+    // Bytes de 'v' dentro de [desde, hasta] con una sola comparación con signo:
+    // se desplaza el rango para que empiece en -128
+    __m128i enRango(const __m128i v, const char desde, const char hasta) noexcept {
+        const __m128i desplazado = _mm_add_epi8(v, _mm_set1_epi8(static_cast<char>(-128 - desde)));
+        return _mm_cmplt_epi8(desplazado, _mm_set1_epi8(static_cast<char>(-128 + (hasta - desde) + 1)));
+    }
+
+    // Máscara de bits de las posiciones que son [A-Za-z0-9_-]
+    unsigned mascaraDeCodigo(const __m128i v) noexcept {
+        const __m128i minuscula = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i valido = _mm_or_si128(enRango(v, '0', '9'), enRango(minuscula, 'a', 'z'));
+        valido = _mm_or_si128(valido, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+        valido = _mm_or_si128(valido, _mm_cmpeq_epi8(v, _mm_set1_epi8('-')));
+        return static_cast<unsigned>(_mm_movemask_epi8(valido));
+    }
+
+    bool codigoValidoVectorial(const std::string_view codigo) noexcept {
+        if (codigo.size() < MedicalInventory::Domain::Validation::MIN_CODE_LENGTH || codigo.size() > MAX_CODIGO) {
+            return false;
+        }
+        // Copia a un búfer relleno para no leer más allá del final de la cadena
+        alignas(16) char bufer[32] = {};
+        std::memcpy(bufer, codigo.data(), codigo.size());
+        const unsigned bajo = mascaraDeCodigo(_mm_load_si128(reinterpret_cast<const __m128i*>(bufer)));
+        const unsigned alto = mascaraDeCodigo(_mm_load_si128(reinterpret_cast<const __m128i*>(bufer + 16)));
+        const std::uint32_t mascara = bajo | (static_cast<std::uint32_t>(alto) << 16);
+        const std::uint32_t requerida = (std::uint32_t{1} << codigo.size()) - 1;
+        return (mascara & requerida) == requerida;
+    }
+
+    bool fechaValidaVectorial(const std::string_view fecha) noexcept {
+        if (fecha.size() != 10) return false;
+        alignas(16) char bufer[16] = {};
+        std::memcpy(bufer, fecha.data(), 10);
+        const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(bufer));
+        const auto digitos = static_cast<unsigned>(_mm_movemask_epi8(enRango(v, '0', '9')));
+        const auto barras = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('/'))));
+        // DD/MM/YYYY: dígitos en 0-1, 3-4, 6-9 y barras en 2 y 5
+        constexpr unsigned DIGITOS = 0x3DBu;
+        constexpr unsigned BARRAS = 0x024u;
+        if ((digitos & 0x3FFu) != DIGITOS || (barras & 0x3FFu) != BARRAS) return false;
+        return Validacion::camposDeFechaValidos(fecha);
+    }
+#endif
+}
+
+std::size_t Validacion::validarCodigos(const std::string_view* codigos, const std::size_t cantidad,
+                                       std::uint8_t* validos) noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < cantidad; ++i) {
+#if defined(VALIDACION_SSE2)
+        const bool valido = codigoValidoVectorial(codigos[i]);
+#else
+        const bool valido = codigoValido(codigos[i]);
+#endif
+        validos[i] = valido ? 1 : 0;
+        total += valido ? 1 : 0;
+    }
+    return total;
+}
+
+std::size_t Validacion::validarFechas(const std::string_view* fechas, const std::size_t cantidad,
+                                      std::uint8_t* validos) noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < cantidad; ++i) {
+#if defined(VALIDACION_SSE2)
+        const bool valido = fechaValidaVectorial(fechas[i]);
+#else
+        const bool valido = fechaValida(fechas[i]);
+#endif
+        validos[i] = valido ? 1 : 0;
+        total += valido ? 1 : 0;
+    }
+    return total;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file vista_inventario.cpp
+ * @brief Implementation of the read-only snapshot view
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "../include/vista_inventario.hpp"
+#include "../include/suma_compensada.hpp"
+#include "../include/validacion.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+
+double ArticuloVista::CalculateTotalCost(const FechaCorte& corte) const noexcept {
+    return esEquipo() ? GetUnitCost() - calcularDepreciacion(corte) : calcularValorConPlus();
+}
+
+VistaInventario::VistaInventario(const std::string& nombreArchivo)
+    : m_base(nombreArchivo, LectorSnapshot::Verificacion::DIFERIDA), m_cantidad(m_base.size()) {
+    const std::string rutaDelta = SnapshotInventario::rutaDelta(nombreArchivo);
+    if (!std::filesystem::exists(rutaDelta)) return;
+    m_delta.emplace(rutaDelta);
+    // Igual que Inventario::cargarDeArchivo: un delta de otra base ya no aplica
+    if (m_delta->sumaBase() != m_base.sumaVerificacion()) {
+        m_delta.reset();
+        return;
+    }
+    if (m_delta->cantidadTotal() > m_base.size() + m_delta->size()) {
+        throw std::runtime_error("[VistaInventario] El delta '" + rutaDelta + "' deja slots sin artículo");
+    }
+
+    m_cantidad = static_cast<size_t>(m_delta->cantidadTotal());
+    m_slotsDelta.reserve(m_delta->size());
+    for (size_t i = 0; i < m_delta->size(); ++i) {
+        m_slotsDelta.emplace_back(m_delta->slot(i), static_cast<std::uint32_t>(i));
+    }
+    std::sort(m_slotsDelta.begin(), m_slotsDelta.end());
+    m_slotsDelta.erase(std::unique(m_slotsDelta.begin(), m_slotsDelta.end(),
+                                   [](const auto& a, const auto& b) { return a.first == b.first; }),
+                       m_slotsDelta.end());
+    // Cada slot posterior a la base tiene que venir en el delta
+    const size_t nuevos = m_cantidad > m_base.size() ? m_cantidad - m_base.size() : 0;
+    const auto primerNuevo = std::lower_bound(m_slotsDelta.begin(), m_slotsDelta.end(),
+                                              std::make_pair(static_cast<std::uint32_t>(m_base.size()), 0u));
+    if (static_cast<size_t>(m_slotsDelta.end() - primerNuevo) != nuevos ||
+        (!m_slotsDelta.empty() && m_slotsDelta.back().first >= m_cantidad)) {
+        throw std::runtime_error("[VistaInventario] El delta '" + rutaDelta + "' deja slots sin artículo");
+    }
+    // Con bajas, un slot reescrito puede guardar otro artículo: el índice
+    // de la base no sirve para los códigos del delta
+    m_codigosDelta.reserve(m_slotsDelta.size());
+    for (const auto& [slot, registro] : m_slotsDelta) {
+        m_codigosDelta.emplace(m_delta->texto(m_delta->registro(registro).codigo), slot);
+    }
+}
+
+// Los registros de la base se validan al leerlos (la apertura no los recorre)
+ArticuloVista VistaInventario::deBase(const std::uint32_t slot) const {
+    const RegistroSnapshot registro = m_base.registro(slot);
+    if (!m_base.registroValido(registro) || !Validacion::fechaValida(m_base.texto(registro.fechaIngreso))) {
+        throw std::runtime_error("[VistaInventario] Registro " + std::to_string(slot) + " del snapshot inválido");
+    }
+    return ArticuloVista(registro, m_base.heap(), slot);
+}
+
+ArticuloVista VistaInventario::deDelta(const std::uint32_t registro, const std::uint32_t slot) const {
+    const RegistroSnapshot datos = m_delta->registro(registro);
+    if (!Validacion::fechaValida(m_delta->texto(datos.fechaIngreso))) {
+        throw std::runtime_error("[VistaInventario] Registro " + std::to_string(slot) + " del delta inválido");
+    }
+    return ArticuloVista(datos, m_delta->heap(), slot);
+}
+
+ArticuloVista VistaInventario::articulo(const std::uint32_t slot) const {
+    if (slot >= m_cantidad) throw std::out_of_range("[VistaInventario] Slot fuera del inventario");
+    const auto delta = std::lower_bound(m_slotsDelta.begin(), m_slotsDelta.end(), std::make_pair(slot, 0u));
+    if (delta != m_slotsDelta.end() && delta->first == slot) return deDelta(delta->second, slot);
+    return deBase(slot);
+}
+
+// Recorre [desde, hasta) avanzando a la vez por los slots del delta
+template <typename Visitar>
+void VistaInventario::recorrer(const size_t desde, const size_t hasta, Visitar&& visitar) const {
+    auto delta = std::lower_bound(m_slotsDelta.begin(), m_slotsDelta.end(),
+                                  std::make_pair(static_cast<std::uint32_t>(desde), 0u));
+    for (size_t slot = desde; slot < hasta; ++slot) {
+        const auto s = static_cast<std::uint32_t>(slot);
+        if (delta != m_slotsDelta.end() && delta->first == s) {
+            visitar(deDelta(delta->second, s));
+            ++delta;
+        } else {
+            visitar(deBase(s));
+        }
+    }
+}
+
+std::optional<ArticuloVista> VistaInventario::buscarPorCodigo(const std::string_view codigo) const {
+    const auto nuevo = m_codigosDelta.find(codigo);
+    if (nuevo != m_codigosDelta.end()) return articulo(nuevo->second);
+
+    // Un código de la base cuyo slot reescribe el delta (o que ya no
+    // existe) fue dado de baja: si siguiera, estaría en m_codigosDelta
+    const auto vigente = [this](const std::uint32_t slot) {
+        return slot < m_cantidad && !std::binary_search(m_slotsDelta.begin(), m_slotsDelta.end(),
+                                                        std::make_pair(slot, 0u),
+                                                        [](const auto& a, const auto& b) { return a.first < b.first; });
+    };
+    if (m_base.tieneIndice()) {
+        const std::uint32_t slot = m_base.buscar(codigo);
+        if (slot == SnapshotInventario::SIN_SLOT || !vigente(slot)) return std::nullopt;
+        return deBase(slot);
+    }
+    // Snapshot de versión 1: sin índice persistido
+    for (size_t slot = 0; slot < m_base.size(); ++slot) {
+        const ArticuloVista candidato = deBase(static_cast<std::uint32_t>(slot));
+        if (candidato.GetCode() == codigo) {
+            if (!vigente(static_cast<std::uint32_t>(slot))) return std::nullopt;
+            return candidato;
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename Predicado>
+std::vector<ArticuloVista> VistaInventario::filtrar(Predicado&& predicado) const {
+    using Parcial = std::vector<ArticuloVista>;
+    return m_agregador.reducir<Parcial>(m_cantidad,
+        [this, &predicado](Parcial& parcial, const size_t desde, const size_t hasta) {
+            recorrer(desde, hasta, [&](const ArticuloVista& articulo) {
+                if (predicado(articulo)) parcial.push_back(articulo);
+            });
+        },
+        [](Parcial& total, Parcial&& bloque) { total.insert(total.end(), bloque.begin(), bloque.end()); });
+}
+
+std::vector<ArticuloVista> VistaInventario::filtrarPorEstado(const EstadoArticulo estado) const {
+    return filtrar([estado](const ArticuloVista& articulo) { return articulo.GetStatus() == estado; });
+}
+
+std::vector<ArticuloVista> VistaInventario::filtrarPorTipo(const TipoArticulo tipo) const {
+    return filtrar([tipo](const ArticuloVista& articulo) { return articulo.GetType() == tipo; });
+}
+
+std::map<std::pair<MarcaEquipo, AreaUso>, std::vector<ArticuloVista>>
+VistaInventario::agruparEquiposPorMarcaYArea() const {
+    std::map<std::pair<MarcaEquipo, AreaUso>, std::vector<ArticuloVista>> agrupados;
+    for (const ArticuloVista& equipo : filtrarPorTipo(TipoArticulo::MEDICAL_EQUIPMENT)) {
+        agrupados[{equipo.getMarca(), equipo.getAreaUso()}].push_back(equipo);
+    }
+    return agrupados;
+}
+
+// Un técnico repetido comparte su texto en el heap: se agrupa por dirección
+// y solo al final por nombre (la base y el delta tienen heaps distintos)
+std::map<std::string, int> VistaInventario::contarEquiposPorTecnico() const {
+    using Parcial = std::unordered_map<const char*, std::pair<std::string_view, int>>;
+    const Parcial porTexto = m_agregador.reducir<Parcial>(m_cantidad,
+        [this](Parcial& parcial, const size_t desde, const size_t hasta) {
+            recorrer(desde, hasta, [&parcial](const ArticuloVista& articulo) {
+                if (!articulo.esEquipo()) return;
+                const std::string_view tecnico = articulo.getTecnicoAsignado();
+                auto& entrada = parcial[tecnico.data()];
+                entrada.first = tecnico;
+                ++entrada.second;
+            });
+        },
+        [](Parcial& total, Parcial&& bloque) {
+            for (const auto& [direccion, entrada] : bloque) {
+                auto& acumulado = total[direccion];
+                acumulado.first = entrada.first;
+                acumulado.second += entrada.second;
+            }
+        });
+
+    std::map<std::string, int> conteo;
+    for (const auto& entrada : porTexto) conteo[std::string(entrada.second.first)] += entrada.second.second;
+    return conteo;
+}
+
+std::array<int, 256> VistaInventario::contarPorArea(const TipoArticulo tipo) const {
+    using Parcial = std::array<int, 256>;
+    return m_agregador.reducir<Parcial>(m_cantidad,
+        [this, tipo](Parcial& parcial, const size_t desde, const size_t hasta) {
+            recorrer(desde, hasta, [&parcial, tipo](const ArticuloVista& articulo) {
+                if (articulo.GetType() == tipo) ++parcial[articulo.m_registro.area];
+            });
+        },
+        [](Parcial& total, Parcial&& bloque) {
+            for (size_t area = 0; area < total.size(); ++area) total[area] += bloque[area];
+        });
+}
+
+std::map<AreaUso, int> VistaInventario::contarEquiposPorArea() const {
+    const auto porArea = contarPorArea(TipoArticulo::MEDICAL_EQUIPMENT);
+    std::map<AreaUso, int> conteo;
+    for (size_t area = 0; area < porArea.size(); ++area) {
+        if (porArea[area] > 0) conteo[static_cast<AreaUso>(area)] = porArea[area];
+    }
+    return conteo;
+}
+
+std::map<AreaUbicacion, int> VistaInventario::contarMobiliarioPorArea() const {
+    const auto porArea = contarPorArea(TipoArticulo::CLINICAL_FURNITURE);
+    std::map<AreaUbicacion, int> conteo;
+    for (size_t area = 0; area < porArea.size(); ++area) {
+        if (porArea[area] > 0) conteo[static_cast<AreaUbicacion>(area)] = porArea[area];
+    }
+    return conteo;
+}
+
+ContadoresInventario VistaInventario::resumir() const {
+    return m_agregador.reducir<ContadoresInventario>(m_cantidad,
+        [this](ContadoresInventario& parcial, const size_t desde, const size_t hasta) {
+            recorrer(desde, hasta, [this, &parcial](const ArticuloVista& articulo) {
+                parcial.agregar(static_cast<std::uint8_t>(articulo.GetType()),
+                                static_cast<std::uint8_t>(articulo.GetStatus()),
+                                articulo.CalculateTotalCost(m_fechaCorte));
+            });
+        },
+        [](ContadoresInventario& total, ContadoresInventario&& bloque) { total.combinar(bloque); });
+}
+
+size_t VistaInventario::obtenerCantidadPorTipo(const TipoArticulo tipo) const {
+    return resumir().cantidadPorTipo[static_cast<size_t>(tipo)];
+}
+
+size_t VistaInventario::obtenerCantidadPorEstado(const EstadoArticulo estado) const {
+    return resumir().cantidadPorEstado[static_cast<size_t>(estado)];
+}
+
+double VistaInventario::calcularCostoTotalPorCategoria(const TipoArticulo tipo) const {
+    return resumir().costoPorTipo[static_cast<size_t>(tipo)].valor();
+}
+
+std::map<TipoArticulo, double> VistaInventario::calcularCostosPorCategoria() const {
+    const ContadoresInventario resumen = resumir();
+    std::map<TipoArticulo, double> costos;
+    for (size_t tipo = 0; tipo < ContadoresInventario::TIPOS; ++tipo) {
+        costos[static_cast<TipoArticulo>(tipo)] = resumen.costoPorTipo[tipo].valor();
+    }
+    return costos;
+}
+
+double VistaInventario::calcularCostoTotalPorEstado(const EstadoArticulo estado) const {
+    return resumir().costoPorEstado[static_cast<size_t>(estado)].valor();
+}
+
+std::pair<double, double> VistaInventario::obtenerCostosMinMax() const {
+    struct Extremos {
+        double minimo = std::numeric_limits<double>::infinity();
+        double maximo = -std::numeric_limits<double>::infinity();
+    };
+    const Extremos extremos = m_agregador.reducir<Extremos>(m_cantidad,
+        [this](Extremos& parcial, const size_t desde, const size_t hasta) {
+            recorrer(desde, hasta, [&parcial](const ArticuloVista& articulo) {
+                parcial.minimo = std::min(parcial.minimo, articulo.GetUnitCost());
+                parcial.maximo = std::max(parcial.maximo, articulo.GetUnitCost());
+            });
+        },
+        [](Extremos& total, Extremos&& bloque) {
+            total.minimo = std::min(total.minimo, bloque.minimo);
+            total.maximo = std::max(total.maximo, bloque.maximo);
+        });
+    if (m_cantidad == 0) return {0.0, 0.0};
+    return {extremos.minimo, extremos.maximo};
+}
+
+double VistaInventario::calcularDepreciacionTotal() const {
+    const SumaCompensada total = m_agregador.reducir<SumaCompensada>(m_cantidad,
+        [this](SumaCompensada& parcial, const size_t desde, const size_t hasta) {
+            recorrer(desde, hasta, [this, &parcial](const ArticuloVista& articulo) {
+                if (articulo.esEquipo()) parcial.sumar(articulo.calcularDepreciacion(m_fechaCorte));
+            });
+        },
+        [](SumaCompensada& suma, SumaCompensada&& bloque) { suma.sumar(bloque.valor()); });
+    return total.valor();
+}
@@ -0,0 +1,28 @@
+/**
+ * @file comprobar.hpp
+ * @brief Minimal check macro for the test programs (active in every build type)
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#ifndef COMPROBAR_HPP
+#define COMPROBAR_HPP
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Abort the test with file, line and expression if @p condicion is false
+ *
+ * Unlike assert() it is not compiled out under NDEBUG, so the checks also
+ * run in the Release builds used for the benchmarks.
+ */
+#define COMPROBAR(condicion)                                                               \
+    do {                                                                                   \
+        if (!(condicion)) {                                                                \
+            std::fprintf(stderr, "%s:%d: no se cumple: %s\n", __FILE__, __LINE__, #condicion); \
+            std::exit(1);                                                                  \
+        }                                                                                  \
+    } while (false)
+
+#endif // COMPROBAR_HPP
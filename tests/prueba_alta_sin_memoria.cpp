@@ -0,0 +1,95 @@
+/**
+ * @file prueba_alta_sin_memoria.cpp
+ * @brief An insert that runs out of memory at any allocation leaves the inventory unchanged
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    long asignacionesRestantes = -1;  // -1: nunca falla
+
+    // Todo lo que las consultas pueden ver del inventario
+    struct Estado {
+        size_t total;
+        size_t danados;
+        size_t bitmapDanados;
+        size_t bitmapPediatria;
+        size_t enRango;
+        size_t modificados;
+        double costoTotal;
+        std::vector<std::pair<std::string, int>> tecnicos;
+
+        bool operator==(const Estado& otro) const {
+            return total == otro.total && danados == otro.danados && bitmapDanados == otro.bitmapDanados &&
+                   bitmapPediatria == otro.bitmapPediatria && enRango == otro.enRango &&
+                   modificados == otro.modificados && costoTotal == otro.costoTotal && tecnicos == otro.tecnicos;
+        }
+    };
+
+    Estado leer(const Inventario& inventario) {
+        const IndiceBitmaps& bitmaps = inventario.obtenerIndiceBitmaps();
+        return {inventario.obtenerCantidadTotal(),
+                inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED),
+                bitmaps.estado(ArticleStatus::DAMAGED).cardinalidad(),
+                bitmaps.area(AreaUso::PEDIATRIA).cardinalidad(),
+                inventario.contarArticulosEntreCostos(0.0, 1e9),
+                inventario.obtenerCantidadModificados(),
+                inventario.calcularCostoTotalPorEstado(ArticleStatus::DAMAGED),
+                inventario.obtenerTecnicosConMasEquipos(10)};
+    }
+}
+
+void* operator new(std::size_t tamano) {
+    if (asignacionesRestantes == 0) throw std::bad_alloc();
+    if (asignacionesRestantes > 0) --asignacionesRestantes;
+    if (void* memoria = std::malloc(tamano == 0 ? 1 : tamano)) return memoria;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memoria) noexcept { std::free(memoria); }
+void operator delete(void* memoria, std::size_t) noexcept { std::free(memoria); }
+
+int main() {
+    Inventario inventario;
+    // Tamaños que obligan a crecer vectores, tablas y bloques en distintos puntos
+    for (int n = 0; n < 300; ++n) {
+        const std::string codigo = "EQ-" + std::to_string(n);
+        const auto estado = (n % 3 == 0) ? ArticleStatus::DAMAGED : ArticleStatus::OPERATIONAL;
+        const std::string tecnico = "Tecnico " + std::to_string(n % 7);
+        const Estado antes = leer(inventario);
+
+        // Falla en la asignación k-ésima del alta hasta que alguna llega al final
+        for (long k = 0;; ++k) {
+            EquipoMedico equipo(codigo, "01/02/2020", estado, 10.0 + n, MarcaEquipo::GE, 5, tecnico,
+                                AreaUso::PEDIATRIA);
+            asignacionesRestantes = k;
+            bool completada = true;
+            try {
+                inventario.agregarArticulo(std::move(equipo));
+            } catch (const std::bad_alloc&) {
+                completada = false;
+            }
+            asignacionesRestantes = -1;
+            if (completada) break;
+            COMPROBAR(!inventario.existeCodigo(codigo));
+            COMPROBAR(leer(inventario) == antes);
+        }
+        COMPROBAR(inventario.existeCodigo(codigo));
+        COMPROBAR(inventario.obtenerCantidadTotal() == static_cast<size_t>(n) + 1);
+    }
+
+    // Tras los fallos el inventario sigue consistente
+    COMPROBAR(inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED) == 100);
+    COMPROBAR(inventario.obtenerIndiceBitmaps().estado(ArticleStatus::DAMAGED).cardinalidad() == 100);
+    COMPROBAR(inventario.contarArticulosEntreCostos(10.0, 309.0) == 300);
+    COMPROBAR(inventario.eliminarArticulo("EQ-0") && inventario.obtenerCantidadTotal() == 299);
+    return 0;
+}
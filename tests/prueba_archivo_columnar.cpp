@@ -0,0 +1,180 @@
+/**
+ * @file prueba_archivo_columnar.cpp
+ * @brief Columnar archive round trip with edge values, and aggregates on the encoded columns
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Costs at the ends of the valid range and without an exact hundredths
+ * form (which switches the column to IEEE), the first and last valid
+ * dates in alternating order, codes of minimum and maximum length that
+ * share all or none of their prefix, more texts than fit one byte of
+ * dictionary code, runs of equal values and partial last blocks.
+ */
+
+#include "archivo_columnar.hpp"
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    const char* const FECHAS[] = {"01/01/2000", "31/12/2099", "29/02/2000", "29/02/2096", "15/06/2024"};
+
+    std::string codigo(const std::size_t n) {
+        // Longitudes de 3 a 20 y prefijos comunes de todos los largos
+        switch (n % 4) {
+            case 0: return "EQ-" + std::to_string(n);
+            case 1: return std::string(20 - std::to_string(n).size(), 'Z') + std::to_string(n);
+            case 2: return "AB" + std::to_string(n);
+            default: return "EQ-" + std::to_string(n) + "_x";
+        }
+    }
+
+    void llenar(Inventario& inventario, const std::size_t cantidad, const bool costoExacto) {
+        for (std::size_t n = 0; n < cantidad; ++n) {
+            const char* fecha = FECHAS[n < 300 ? 0 : n % 5];  // una tanda de valores iguales al principio
+            const auto estado = static_cast<ArticleStatus>(n % 3);
+            double costo = 0.0;
+            switch (n % 6) {
+                case 0: costo = 0.0; break;
+                case 1: costo = 1000000.0; break;
+                case 2: costo = 0.01; break;
+                case 3: costo = 999999.99; break;
+                case 4: costo = costoExacto ? 12.5 : 1.0 / 3.0; break;
+                default: costo = 100.0 + static_cast<double>(n % 97) * 0.25; break;
+            }
+            if (n % 2 == 0) {
+                inventario.agregarArticulo(EquipoMedico(codigo(n), fecha, estado, costo, static_cast<MarcaEquipo>(n % 4),
+                                                        n % 7 == 0 ? 2147483647 : 1 + static_cast<int>(n % 30),
+                                                        "Técnico ñandú " + std::to_string(n % 700),
+                                                        static_cast<AreaUso>(n % 3)));
+            } else {
+                inventario.agregarArticulo(MobiliarioClinico(codigo(n), fecha, estado, costo,
+                                                             n % 5 == 0 ? std::string(200, 'm') : "Acero",
+                                                             static_cast<AreaUbicacion>(n % 3)));
+            }
+        }
+    }
+
+    void comprobarIguales(const Inventario& a, const Inventario& b) {
+        const std::vector<Articulo*> x = a.obtenerTodosLosArticulos();
+        const std::vector<Articulo*> y = b.obtenerTodosLosArticulos();
+        COMPROBAR(x.size() == y.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            COMPROBAR(x[i]->GetCode() == y[i]->GetCode() && x[i]->GetType() == y[i]->GetType());
+            COMPROBAR(x[i]->GetStatus() == y[i]->GetStatus() && x[i]->GetUnitCost() == y[i]->GetUnitCost());
+            COMPROBAR(x[i]->GetEntryDay() == y[i]->GetEntryDay() && x[i]->GetEntryDate() == y[i]->GetEntryDate());
+            if (x[i]->GetType() == ArticleType::MEDICAL_EQUIPMENT) {
+                const auto& p = static_cast<const EquipoMedico&>(*x[i]);
+                const auto& q = static_cast<const EquipoMedico&>(*y[i]);
+                COMPROBAR(p.getMarca() == q.getMarca() && p.getAreaUso() == q.getAreaUso());
+                COMPROBAR(p.getVidaUtilAnios() == q.getVidaUtilAnios());
+                COMPROBAR(p.getTecnicoAsignado() == q.getTecnicoAsignado());
+            } else {
+                const auto& p = static_cast<const MobiliarioClinico&>(*x[i]);
+                const auto& q = static_cast<const MobiliarioClinico&>(*y[i]);
+                COMPROBAR(p.getAreaUbicacion() == q.getAreaUbicacion() && p.getMaterial() == q.getMaterial());
+            }
+        }
+    }
+
+    // Lo que el lector agrega sin crear artículos coincide con el inventario
+    void comprobarAgregados(const Inventario& inventario, const LectorColumnar& lector) {
+        COMPROBAR(lector.size() == inventario.obtenerCantidadTotal());
+        COMPROBAR(lector.contarEquiposPorTecnico() == inventario.contarEquiposPorTecnico());
+        COMPROBAR(lector.contarEquiposPorArea() == inventario.contarEquiposPorArea());
+        COMPROBAR(lector.contarMobiliarioPorArea() == inventario.contarMobiliarioPorArea());
+        const ContadoresInventario contadores = lector.resumirPorTipoYEstado();
+        for (const ArticleStatus estado : {ArticleStatus::OPERATIONAL, ArticleStatus::UNDER_REVIEW, ArticleStatus::DAMAGED}) {
+            COMPROBAR(contadores.cantidadPorEstado[static_cast<std::size_t>(estado)] ==
+                      inventario.obtenerCantidadPorEstado(estado));
+        }
+        const std::vector<Articulo*> articulos = inventario.obtenerTodosLosArticulos();
+        const std::int32_t desde = Fecha::diasDesdeCivil(2000, 1, 1);
+        const std::int32_t hasta = Fecha::diasDesdeCivil(2099, 12, 31);
+        std::size_t enRango = 0;
+        std::size_t primerDia = 0;
+        for (const Articulo* articulo : articulos) {
+            enRango += articulo->GetEntryDay() >= desde + 1 && articulo->GetEntryDay() <= hasta - 1;
+            primerDia += articulo->GetEntryDay() == desde;
+        }
+        COMPROBAR(lector.contarIngresosEntre(desde, hasta) == articulos.size());
+        COMPROBAR(lector.contarIngresosEntre(desde + 1, hasta - 1) == enRango);
+        COMPROBAR(lector.contarIngresosEntre(desde, desde) == primerDia);
+        COMPROBAR(lector.contarIngresosEntre(hasta, desde) == 0);
+        if (!articulos.empty()) {
+            double minimo = articulos[0]->GetUnitCost();
+            double maximo = minimo;
+            for (const Articulo* articulo : articulos) {
+                minimo = std::min(minimo, articulo->GetUnitCost());
+                maximo = std::max(maximo, articulo->GetUnitCost());
+            }
+            const ExtremosCostos extremos = lector.obtenerExtremosCostos();
+            COMPROBAR(extremos.minimo == minimo && extremos.maximo == maximo);
+            COMPROBAR(articulos[extremos.indiceMinimo]->GetUnitCost() == minimo);
+            COMPROBAR(articulos[extremos.indiceMaximo]->GetUnitCost() == maximo);
+        }
+    }
+
+    void idaYVuelta(const Inventario& inventario, const std::string& ruta) {
+        inventario.exportarColumnar(ruta);
+        const LectorColumnar lector(ruta);
+        comprobarAgregados(inventario, lector);
+        Inventario cargado;
+        cargado.importarColumnar(ruta);
+        comprobarIguales(inventario, cargado);
+    }
+}
+
+int main() {
+    const std::filesystem::path carpeta = std::filesystem::temp_directory_path() / "prueba_archivo_columnar";
+    std::filesystem::create_directories(carpeta);
+    const std::string ruta = (carpeta / "inventario.col").string();
+
+    // Tamaños alrededor del bloque de 128 filas
+    for (const std::size_t cantidad : {std::size_t{0}, std::size_t{1}, std::size_t{127}, std::size_t{128},
+                                       std::size_t{129}, std::size_t{2000}}) {
+        for (const bool costoExacto : {true, false}) {
+            Inventario inventario;
+            llenar(inventario, cantidad, costoExacto);
+            idaYVuelta(inventario, ruta);
+        }
+    }
+
+    // Las centésimas ocupan menos que los double crudos
+    Inventario exacto;
+    llenar(exacto, 2000, true);
+    exacto.exportarColumnar(ruta);
+    const auto bytesExacto = std::filesystem::file_size(ruta);
+    Inventario inexacto;
+    llenar(inexacto, 2000, false);
+    inexacto.exportarColumnar(ruta);
+    COMPROBAR(bytesExacto < std::filesystem::file_size(ruta));
+
+    // Un archivo alterado se rechaza al abrirlo y el inventario no cambia
+    std::vector<char> datos;
+    {
+        std::ifstream archivo(ruta, std::ios::binary);
+        datos.assign(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+    }
+    datos[datos.size() - 5] ^= 0x10;
+    std::ofstream(ruta, std::ios::binary).write(datos.data(), static_cast<std::streamsize>(datos.size()));
+    bool rechazado = false;
+    try {
+        exacto.importarColumnar(ruta);
+    } catch (const std::runtime_error&) {
+        rechazado = true;
+    }
+    COMPROBAR(rechazado && exacto.obtenerCantidadTotal() == 2000);
+
+    std::filesystem::remove_all(carpeta);
+    return 0;
+}
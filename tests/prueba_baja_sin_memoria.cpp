@@ -0,0 +1,139 @@
+/**
+ * @file prueba_baja_sin_memoria.cpp
+ * @brief A removal that runs out of memory at any allocation leaves the inventory unchanged
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Removing a slot other than the last one moves the last article into it,
+ * and giving it the new slot can allocate: a bitmap chunk that grows past
+ * UMBRAL_ARREGLO becomes a bitmap, and an ordered index block may split.
+ * Each removal is failed at its k-th allocation until one completes.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    long asignacionesRestantes = -1;  // -1: nunca falla
+
+    constexpr int ARTICULOS = 5000;
+    constexpr int DANADOS = 4096;  // un bloque de 65536 slots justo en UMBRAL_ARREGLO
+
+    std::string codigo(const int n) { return "EQ-" + std::to_string(n); }
+
+    // Todo lo que las consultas pueden ver del inventario
+    struct Estado {
+        std::vector<Articulo*> articulos;
+        size_t danados;
+        size_t bitmapDanados;
+        size_t bitmapPediatria;
+        size_t enRango;
+        size_t baratos;
+        double costoTotal;
+        std::vector<std::pair<std::string, int>> tecnicos;
+
+        bool operator==(const Estado& otro) const {
+            return articulos == otro.articulos && danados == otro.danados && bitmapDanados == otro.bitmapDanados &&
+                   bitmapPediatria == otro.bitmapPediatria && enRango == otro.enRango && baratos == otro.baratos &&
+                   costoTotal == otro.costoTotal && tecnicos == otro.tecnicos;
+        }
+    };
+
+    Estado leer(const Inventario& inventario) {
+        const IndiceBitmaps& bitmaps = inventario.obtenerIndiceBitmaps();
+        return {inventario.obtenerTodosLosArticulos(),
+                inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED),
+                bitmaps.estado(ArticleStatus::DAMAGED).cardinalidad(),
+                bitmaps.area(AreaUso::PEDIATRIA).cardinalidad(),
+                inventario.contarArticulosEntreCostos(0.0, 1e9),
+                inventario.contarArticulosEntreCostos(10.0, 60.0),
+                inventario.calcularCostoTotalPorEstado(ArticleStatus::DAMAGED),
+                inventario.obtenerTecnicosConMasEquipos(10)};
+    }
+
+    // Cada artículo se encuentra por su código en su slot
+    void comprobarCodigos(const Inventario& inventario) {
+        for (Articulo* articulo : inventario.obtenerTodosLosArticulos()) {
+            COMPROBAR(inventario.buscarPorCodigo(articulo->GetCode()) == articulo);
+        }
+    }
+}
+
+void* operator new(std::size_t tamano) {
+    if (asignacionesRestantes == 0) throw std::bad_alloc();
+    if (asignacionesRestantes > 0) --asignacionesRestantes;
+    if (void* memoria = std::malloc(tamano == 0 ? 1 : tamano)) return memoria;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memoria) noexcept { std::free(memoria); }
+void operator delete(void* memoria, std::size_t) noexcept { std::free(memoria); }
+
+int main() {
+    Inventario inventario;
+    // Los dañados son los primeros y el último: cada baja de un operativo
+    // lleva un dañado a su slot y hace crecer ese bloque del bitmap
+    for (int n = 0; n < ARTICULOS; ++n) {
+        const bool danado = n < DANADOS - 1 || n == ARTICULOS - 1;
+        inventario.agregarArticulo(EquipoMedico(codigo(n), "01/02/2020",
+                                                danado ? ArticleStatus::DAMAGED : ArticleStatus::OPERATIONAL,
+                                                10.0 + n % 500, MarcaEquipo::GE, 5, "Tecnico " + std::to_string(n % 7),
+                                                static_cast<AreaUso>(n % 3)));
+    }
+    COMPROBAR(inventario.obtenerIndiceBitmaps().estado(ArticleStatus::DAMAGED).cardinalidad() == DANADOS);
+
+    // Operativos, dañados y el último slot, que no mueve a nadie
+    std::vector<int> bajas;
+    for (int n = DANADOS; n < DANADOS + 40; ++n) bajas.push_back(n);
+    for (int n = 0; n < 200; n += 17) bajas.push_back(n);
+    bajas.push_back(ARTICULOS - 1);
+
+    size_t fallos = 0;
+    for (const int n : bajas) {
+        const Estado antes = leer(inventario);
+        for (long k = 0;; ++k) {
+            asignacionesRestantes = k;
+            bool completada = true;
+            try {
+                COMPROBAR(inventario.eliminarArticulo(codigo(n)));
+            } catch (const std::bad_alloc&) {
+                completada = false;
+            }
+            asignacionesRestantes = -1;
+            if (completada) break;
+            ++fallos;
+            COMPROBAR(inventario.existeCodigo(codigo(n)));
+            COMPROBAR(leer(inventario) == antes);
+        }
+        COMPROBAR(!inventario.existeCodigo(codigo(n)));
+        COMPROBAR(inventario.obtenerCantidadTotal() == antes.articulos.size() - 1);
+    }
+    COMPROBAR(fallos > 0);
+
+    // Tras los fallos el inventario sigue consistente: índices, códigos y
+    // el observador de los artículos movidos
+    comprobarCodigos(inventario);
+    const IndiceBitmaps& bitmaps = inventario.obtenerIndiceBitmaps();
+    COMPROBAR(bitmaps.estado(ArticleStatus::DAMAGED).cardinalidad() ==
+              inventario.filtrarPorEstado(ArticleStatus::DAMAGED).size());
+    COMPROBAR(bitmaps.area(AreaUso::PEDIATRIA).cardinalidad() == inventario.contar(Filtro::area(AreaUso::PEDIATRIA)));
+    COMPROBAR(inventario.contarArticulosEntreCostos(0.0, 1e9) == inventario.obtenerCantidadTotal());
+    const size_t danados = inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED);
+    for (Articulo* articulo : inventario.obtenerTodosLosArticulos()) {
+        if (articulo->GetStatus() == ArticleStatus::DAMAGED) {
+            articulo->SetStatus(ArticleStatus::UNDER_REVIEW);
+            break;
+        }
+    }
+    COMPROBAR(inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED) == danados - 1);
+    COMPROBAR(bitmaps.estado(ArticleStatus::DAMAGED).cardinalidad() == danados - 1);
+    COMPROBAR(inventario.eliminarArticulo(codigo(1)));
+    comprobarCodigos(inventario);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file prueba_cambio_sin_memoria.cpp
+ * @brief A setter whose notification runs out of memory leaves article and inventory unchanged
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * The inventory reflects a change by adding the slot to the new bitmaps
+ * and ordered index entries before dropping the old ones, so it can run
+ * out of memory. Each setter is failed at its k-th allocation until one
+ * completes; after every failure the article keeps its previous value.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    long asignacionesRestantes = -1;  // -1: nunca falla
+
+    constexpr int ARTICULOS = 5000;
+    constexpr int DANADOS = 4096;  // un bloque de 65536 slots justo en UMBRAL_ARREGLO
+
+    std::string codigo(const int n) { return "EQ-" + std::to_string(n); }
+
+    // Todo lo que las consultas pueden ver del inventario
+    struct Estado {
+        size_t danados;
+        size_t bitmapDanados;
+        size_t bitmapPediatria;
+        size_t enRango;
+        size_t caros;
+        double costoTotal;
+        size_t modificados;
+        std::vector<std::pair<std::string, int>> tecnicos;
+
+        bool operator==(const Estado& otro) const {
+            return danados == otro.danados && bitmapDanados == otro.bitmapDanados &&
+                   bitmapPediatria == otro.bitmapPediatria && enRango == otro.enRango && caros == otro.caros &&
+                   costoTotal == otro.costoTotal && modificados == otro.modificados && tecnicos == otro.tecnicos;
+        }
+    };
+
+    Estado leer(const Inventario& inventario) {
+        const IndiceBitmaps& bitmaps = inventario.obtenerIndiceBitmaps();
+        return {inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED),
+                bitmaps.estado(ArticleStatus::DAMAGED).cardinalidad(),
+                bitmaps.area(AreaUso::PEDIATRIA).cardinalidad(),
+                inventario.contarArticulosEntreCostos(0.0, 1e9),
+                inventario.contarArticulosEntreCostos(5000.0, 1e9),
+                inventario.calcularCostoTotalPorEstado(ArticleStatus::DAMAGED),
+                inventario.obtenerCantidadModificados(),
+                inventario.obtenerTecnicosConMasEquipos(20)};
+    }
+
+    // Falla el cambio en la asignación k-ésima hasta que alguna llega al
+    // final; 'valor' lee el campo que el cambio toca
+    template <typename Valor>
+    size_t aplicar(const Inventario& inventario, const std::function<void()>& cambio,
+                   const std::function<Valor()>& valor) {
+        const Estado antes = leer(inventario);
+        const Valor original = valor();
+        size_t fallos = 0;
+        for (long k = 0;; ++k) {
+            asignacionesRestantes = k;
+            bool completado = true;
+            try {
+                cambio();
+            } catch (const std::bad_alloc&) {
+                completado = false;
+            }
+            asignacionesRestantes = -1;
+            if (completado) break;
+            ++fallos;
+            COMPROBAR(valor() == original);
+            COMPROBAR(leer(inventario) == antes);
+        }
+        COMPROBAR(!(valor() == original));
+        return fallos;
+    }
+}
+
+void* operator new(std::size_t tamano) {
+    if (asignacionesRestantes == 0) throw std::bad_alloc();
+    if (asignacionesRestantes > 0) --asignacionesRestantes;
+    if (void* memoria = std::malloc(tamano == 0 ? 1 : tamano)) return memoria;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memoria) noexcept { std::free(memoria); }
+void operator delete(void* memoria, std::size_t) noexcept { std::free(memoria); }
+
+int main() {
+    Inventario inventario;
+    for (int n = 0; n < ARTICULOS; ++n) {
+        inventario.agregarArticulo(EquipoMedico(codigo(n), "01/02/2020",
+                                                n < DANADOS ? ArticleStatus::DAMAGED : ArticleStatus::OPERATIONAL,
+                                                10.0 + n % 500, MarcaEquipo::GE, 5, "Tecnico " + std::to_string(n % 7),
+                                                n < DANADOS ? AreaUso::PEDIATRIA : AreaUso::EMERGENCIA));
+    }
+
+    size_t fallos = 0;
+    for (int n = DANADOS; n < DANADOS + 20; ++n) {
+        auto* equipo = static_cast<EquipoMedico*>(inventario.buscarPorCodigo(codigo(n)));
+        // Pasa el bloque de dañados y el de pediatría de arreglo a mapa
+        fallos += aplicar<ArticleStatus>(inventario, [&] { equipo->SetStatus(ArticleStatus::DAMAGED); },
+                                         [&] { return equipo->GetStatus(); });
+        fallos += aplicar<AreaUso>(inventario, [&] { equipo->setAreaUso(AreaUso::PEDIATRIA); },
+                                   [&] { return equipo->getAreaUso(); });
+        // Costos nuevos que caen todos en el mismo bloque del índice ordenado
+        fallos += aplicar<double>(inventario, [&] { equipo->SetUnitCost(6000.0 + n); },
+                                  [&] { return equipo->GetUnitCost(); });
+        fallos += aplicar<int>(inventario, [&] { equipo->setVidaUtilAnios(6 + n % 5); },
+                               [&] { return equipo->getVidaUtilAnios(); });
+        fallos += aplicar<std::string>(inventario,
+                                       [&] { equipo->setTecnicoAsignado("Nuevo " + std::to_string(n)); },
+                                       [&] { return equipo->getTecnicoAsignado(); });
+    }
+    COMPROBAR(fallos > 0);
+
+    // Tras los fallos los índices siguen de acuerdo con los artículos
+    const IndiceBitmaps& bitmaps = inventario.obtenerIndiceBitmaps();
+    COMPROBAR(bitmaps.estado(ArticleStatus::DAMAGED).cardinalidad() == DANADOS + 20);
+    COMPROBAR(inventario.filtrarPorEstado(ArticleStatus::DAMAGED).size() == DANADOS + 20);
+    COMPROBAR(bitmaps.area(AreaUso::PEDIATRIA).cardinalidad() == DANADOS + 20);
+    COMPROBAR(inventario.contarArticulosEntreCostos(6000.0, 1e9) == 20);
+    COMPROBAR(inventario.contarArticulosEntreCostos(0.0, 1e9) == ARTICULOS);
+    COMPROBAR(inventario.obtenerTecnicosConMasEquipos(100).size() == 7 + 20);
+    COMPROBAR(inventario.eliminarArticulo(codigo(DANADOS)));
+    COMPROBAR(inventario.contarArticulosEntreCostos(6000.0, 1e9) == 19);
+    return 0;
+}
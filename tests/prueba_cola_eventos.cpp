@@ -0,0 +1,247 @@
+/**
+ * @file prueba_cola_eventos.cpp
+ * @brief ColaMPSC laps and full queue; AplicadorEventos vaciar, detener and errors
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * The queue is checked alone, single-threaded across many laps of its
+ * ring and with several producers against one consumer. The applier is
+ * checked on an Inventario (per-producer order, statistics, an event
+ * that throws) and on an InventarioConcurrente whose writer lock is held
+ * so the applier stalls and the queue fills up deterministically.
+ */
+
+#include "aplicador_eventos.hpp"
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include "inventario_concurrente.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    std::string codigo(const int n) {
+        char texto[16];
+        std::snprintf(texto, sizeof texto, "EQ-%05d", n);
+        return texto;
+    }
+
+    void llenar(Inventario& inventario, const int cantidad) {
+        for (int n = 0; n < cantidad; ++n) {
+            inventario.agregarArticulo(EquipoMedico(codigo(n), "01/01/2020", ArticleStatus::OPERATIONAL, 100.0,
+                                                    MarcaEquipo::GE, 5, "Ana", AreaUso::EMERGENCIA));
+        }
+    }
+
+    void probarCapacidad() {
+        COMPROBAR(ColaMPSC<int>(0).capacidad() == 2);
+        COMPROBAR(ColaMPSC<int>(2).capacidad() == 2);
+        COMPROBAR(ColaMPSC<int>(5).capacidad() == 8);
+        COMPROBAR(ColaMPSC<int>(1024).capacidad() == 1024);
+    }
+
+    // Un hilo: llena, rechaza, y da muchas vueltas al anillo con distintos
+    // niveles de ocupación sin perder el orden
+    void probarVueltas() {
+        ColaMPSC<std::uint64_t> cola(8);
+        std::uint64_t valor = 0;
+        COMPROBAR(cola.vacia() && !cola.intentarDesencolar(valor));
+
+        for (std::uint64_t i = 0; i < 8; ++i) COMPROBAR(cola.intentarEncolar(i));
+        COMPROBAR(!cola.intentarEncolar(99));
+        COMPROBAR(cola.encolados() == 8);  // un rechazo no reserva posición
+        COMPROBAR(cola.intentarDesencolar(valor) && valor == 0);
+        COMPROBAR(cola.intentarEncolar(8));
+        COMPROBAR(!cola.intentarEncolar(99));
+
+        std::uint64_t siguiente = 1;
+        std::uint64_t encolar = 9;
+        for (int vuelta = 0; vuelta < 1000; ++vuelta) {
+            const int ocupacion = vuelta % 9;  // de vacía a llena
+            while (encolar - siguiente > static_cast<std::uint64_t>(ocupacion)) {
+                COMPROBAR(cola.intentarDesencolar(valor) && valor == siguiente);
+                ++siguiente;
+            }
+            while (cola.intentarEncolar(encolar)) ++encolar;
+            COMPROBAR(encolar - siguiente == 8);
+        }
+        while (cola.intentarDesencolar(valor)) COMPROBAR(valor == siguiente++);
+        COMPROBAR(siguiente == encolar && cola.vacia());
+        COMPROBAR(cola.encolados() == encolar);
+    }
+
+    // Varios productores contra una cola pequeña: nada se pierde ni se
+    // duplica, y lo de cada productor sale en su orden
+    void probarProductores() {
+        constexpr int PRODUCTORES = 4;
+        constexpr std::uint64_t POR_PRODUCTOR = 20000;
+        ColaMPSC<std::uint64_t> cola(16);
+        std::vector<std::thread> productores;
+        for (int p = 0; p < PRODUCTORES; ++p) {
+            productores.emplace_back([&cola, p] {
+                for (std::uint64_t i = 0; i < POR_PRODUCTOR; ++i) {
+                    while (!cola.intentarEncolar(static_cast<std::uint64_t>(p) << 32 | i)) std::this_thread::yield();
+                }
+            });
+        }
+        std::vector<std::uint64_t> esperado(PRODUCTORES, 0);
+        std::uint64_t recibidos = 0;
+        std::uint64_t valor = 0;
+        while (recibidos < PRODUCTORES * POR_PRODUCTOR) {
+            if (!cola.intentarDesencolar(valor)) {
+                std::this_thread::yield();
+                continue;
+            }
+            const auto p = static_cast<std::size_t>(valor >> 32);
+            COMPROBAR(p < esperado.size() && (valor & 0xFFFFFFFFu) == esperado[p]);
+            ++esperado[p];
+            ++recibidos;
+        }
+        for (std::thread& productor : productores) productor.join();
+        COMPROBAR(cola.vacia() && cola.encolados() == PRODUCTORES * POR_PRODUCTOR);
+        for (const std::uint64_t cantidad : esperado) COMPROBAR(cantidad == POR_PRODUCTOR);
+    }
+
+    // Cada productor sube el costo de su propio artículo: el último valor
+    // publicado es el que queda
+    void probarVaciar() {
+        constexpr int PRODUCTORES = 4;
+        constexpr int POR_PRODUCTOR = 2000;
+        Inventario inventario;
+        llenar(inventario, PRODUCTORES);
+        AplicadorEventos aplicador(inventario, 64, 16);
+        std::vector<std::thread> productores;
+        for (int p = 0; p < PRODUCTORES; ++p) {
+            productores.emplace_back([&aplicador, p] {
+                for (int i = 1; i <= POR_PRODUCTOR; ++i) {
+                    COMPROBAR(aplicador.publicarEsperando(EventoInventario::cambioCosto(codigo(p), i)));
+                }
+            });
+        }
+        for (std::thread& productor : productores) productor.join();
+        COMPROBAR(aplicador.publicarEsperando(EventoInventario::cambioEstado("NO-EXISTE", ArticleStatus::DAMAGED)));
+        COMPROBAR(aplicador.publicarEsperando(EventoInventario::cambioEstado(codigo(0), ArticleStatus::DAMAGED)));
+        aplicador.vaciar();
+
+        // Tras vaciar() el aplicador está al día y se puede leer el inventario
+        for (int p = 0; p < PRODUCTORES; ++p) COMPROBAR(inventario.buscarPorCodigo(codigo(p))->GetUnitCost() == POR_PRODUCTOR);
+        COMPROBAR(inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED) == 1);
+        const EstadisticasAplicador estadisticas = aplicador.obtenerEstadisticas();
+        COMPROBAR(estadisticas.aplicados == PRODUCTORES * POR_PRODUCTOR + 1);
+        COMPROBAR(estadisticas.desconocidos == 1);
+        COMPROBAR(estadisticas.lotes >= (PRODUCTORES * POR_PRODUCTOR + 2) / 16);
+        COMPROBAR(estadisticas.rechazados == 0);
+        aplicador.vaciar();  // sin nada pendiente vuelve enseguida
+
+        // detener() aplica lo que quede; después no se acepta nada
+        for (int i = 0; i < 10; ++i) {
+            COMPROBAR(aplicador.publicarEsperando(EventoInventario::cambioEstado(codigo(1), ArticleStatus::UNDER_REVIEW)));
+        }
+        aplicador.detener();
+        COMPROBAR(inventario.buscarPorCodigo(codigo(1))->GetStatus() == ArticleStatus::UNDER_REVIEW);
+        COMPROBAR(!aplicador.publicar(EventoInventario::cambioEstado(codigo(1), ArticleStatus::DAMAGED)));
+        COMPROBAR(!aplicador.publicarEsperando(EventoInventario::cambioEstado(codigo(1), ArticleStatus::DAMAGED)));
+        aplicador.detener();
+        aplicador.vaciar();
+        COMPROBAR(inventario.buscarPorCodigo(codigo(1))->GetStatus() == ArticleStatus::UNDER_REVIEW);
+    }
+
+    // Un evento que no pasa por las fábricas lleva un costo inválido: el
+    // lote lanza, el aplicador se detiene y el error llega una sola vez
+    void probarError() {
+        Inventario inventario;
+        llenar(inventario, 3);
+        AplicadorEventos aplicador(inventario, 16, 1);
+        EventoInventario invalido = EventoInventario::cambioCosto(codigo(1), 5.0);
+        invalido.costo = -1.0;
+        COMPROBAR(aplicador.publicar(EventoInventario::cambioCosto(codigo(0), 7.0)));
+        COMPROBAR(aplicador.publicar(invalido));
+        aplicador.publicar(EventoInventario::cambioCosto(codigo(2), 9.0));
+        bool lanzado = false;
+        try {
+            aplicador.vaciar();
+        } catch (const std::invalid_argument&) {
+            lanzado = true;
+        }
+        COMPROBAR(lanzado);
+        COMPROBAR(inventario.buscarPorCodigo(codigo(0))->GetUnitCost() == 7.0);
+        COMPROBAR(inventario.buscarPorCodigo(codigo(1))->GetUnitCost() == 100.0);
+        COMPROBAR(inventario.buscarPorCodigo(codigo(2))->GetUnitCost() == 100.0);
+        COMPROBAR(!aplicador.publicar(EventoInventario::cambioCosto(codigo(2), 9.0)));
+        COMPROBAR(aplicador.obtenerEstadisticas().aplicados == 1);
+        aplicador.vaciar();
+        aplicador.detener();
+
+        // Sin vaciar() el error lo entrega detener(); el destructor lo descarta
+        AplicadorEventos otro(inventario, 16, 1);
+        COMPROBAR(otro.publicar(invalido));
+        lanzado = false;
+        try {
+            otro.detener();
+        } catch (const std::invalid_argument&) {
+            lanzado = true;
+        }
+        COMPROBAR(lanzado);
+        AplicadorEventos descartado(inventario, 16, 1);
+        descartado.publicar(invalido);
+    }
+
+    // Con el escritor de InventarioConcurrente tomado el aplicador se queda
+    // con un evento a medio aplicar y la cola se llena: publicar() lo
+    // rechaza y lo cuenta, y publicarEsperando() espera a que se libere
+    void probarColaLlena() {
+        Inventario base;
+        llenar(base, 64);
+        InventarioConcurrente concurrente(base);
+        AplicadorEventos aplicador(concurrente, 4, 1);
+        int aceptados = 0;
+        std::thread esperando;
+        std::atomic<bool> publicado{false};
+        concurrente.modificar([&](EscrituraInventario&) {
+            // Tras el primer evento el aplicador se bloquea esperando al escritor
+            COMPROBAR(aplicador.publicar(EventoInventario::cambioCosto(codigo(0), 1.0)));
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            int n = 1;
+            for (int intento = 0; intento < 2; ++intento) {
+                while (aplicador.publicar(EventoInventario::cambioCosto(codigo(n), 1.0 + n))) {
+                    ++n;
+                    COMPROBAR(n <= 5);  // cuatro celdas más el evento que el aplicador retiene
+                }
+            }
+            aceptados = n;
+            COMPROBAR(aceptados >= 4);
+            COMPROBAR(aplicador.obtenerEstadisticas().rechazados == 2);
+            esperando = std::thread([&] {
+                COMPROBAR(aplicador.publicarEsperando(EventoInventario::cambioCosto(codigo(63), 3.0)));
+                publicado = true;
+            });
+            // Con cinco aceptados el aplicador ya retiene uno: no queda hueco
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            if (aceptados == 5) COMPROBAR(!publicado);
+        });
+        esperando.join();
+        aplicador.vaciar();
+        const LecturaInventario lectura = concurrente.leer();
+        for (int n = 0; n < aceptados; ++n) COMPROBAR(lectura.buscarPorCodigo(codigo(n))->GetUnitCost() == 1.0 + n);
+        COMPROBAR(lectura.buscarPorCodigo(codigo(63))->GetUnitCost() == 3.0);
+        const EstadisticasAplicador estadisticas = aplicador.obtenerEstadisticas();
+        COMPROBAR(estadisticas.aplicados == static_cast<std::uint64_t>(aceptados) + 1 && estadisticas.rechazados == 2);
+    }
+}
+
+int main() {
+    probarCapacidad();
+    probarVueltas();
+    probarProductores();
+    probarVaciar();
+    probarError();
+    probarColaLlena();
+    return 0;
+}
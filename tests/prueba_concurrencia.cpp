@@ -0,0 +1,209 @@
+/**
+ * @file prueba_concurrencia.cpp
+ * @brief Snapshot isolation of InventarioConcurrente under concurrent readers and writers
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Every reader works on one published version and checks that its
+ * counters, index and filters agree with a full walk of that version.
+ * Writers mix single updates, batches and inserts meanwhile.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include "inventario_concurrente.hpp"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    constexpr int ARTICULOS = 5000;
+    const char* const TECNICOS[] = {"Ana", "Luis", "Marta"};
+
+    std::string codigo(const char* prefijo, const int n) {
+        char texto[24];
+        std::snprintf(texto, sizeof texto, "%s-%07d", prefijo, n);
+        return texto;
+    }
+
+    std::string codigoExistente(const int n) { return codigo(n % 2 != 0 ? "EQ" : "MB", n); }
+
+    bool cerca(const double a, const double b) { return std::fabs(a - b) <= 1e-6 * (1.0 + std::fabs(a)); }
+
+    void llenar(Inventario& inventario) {
+        for (int i = 0; i < ARTICULOS; ++i) {
+            if (i % 2 != 0) {
+                inventario.agregarArticulo(EquipoMedico(codigoExistente(i), "01/01/2020",
+                                                        i % 7 != 0 ? ArticleStatus::OPERATIONAL : ArticleStatus::DAMAGED,
+                                                        100.0 + i % 1000, MarcaEquipo::GE, 5, TECNICOS[i % 3],
+                                                        i % 3 != 0 ? AreaUso::EMERGENCIA : AreaUso::PEDIATRIA));
+            } else {
+                inventario.agregarArticulo(MobiliarioClinico(codigoExistente(i), "01/01/2020", ArticleStatus::OPERATIONAL,
+                                                             10.0 + i % 5, "madera", AreaUbicacion::CONSULTA));
+            }
+        }
+    }
+
+    // La lectura debe dar lo mismo que el inventario secuencial de referencia
+    void comparar(const Inventario& inventario, const LecturaInventario& lectura) {
+        COMPROBAR(lectura.obtenerCantidadTotal() == inventario.obtenerCantidadTotal());
+        const std::vector<Articulo*> todos = inventario.obtenerTodosLosArticulos();
+        for (std::size_t slot = 0; slot < todos.size(); ++slot) {
+            const Articulo& articulo = lectura.articulo(slot);
+            COMPROBAR(articulo.GetCode() == todos[slot]->GetCode());
+            COMPROBAR(articulo.GetStatus() == todos[slot]->GetStatus());
+            COMPROBAR(articulo.GetUnitCost() == todos[slot]->GetUnitCost());
+            COMPROBAR(lectura.buscarPorCodigo(articulo.GetCode()) == &articulo && articulo.GetSlot() == slot);
+        }
+        COMPROBAR(lectura.buscarPorCodigo("NO-EXISTE") == nullptr);
+        COMPROBAR(lectura.contarEquiposPorTecnico() == inventario.contarEquiposPorTecnico());
+        COMPROBAR(lectura.contarEquiposPorArea() == inventario.contarEquiposPorArea());
+        COMPROBAR(lectura.contarMobiliarioPorArea() == inventario.contarMobiliarioPorArea());
+        for (const ArticleStatus estado : {ArticleStatus::OPERATIONAL, ArticleStatus::DAMAGED, ArticleStatus::UNDER_REVIEW}) {
+            COMPROBAR(lectura.filtrarPorEstado(estado).size() == inventario.filtrarPorEstado(estado).size());
+            COMPROBAR(lectura.obtenerCantidadPorEstado(estado) == inventario.obtenerCantidadPorEstado(estado));
+            COMPROBAR(cerca(lectura.calcularCostoTotalPorEstado(estado), inventario.calcularCostoTotalPorEstado(estado)));
+        }
+        for (const ArticleType tipo : {ArticleType::MEDICAL_EQUIPMENT, ArticleType::CLINICAL_FURNITURE}) {
+            COMPROBAR(lectura.obtenerCantidadPorTipo(tipo) == inventario.obtenerCantidadPorTipo(tipo));
+            COMPROBAR(cerca(lectura.calcularCostoTotalPorCategoria(tipo), inventario.calcularCostoTotalPorCategoria(tipo)));
+        }
+        COMPROBAR(lectura.obtenerCostosMinMax() == inventario.obtenerCostosMinMax());
+        COMPROBAR(cerca(lectura.calcularDepreciacionTotal(), inventario.calcularDepreciacionTotal()));
+    }
+
+    // Lectores contra escritores: cada versión es coherente consigo misma
+    void estres(InventarioConcurrente& concurrente) {
+        std::atomic<bool> fin{false};
+        std::vector<std::thread> escritores;
+        std::vector<std::thread> lectores;
+        for (int w = 0; w < 2; ++w) {
+            escritores.emplace_back([&concurrente, w] {
+                std::mt19937 azar(static_cast<unsigned>(w));
+                for (int k = 0; k < 3000; ++k) {
+                    const int i = static_cast<int>(azar() % ARTICULOS);
+                    if (k % 100 == 0) {
+                        concurrente.agregarArticulo(MobiliarioClinico(codigo(w != 0 ? "MW" : "MV", k), "01/01/2021",
+                                                                      ArticleStatus::OPERATIONAL, 5.0, "acero",
+                                                                      AreaUbicacion::QUIROFANO));
+                    } else if (k % 3 != 0) {
+                        concurrente.actualizarEstado(codigoExistente(i), static_cast<ArticleStatus>(azar() % 3));
+                    } else {
+                        concurrente.modificar([&azar](EscrituraInventario& escritura) {
+                            for (int j = 0; j < 20; ++j) {
+                                escritura.editar(azar() % escritura.obtenerCantidadTotal())
+                                    .SetUnitCost(static_cast<double>(azar() % 1000));
+                            }
+                        });
+                    }
+                }
+            });
+        }
+        for (int r = 0; r < 4; ++r) {
+            lectores.emplace_back([&concurrente, &fin] {
+                std::uint64_t ultima = 0;
+                while (!fin) {
+                    const LecturaInventario lectura = concurrente.leer();
+                    COMPROBAR(lectura.obtenerNumeroVersion() >= ultima);
+                    ultima = lectura.obtenerNumeroVersion();
+                    std::size_t total = 0;
+                    std::array<std::size_t, 3> porEstado{};
+                    lectura.paraCada([&](const Articulo& articulo) {
+                        ++total;
+                        ++porEstado[static_cast<std::size_t>(articulo.GetStatus())];
+                    });
+                    COMPROBAR(total == lectura.obtenerCantidadTotal());
+                    for (std::size_t estado = 0; estado < porEstado.size(); ++estado) {
+                        COMPROBAR(porEstado[estado] == lectura.obtenerCantidadPorEstado(static_cast<ArticleStatus>(estado)));
+                    }
+                    COMPROBAR(lectura.filtrarPorEstado(ArticleStatus::DAMAGED).size() ==
+                              porEstado[static_cast<std::size_t>(ArticleStatus::DAMAGED)]);
+                    COMPROBAR(lectura.buscarPorCodigo(lectura.articulo(total - 1).GetCode())->GetSlot() == total - 1);
+                }
+            });
+        }
+        for (std::thread& escritor : escritores) escritor.join();
+        fin = true;
+        for (std::thread& lector : lectores) lector.join();
+    }
+}
+
+int main() {
+    Inventario inventario;
+    llenar(inventario);
+    InventarioConcurrente concurrente(inventario);
+    {
+        LecturaInventario lectura = concurrente.leer();
+        comparar(inventario, lectura);
+        lectura.configurarUmbralParalelo(0);
+        comparar(inventario, lectura);
+    }
+
+    // Los mismos cambios en ambos; la lectura tomada antes no los ve
+    std::optional<LecturaInventario> vieja(concurrente.leer());
+    for (int i = 0; i < 300; ++i) {
+        const std::string clave = codigoExistente(i * 13 % ARTICULOS);
+        inventario.buscarPorCodigo(clave)->SetStatus(ArticleStatus::UNDER_REVIEW);
+        COMPROBAR(concurrente.actualizarEstado(clave, ArticleStatus::UNDER_REVIEW));
+        inventario.buscarPorCodigo(clave)->SetUnitCost(50.0 + i);
+        COMPROBAR(concurrente.actualizarCosto(clave, 50.0 + i));
+    }
+    COMPROBAR(!concurrente.actualizarEstado("NO-EXISTE", ArticleStatus::DAMAGED));
+    const auto nuevo = [](const double costo) {
+        return EquipoMedico("EQ-NUEVO", "02/02/2022", ArticleStatus::DAMAGED, costo, MarcaEquipo::GE, 3, "Pedro",
+                            AreaUso::PEDIATRIA);
+    };
+    inventario.agregarArticulo(nuevo(999.0));
+    COMPROBAR(concurrente.agregarArticulo(nuevo(999.0)));
+    COMPROBAR(!concurrente.agregarArticulo(nuevo(1.0)));
+    concurrente.modificar([](EscrituraInventario& escritura) {
+        auto& equipo = static_cast<EquipoMedico&>(*escritura.editar("EQ-0000001"));
+        equipo.setTecnicoAsignado("Zoe");
+        equipo.setAreaUso(AreaUso::PEDIATRIA);
+        escritura.editar("EQ-0000001")->SetStatus(ArticleStatus::DAMAGED);
+    });
+    auto* equipo = static_cast<EquipoMedico*>(inventario.buscarPorCodigo("EQ-0000001"));
+    equipo->setTecnicoAsignado("Zoe");
+    equipo->setAreaUso(AreaUso::PEDIATRIA);
+    equipo->SetStatus(ArticleStatus::DAMAGED);
+    comparar(inventario, concurrente.leer());
+
+    COMPROBAR(vieja->obtenerCantidadTotal() == static_cast<std::size_t>(ARTICULOS));
+    COMPROBAR(vieja->buscarPorCodigo("EQ-NUEVO") == nullptr);
+    COMPROBAR(vieja->articulo(1).GetStatus() == ArticleStatus::OPERATIONAL);
+    COMPROBAR(concurrente.obtenerPendientesDeLiberar() > 0);
+
+    // Un lote que lanza no publica nada
+    const std::uint64_t version = concurrente.leer().obtenerNumeroVersion();
+    bool lanzo = false;
+    try {
+        concurrente.modificar([](EscrituraInventario& escritura) {
+            escritura.editar(3).SetStatus(ArticleStatus::DAMAGED);
+            escritura.agregarArticulo(MobiliarioClinico("MB-X9", "01/01/2020", ArticleStatus::OPERATIONAL, 1.0, "x",
+                                                        AreaUbicacion::CONSULTA));
+            escritura.editar(5).SetUnitCost(-1.0);
+        });
+    } catch (const std::invalid_argument&) {
+        lanzo = true;
+    }
+    COMPROBAR(lanzo);
+    COMPROBAR(concurrente.leer().obtenerNumeroVersion() == version && !concurrente.leer().existeCodigo("MB-X9"));
+    vieja.reset();
+    comparar(inventario, concurrente.leer());
+
+    estres(concurrente);
+    // Sin lectores vivos todo lo reemplazado se puede liberar
+    concurrente.actualizarFechaCorte(FechaCorte::Hoy());
+    COMPROBAR(concurrente.obtenerPendientesDeLiberar() == 0);
+    COMPROBAR(concurrente.leer().obtenerCantidadTotal() == static_cast<std::size_t>(ARTICULOS) + 1 + 60);
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file prueba_filtro.cpp
+ * @brief Composed Filtro predicates against the same conditions written on the articles
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Each expression built with &&, || and ! must select exactly the
+ * articles, in slot order, that a plain test on the article getters
+ * selects, serially and with the parallel scan. Areas of equipment and
+ * furniture that share a numeric value stay apart, brands never match
+ * furniture, unknown technicians match nothing, interval ends are
+ * included, and a stored expression follows later changes.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    constexpr int ARTICULOS = 3000;
+    const char* const TECNICOS[] = {"Ana", "Luis", "Marta"};
+
+    using Condicion = std::function<bool(const Articulo&)>;
+
+    const EquipoMedico* equipo(const Articulo& articulo) {
+        return articulo.GetType() == ArticleType::MEDICAL_EQUIPMENT ? &static_cast<const EquipoMedico&>(articulo)
+                                                                    : nullptr;
+    }
+
+    const MobiliarioClinico* mueble(const Articulo& articulo) {
+        return articulo.GetType() == ArticleType::CLINICAL_FURNITURE
+                   ? &static_cast<const MobiliarioClinico&>(articulo)
+                   : nullptr;
+    }
+
+    // Lo que devuelve filtrar() y cuenta contar() es lo que elige 'condicion'
+    template <typename Expresion>
+    void comprobar(const Inventario& inventario, const Filtro::Predicado<Expresion>& expresion,
+                   const Condicion& condicion) {
+        std::vector<Articulo*> esperados;
+        for (Articulo* articulo : inventario.obtenerTodosLosArticulos()) {
+            if (condicion(*articulo)) esperados.push_back(articulo);
+        }
+        COMPROBAR(inventario.filtrar(expresion) == esperados);
+        COMPROBAR(inventario.contar(expresion) == esperados.size());
+    }
+
+    void comprobarTodo(Inventario& inventario) {
+        const FechaCorte corte = inventario.obtenerFechaCorte();
+        const std::int32_t desde = Fecha::diasDesdeCivil(2020, 1, 1);
+        const std::int32_t hasta = Fecha::diasDesdeCivil(2021, 12, 31);
+        const std::int32_t dia = Fecha::diasDesdeCivil(2018, 1, 1);
+
+        comprobar(inventario,
+                  Filtro::estado(ArticleStatus::DAMAGED) && Filtro::marca(MarcaEquipo::GE) &&
+                      Filtro::costoUnitarioEntre(500.0, 2000.0),
+                  [](const Articulo& a) {
+                      const EquipoMedico* e = equipo(a);
+                      return a.GetStatus() == ArticleStatus::DAMAGED && e && e->getMarca() == MarcaEquipo::GE &&
+                             a.GetUnitCost() >= 500.0 && a.GetUnitCost() <= 2000.0;
+                  });
+        comprobar(inventario, Filtro::tipo(ArticleType::CLINICAL_FURNITURE) || Filtro::estado(ArticleStatus::UNDER_REVIEW),
+                  [](const Articulo& a) {
+                      return a.GetType() == ArticleType::CLINICAL_FURNITURE || a.GetStatus() == ArticleStatus::UNDER_REVIEW;
+                  });
+        // Mismo valor numérico, distinto tipo de área
+        comprobar(inventario, Filtro::area(AreaUso::EMERGENCIA), [](const Articulo& a) {
+            const EquipoMedico* e = equipo(a);
+            return e && e->getAreaUso() == AreaUso::EMERGENCIA;
+        });
+        comprobar(inventario, Filtro::area(AreaUbicacion::CONSULTA), [](const Articulo& a) {
+            const MobiliarioClinico* m = mueble(a);
+            return m && m->getAreaUbicacion() == AreaUbicacion::CONSULTA;
+        });
+        // La marca nunca elige mobiliario, ni negada dentro de un &&
+        comprobar(inventario, !Filtro::marca(MarcaEquipo::PHILIPS) && Filtro::tipo(ArticleType::MEDICAL_EQUIPMENT),
+                  [](const Articulo& a) {
+                      const EquipoMedico* e = equipo(a);
+                      return e && e->getMarca() != MarcaEquipo::PHILIPS;
+                  });
+        comprobar(inventario,
+                  (Filtro::estado(ArticleStatus::DAMAGED) || Filtro::estado(ArticleStatus::UNDER_REVIEW)) &&
+                      !(Filtro::area(AreaUbicacion::QUIROFANO) || Filtro::area(AreaUso::QUIROFANO)),
+                  [](const Articulo& a) {
+                      const bool quirofano = (equipo(a) && equipo(a)->getAreaUso() == AreaUso::QUIROFANO) ||
+                                             (mueble(a) && mueble(a)->getAreaUbicacion() == AreaUbicacion::QUIROFANO);
+                      return a.GetStatus() != ArticleStatus::OPERATIONAL && !quirofano;
+                  });
+        comprobar(inventario, !!Filtro::tipo(ArticleType::MEDICAL_EQUIPMENT),
+                  [](const Articulo& a) { return equipo(a) != nullptr; });
+
+        // Técnico e ingreso
+        comprobar(inventario, Filtro::tecnico("Ana") && Filtro::ingresoEntre("01/01/2020", "31/12/2021"),
+                  [desde, hasta](const Articulo& a) {
+                      const EquipoMedico* e = equipo(a);
+                      return e && e->getTecnicoAsignado() == "Ana" && a.GetEntryDay() >= desde &&
+                             a.GetEntryDay() <= hasta;
+                  });
+        comprobar(inventario, Filtro::tecnico("Nadie con este nombre"), [](const Articulo&) { return false; });
+        comprobar(inventario, !Filtro::tecnico("Nadie con este nombre"), [](const Articulo&) { return true; });
+
+        // Extremos incluidos, e intervalos de un solo valor o invertidos
+        comprobar(inventario, Filtro::costoUnitarioEntre(150.0, 150.0),
+                  [](const Articulo& a) { return a.GetUnitCost() == 150.0; });
+        comprobar(inventario, Filtro::costoUnitarioEntre(200.0, 100.0), [](const Articulo&) { return false; });
+        comprobar(inventario, Filtro::ingresoEntre(dia, dia),
+                  [dia](const Articulo& a) { return a.GetEntryDay() == dia; });
+        comprobar(inventario, Filtro::costoTotalEntre(0.0, 300.0) && Filtro::tipo(ArticleType::MEDICAL_EQUIPMENT),
+                  [&corte](const Articulo& a) {
+                      const EquipoMedico* e = equipo(a);
+                      return e && e->CalculateTotalCost(corte) <= 300.0;
+                  });
+    }
+}
+
+// Las expresiones son tipos concretos, sin funciones virtuales
+static_assert(std::is_same_v<decltype(Filtro::estado(ArticleStatus::DAMAGED) && Filtro::tipo(ArticleType::MEDICAL_EQUIPMENT)),
+                             Filtro::Y<Filtro::Estado, Filtro::Tipo>>);
+static_assert(!std::is_polymorphic_v<Filtro::O<Filtro::Y<Filtro::Estado, Filtro::Marca>, Filtro::No<Filtro::Area>>>);
+
+int main() {
+    Inventario inventario;
+    for (int n = 0; n < ARTICULOS; ++n) {
+        const auto estado = static_cast<ArticleStatus>(n % 3);
+        const std::string fecha = "01/0" + std::to_string(1 + n % 9) + "/20" + std::to_string(18 + n % 6);
+        if (n % 5 != 0) {
+            inventario.agregarArticulo(EquipoMedico("EQ-" + std::to_string(n), fecha, estado, 50.0 * (n % 50),
+                                                    static_cast<MarcaEquipo>(n % 4), 1 + n % 10, TECNICOS[n % 3],
+                                                    static_cast<AreaUso>(n % 3)));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico("MB-" + std::to_string(n), fecha, estado, 50.0 * (n % 7),
+                                                         "acero", static_cast<AreaUbicacion>(n / 5 % 3)));
+        }
+    }
+    comprobarTodo(inventario);
+    inventario.configurarUmbralParalelo(0);
+    comprobarTodo(inventario);
+    inventario.configurarUmbralParalelo(100);
+    comprobarTodo(inventario);
+
+    // Una expresión guardada sigue a los cambios del inventario
+    const auto danadosGe = Filtro::estado(ArticleStatus::DAMAGED) && Filtro::marca(MarcaEquipo::GE);
+    const size_t antes = inventario.contar(danadosGe);
+    Articulo* operativo = nullptr;
+    for (Articulo* articulo : inventario.filtrar(Filtro::marca(MarcaEquipo::GE) && !Filtro::estado(ArticleStatus::DAMAGED))) {
+        operativo = articulo;
+        break;
+    }
+    COMPROBAR(operativo != nullptr);
+    operativo->SetStatus(ArticleStatus::DAMAGED);
+    COMPROBAR(inventario.contar(danadosGe) == antes + 1);
+    COMPROBAR(inventario.eliminarArticulo(operativo->GetCode()));
+    COMPROBAR(inventario.contar(danadosGe) == antes);
+    comprobarTodo(inventario);
+
+    bool lanzo = false;
+    try {
+        Filtro::ingresoEntre("31/02/2020", "01/01/2021");
+    } catch (const std::invalid_argument&) {
+        lanzo = true;
+    }
+    COMPROBAR(lanzo);
+    return 0;
+}
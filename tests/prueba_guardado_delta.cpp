@@ -0,0 +1,170 @@
+/**
+ * @file prueba_guardado_delta.cpp
+ * @brief Incremental save: delta segment round trip, fallbacks and rejection
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * guardarCambios() writes only the modified slots next to the base and
+ * leaves the base untouched; loading applies the delta. A delta left over
+ * from an older base is ignored, a base rewritten behind the tracker's
+ * back or too many changes fall back to a full snapshot, and a damaged
+ * delta is rejected.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include "snapshot_inventario.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    constexpr int ARTICULOS = 4000;
+
+    std::string codigo(const int n) { return (n % 3 != 0 ? "EQ" : "MB") + std::to_string(n); }
+
+    void agregar(Inventario& inventario, const int n) {
+        const auto estado = static_cast<ArticleStatus>(n % 3);
+        if (n % 3 != 0) {
+            inventario.agregarArticulo(EquipoMedico(codigo(n), "01/02/2020", estado, 100.0 + n % 700,
+                                                    static_cast<MarcaEquipo>(n % 4), 1 + n % 9,
+                                                    "Técnico " + std::to_string(n % 40), static_cast<AreaUso>(n % 3)));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico(codigo(n), "01/02/2020", estado, 50.0 + n % 300,
+                                                         "Acero " + std::to_string(n % 5),
+                                                         static_cast<AreaUbicacion>(n % 3)));
+        }
+    }
+
+    void comprobarIguales(const Inventario& a, const Inventario& b) {
+        const std::vector<Articulo*> x = a.obtenerTodosLosArticulos();
+        const std::vector<Articulo*> y = b.obtenerTodosLosArticulos();
+        COMPROBAR(x.size() == y.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            COMPROBAR(x[i]->GetDetailedInfo() == y[i]->GetDetailedInfo());
+            COMPROBAR(x[i]->GetUnitCost() == y[i]->GetUnitCost());
+        }
+        COMPROBAR(a.obtenerCantidadPorEstado(ArticleStatus::DAMAGED) == b.obtenerCantidadPorEstado(ArticleStatus::DAMAGED));
+        COMPROBAR(a.obtenerTecnicosConMasEquipos(50) == b.obtenerTecnicosConMasEquipos(50));
+        COMPROBAR(a.contarArticulosEntreCostos(300.0, 700.0) == b.contarArticulosEntreCostos(300.0, 700.0));
+    }
+
+    std::vector<char> leer(const std::string& ruta) {
+        std::ifstream archivo(ruta, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+    }
+
+    void escribir(const std::string& ruta, const std::vector<char>& datos) {
+        std::ofstream(ruta, std::ios::binary).write(datos.data(), static_cast<std::streamsize>(datos.size()));
+    }
+
+    void cargarIgual(const Inventario& inventario, const std::string& ruta) {
+        Inventario cargado;
+        cargado.cargarDeArchivo(ruta);
+        comprobarIguales(inventario, cargado);
+    }
+
+    // Una tanda de cambios de todo tipo, altas y bajas incluidas
+    void cambiar(Inventario& inventario, const int desde, const int cantidad) {
+        for (int n = desde; n < desde + cantidad; ++n) {
+            Articulo* articulo = inventario.buscarPorCodigo(codigo(n));
+            if (articulo == nullptr) continue;
+            switch (n % 5) {
+                case 0: articulo->SetStatus(ArticleStatus::DAMAGED); break;
+                case 1: articulo->SetUnitCost(articulo->GetUnitCost() + 0.5); break;
+                case 2:
+                case 3: {
+                    auto* equipo = dynamic_cast<EquipoMedico*>(articulo);
+                    if (equipo == nullptr) static_cast<MobiliarioClinico*>(articulo)->setMaterial("Madera");
+                    else if (n % 5 == 2) equipo->setTecnicoAsignado("Turno " + std::to_string(n));
+                    else equipo->setAreaUso(AreaUso::QUIROFANO);
+                    break;
+                }
+                default: inventario.eliminarArticulo(codigo(n)); break;
+            }
+        }
+        for (int n = 0; n < cantidad / 10; ++n) agregar(inventario, ARTICULOS + desde + n);
+    }
+}
+
+int main() {
+    const std::filesystem::path carpeta = std::filesystem::temp_directory_path() / "prueba_guardado_delta";
+    std::filesystem::create_directories(carpeta);
+    const std::string ruta = (carpeta / "inventario.bin").string();
+    const std::string rutaDelta = SnapshotInventario::rutaDelta(ruta);
+
+    Inventario inventario;
+    for (int n = 0; n < ARTICULOS; ++n) agregar(inventario, n);
+    inventario.fusionarCambios(ruta);
+    COMPROBAR(inventario.obtenerCantidadModificados() == 0 && !std::filesystem::exists(rutaDelta));
+    const std::vector<char> base = leer(ruta);
+
+    // Los cambios van al delta; la base no se toca
+    cambiar(inventario, 1, 100);
+    COMPROBAR(inventario.obtenerCantidadModificados() > 0);
+    inventario.guardarCambios(ruta);
+    COMPROBAR(std::filesystem::exists(rutaDelta) && leer(ruta) == base);
+    COMPROBAR(std::filesystem::file_size(rutaDelta) * 10 < base.size());
+    cargarIgual(inventario, ruta);
+    Inventario cargado;
+    cargado.cargarDeArchivo(ruta);
+    COMPROBAR(cargado.obtenerCantidadModificados() > 0);  // el delta sigue pendiente de fusionar
+
+    // El delta es acumulativo desde la base
+    const std::vector<char> primerDelta = leer(rutaDelta);
+    cambiar(inventario, 500, 100);
+    inventario.guardarCambios(ruta);
+    COMPROBAR(leer(ruta) == base && leer(rutaDelta).size() > primerDelta.size());
+    cargarIgual(inventario, ruta);
+    // Lo cargado con su delta sigue guardando en incremental sobre la misma base
+    cargado.buscarPorCodigo(codigo(2000))->SetStatus(ArticleStatus::UNDER_REVIEW);
+    cargado.guardarCambios(ruta);
+    COMPROBAR(leer(ruta) == base);
+    cargarIgual(cargado, ruta);
+    inventario.guardarCambios(ruta);
+
+    // Un byte alterado en el delta se rechaza
+    std::vector<char> alterado = leer(rutaDelta);
+    alterado[alterado.size() / 2] ^= 0x40;
+    escribir(rutaDelta, alterado);
+    bool rechazado = false;
+    try {
+        cargado.cargarDeArchivo(ruta);
+    } catch (const std::runtime_error&) {
+        rechazado = true;
+    }
+    COMPROBAR(rechazado);
+
+    // Fusionar reescribe la base y borra el delta; uno anterior que vuelva
+    // a aparecer no corresponde a la base nueva y se ignora
+    inventario.fusionarCambios(ruta);
+    COMPROBAR(!std::filesystem::exists(rutaDelta) && inventario.obtenerCantidadModificados() == 0);
+    escribir(rutaDelta, primerDelta);
+    cargarIgual(inventario, ruta);
+    std::filesystem::remove(rutaDelta);
+
+    // Otra base escrita por detrás: el siguiente guardado es completo
+    Inventario otro;
+    agregar(otro, 1);
+    otro.guardarEnArchivo(ruta);
+    inventario.buscarPorCodigo(codigo(7))->SetStatus(ArticleStatus::DAMAGED);
+    inventario.guardarCambios(ruta);
+    COMPROBAR(!std::filesystem::exists(rutaDelta) && inventario.obtenerCantidadModificados() == 0);
+    cargarIgual(inventario, ruta);
+
+    // Con más de un cuarto del inventario cambiado también
+    for (Articulo* articulo : inventario.obtenerTodosLosArticulos()) {
+        if (articulo->GetStatus() != ArticleStatus::UNDER_REVIEW) articulo->SetStatus(ArticleStatus::UNDER_REVIEW);
+    }
+    inventario.guardarCambios(ruta);
+    COMPROBAR(!std::filesystem::exists(rutaDelta) && inventario.obtenerCantidadModificados() == 0);
+    cargarIgual(inventario, ruta);
+
+    std::filesystem::remove_all(carpeta);
+    return 0;
+}
@@ -0,0 +1,291 @@
+/**
+ * @file prueba_indice_costos.cpp
+ * @brief Ordered cost index against sorting the cost columns, through inserts, removals and updates
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "comprobar.hpp"
+#include "archivo_columnar.hpp"
+#include "indice_ordenado.hpp"
+#include "inventario.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    struct Entrada {
+        double valor;
+        std::uint32_t slot;
+    };
+
+    bool ascendente(const Entrada& a, const Entrada& b) {
+        return a.valor < b.valor || (a.valor == b.valor && a.slot < b.slot);
+    }
+
+    bool descendente(const Entrada& a, const Entrada& b) {
+        return a.valor > b.valor || (a.valor == b.valor && a.slot < b.slot);
+    }
+
+    std::string codigo(const char* prefijo, const int n) {
+        char texto[24];
+        std::snprintf(texto, sizeof texto, "%s-%07d", prefijo, n);
+        return texto;
+    }
+
+    std::vector<Entrada> costos(const Inventario& inventario, const CriterioCosto criterio) {
+        const std::vector<Articulo*> todos = inventario.obtenerTodosLosArticulos();
+        std::vector<Entrada> resultado;
+        for (std::uint32_t slot = 0; slot < todos.size(); ++slot) {
+            double valor = todos[slot]->GetUnitCost();
+            if (criterio == CriterioCosto::TOTAL) {
+                if (const auto* equipo = dynamic_cast<const EquipoMedico*>(todos[slot])) {
+                    valor = equipo->CalculateTotalCost(inventario.obtenerFechaCorte());
+                } else {
+                    valor = static_cast<const MobiliarioClinico*>(todos[slot])->CalculateTotalCost(inventario.obtenerFechaCorte());
+                }
+            }
+            resultado.push_back({valor, slot});
+        }
+        return resultado;
+    }
+
+    void verificar(const Inventario& inventario, std::mt19937& azar) {
+        const std::vector<Articulo*> todos = inventario.obtenerTodosLosArticulos();
+        const MapaBits& danados = inventario.obtenerIndiceBitmaps().estado(ArticleStatus::DAMAGED);
+        for (const CriterioCosto criterio : {CriterioCosto::UNITARIO, CriterioCosto::TOTAL}) {
+            std::vector<Entrada> asc = costos(inventario, criterio);
+            std::vector<Entrada> desc = asc;
+            std::sort(asc.begin(), asc.end(), ascendente);
+            std::sort(desc.begin(), desc.end(), descendente);
+            for (int consulta = 0; consulta < 20; ++consulta) {
+                double minimo = static_cast<double>(azar() % 3000);
+                double maximo = minimo + static_cast<double>(azar() % 2000);
+                if (consulta == 0) std::swap(minimo, maximo);
+                std::vector<Articulo*> esperado;
+                for (const Entrada& e : asc) {
+                    if (e.valor >= minimo && e.valor <= maximo) esperado.push_back(todos[e.slot]);
+                }
+                COMPROBAR(inventario.obtenerArticulosEntreCostos(minimo, maximo, criterio) == esperado);
+                COMPROBAR(inventario.contarArticulosEntreCostos(minimo, maximo, criterio) == esperado.size());
+
+                const std::size_t k = azar() % 50;
+                std::vector<Articulo*> caros;
+                std::vector<Articulo*> baratos;
+                std::vector<Articulo*> carosDanados;
+                for (std::size_t i = 0; i < std::min(k, asc.size()); ++i) {
+                    caros.push_back(todos[desc[i].slot]);
+                    baratos.push_back(todos[asc[i].slot]);
+                }
+                for (const Entrada& e : desc) {
+                    if (carosDanados.size() < k && todos[e.slot]->GetStatus() == ArticleStatus::DAMAGED) {
+                        carosDanados.push_back(todos[e.slot]);
+                    }
+                }
+                COMPROBAR(inventario.obtenerArticulosMasCaros(k, criterio) == caros);
+                COMPROBAR(inventario.obtenerArticulosMasBaratos(k, criterio) == baratos);
+                COMPROBAR(inventario.obtenerArticulosMasCaros(k, danados, criterio) == carosDanados);
+
+                double percentil = static_cast<double>(azar() % 10001) / 100.0;
+                if (consulta == 1) percentil = 0.0;
+                if (consulta == 2) percentil = 100.0;
+                if (!asc.empty()) {
+                    const auto rango = static_cast<std::size_t>(std::ceil(percentil / 100.0 * static_cast<double>(asc.size())));
+                    COMPROBAR(inventario.obtenerPercentilCosto(percentil, criterio) == asc[rango > 0 ? rango - 1 : 0].valor);
+                }
+            }
+            if (!asc.empty()) {
+                const ResumenCostos resumen = inventario.obtenerResumenCostos(criterio);
+                COMPROBAR(resumen.minimo == asc.front().valor && resumen.masBarato == todos[asc.front().slot]);
+                COMPROBAR(resumen.maximo == desc.front().valor && resumen.masCaro == todos[desc.front().slot]);
+            }
+        }
+    }
+
+    // Índice aislado con muchas altas y bajas: divisiones y fusiones de bloques
+    // Rangos vacíos: invertidos o con NaN en cualquiera de los extremos
+    void comprobarRangosVacios(const IndiceOrdenado& indice) {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        COMPROBAR(indice.size() > 0 && indice.contarEntre(0.0, 1e9) == indice.size());
+        for (const auto& rango : {std::make_pair(nan, 1e9), std::make_pair(0.0, nan), std::make_pair(nan, nan),
+                                  std::make_pair(10.0, 5.0)}) {
+            std::size_t visitados = 0;
+            indice.paraCadaEntre(rango.first, rango.second, [&visitados](std::uint32_t) { ++visitados; });
+            COMPROBAR(visitados == 0);
+            COMPROBAR(indice.contarEntre(rango.first, rango.second) == 0);
+        }
+    }
+
+    void probarIndice(std::mt19937& azar) {
+        IndiceOrdenado indice;
+        std::vector<Entrada> vivos;
+        for (int paso = 0; paso < 200000; ++paso) {
+            if (vivos.empty() || static_cast<int>(azar() % 100) < (paso < 100000 ? 60 : 35)) {
+                const Entrada e{static_cast<double>(azar() % 500), static_cast<std::uint32_t>(paso)};
+                indice.agregar(e.valor, e.slot);
+                vivos.push_back(e);
+            } else {
+                const std::size_t i = azar() % vivos.size();
+                indice.quitar(vivos[i].valor, vivos[i].slot);
+                vivos[i] = vivos.back();
+                vivos.pop_back();
+            }
+            if (paso % 20000 == 0) {
+                std::vector<Entrada> ordenados = vivos;
+                std::sort(ordenados.begin(), ordenados.end(), ascendente);
+                COMPROBAR(indice.size() == ordenados.size());
+                for (std::size_t i = 0; i < ordenados.size(); i += 1 + azar() % 50) {
+                    const IndiceOrdenado::Entrada& e = indice.enPosicion(i);
+                    COMPROBAR(e.valor == ordenados[i].valor && e.slot == ordenados[i].slot);
+                }
+                std::size_t i = 0;
+                indice.recorrerAscendente([&](const std::uint32_t slot) {
+                    COMPROBAR(slot == ordenados[i++].slot);
+                    return true;
+                });
+                COMPROBAR(i == ordenados.size());
+            }
+            if (paso == 100000) comprobarRangosVacios(indice);
+        }
+
+        while (!vivos.empty()) {
+            indice.quitar(vivos.back().valor, vivos.back().slot);
+            vivos.pop_back();
+        }
+        COMPROBAR(indice.vacio());
+        indice.quitar(1.0, 1);
+        indice.agregar(3.0, 4);
+        COMPROBAR(indice.size() == 1 && indice.maximo().slot == 4);
+    }
+}
+
+int main() {
+    std::mt19937 azar(11);
+    probarIndice(azar);
+
+    Inventario inventario;
+    std::vector<std::string> vivos;
+    int siguiente = 0;
+    // Uno de cada cuatro costos es redondo: muchos empates
+    const auto costo = [&azar] {
+        return (azar() % 4 == 0) ? 100.0 * (1 + azar() % 5) : 1.0 + static_cast<double>(azar() % 400000) / 100.0;
+    };
+    for (int paso = 0; paso < 20000; ++paso) {
+        const unsigned operacion = azar() % 10;
+        if (vivos.empty() || operacion < 5) {
+            const auto estado = static_cast<ArticleStatus>(azar() % 3);
+            if (azar() % 2 != 0) {
+                vivos.push_back(codigo("EQ", siguiente));
+                inventario.agregarArticulo(EquipoMedico(vivos.back(), "01/01/2020", estado, costo(),
+                                                        static_cast<MarcaEquipo>(azar() % 4), 5, "Ana",
+                                                        static_cast<AreaUso>(azar() % 3)));
+            } else {
+                vivos.push_back(codigo("MB", siguiente));
+                inventario.agregarArticulo(MobiliarioClinico(vivos.back(), "15/06/2018", estado, costo(), "m",
+                                                             static_cast<AreaUbicacion>(azar() % 3)));
+            }
+            ++siguiente;
+        } else if (operacion < 7) {
+            const std::size_t k = azar() % vivos.size();
+            inventario.eliminarArticulo(vivos[k]);
+            vivos[k] = vivos.back();
+            vivos.pop_back();
+        } else if (operacion < 8) {
+            inventario.buscarPorCodigo(vivos[azar() % vivos.size()])->SetStatus(static_cast<ArticleStatus>(azar() % 3));
+        } else {
+            inventario.buscarPorCodigo(vivos[azar() % vivos.size()])->SetUnitCost(costo());
+        }
+        if (paso % 4000 == 0) verificar(inventario, azar);
+        if (paso == 10000) {
+            inventario.actualizarFechaCorte(FechaCorte::Desde(inventario.obtenerFechaCorte().dia + 3 * 365));
+            verificar(inventario, azar);
+        }
+    }
+    verificar(inventario, azar);
+
+    // Un proceso que sigue abierto al cambiar de año: refrescar avanza la
+    // fecha de corte y, solo con un año nuevo, recalcula los costos totales
+    {
+        const FechaCorte inicial = inventario.obtenerFechaCorte();
+        char ingreso[10];
+        Fecha::textoDeDias(Fecha::diasDesdeCivil(inicial.anio, 1, 1), ingreso);
+        inventario.agregarArticulo(EquipoMedico("FC-1", std::string_view(ingreso, sizeof ingreso), ArticleStatus::OPERATIONAL, 1000.0, MarcaEquipo::GE,
+                                                10, "Ana", AreaUso::QUIROFANO));
+        const Articulo* nuevo = inventario.buscarPorCodigo("FC-1");
+        COMPROBAR(!inventario.refrescarFechaCorte(inicial));
+        COMPROBAR(!inventario.refrescarFechaCorte(FechaCorte::Desde(inicial.dia - 1)));
+        const FechaCorte finDeAnio = FechaCorte::Desde(Fecha::diasDesdeCivil(inicial.anio, 12, 31));
+        const double totalAntes = inventario.calcularCostoTotalPorCategoria(TipoArticulo::MEDICAL_EQUIPMENT);
+        if (finDeAnio.dia > inicial.dia) {
+            COMPROBAR(inventario.refrescarFechaCorte(finDeAnio));
+            COMPROBAR(inventario.obtenerFechaCorte().dia == finDeAnio.dia);
+            COMPROBAR(inventario.calcularCostoTotalPorCategoria(TipoArticulo::MEDICAL_EQUIPMENT) == totalAntes);
+        }
+        COMPROBAR(inventario.refrescarFechaCorte(FechaCorte::Desde(Fecha::diasDesdeCivil(inicial.anio + 1, 1, 1))));
+        COMPROBAR(inventario.obtenerFechaCorte().anio == inicial.anio + 1);
+        COMPROBAR(inventario.calcularCostoTotalPorCategoria(TipoArticulo::MEDICAL_EQUIPMENT) < totalAntes);
+        const std::vector<Articulo*> depreciado = inventario.obtenerArticulosEntreCostos(900.0, 900.0, CriterioCosto::TOTAL);
+        COMPROBAR(std::find(depreciado.begin(), depreciado.end(), nuevo) != depreciado.end());
+        verificar(inventario, azar);
+        inventario.eliminarArticulo("FC-1");
+    }
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    COMPROBAR(inventario.contarArticulosEntreCostos(nan, 1e9) == 0);
+    COMPROBAR(inventario.obtenerArticulosEntreCostos(nan, 1e9).empty());
+    COMPROBAR(inventario.obtenerArticulosEntreCostos(0.0, nan, CriterioCosto::TOTAL).empty());
+    bool lanzo = false;
+    try {
+        inventario.obtenerPercentilCosto(101.0);
+    } catch (const std::invalid_argument&) {
+        lanzo = true;
+    }
+    COMPROBAR(lanzo);
+
+    // Las cargas masivas reconstruyen los índices de una vez
+    const std::filesystem::path carpeta = std::filesystem::temp_directory_path() / "prueba_indice_costos";
+    std::filesystem::create_directories(carpeta);
+    const std::string snapshot = (carpeta / "inventario.snap").string();
+    const std::string columnar = (carpeta / "inventario.col").string();
+    inventario.guardarEnArchivo(snapshot);
+    inventario.exportarColumnar(columnar);
+    {
+        Inventario cargado;
+        cargado.actualizarFechaCorte(inventario.obtenerFechaCorte());
+        cargado.cargarDeArchivo(snapshot);
+        verificar(cargado, azar);
+        cargado.agregarArticulo(EquipoMedico("ZZ-1", "01/01/2020", ArticleStatus::DAMAGED, 99999.0, MarcaEquipo::GE, 5,
+                                             "Ana", AreaUso::QUIROFANO));
+        verificar(cargado, azar);
+    }
+    {
+        Inventario importado;
+        importado.actualizarFechaCorte(inventario.obtenerFechaCorte());
+        importado.importarColumnar(columnar);
+        verificar(importado, azar);
+    }
+    {
+        // Sin índice en el archivo: el mismo resultado con un recorrido completo
+        const ResumenCostos resumen = inventario.obtenerResumenCostos();
+        const ExtremosCostos extremos = LectorColumnar(columnar).obtenerExtremosCostos();
+        COMPROBAR(extremos.minimo == resumen.minimo && extremos.maximo == resumen.maximo);
+        COMPROBAR(extremos.indiceMinimo == resumen.masBarato->GetSlot());
+        COMPROBAR(extremos.indiceMaximo == resumen.masCaro->GetSlot());
+    }
+    std::filesystem::remove_all(carpeta);
+
+    const Inventario movido(std::move(inventario));
+    verificar(movido, azar);
+    const Inventario vacio;
+    COMPROBAR(vacio.obtenerPercentilCosto(50.0) == 0.0 && vacio.obtenerArticulosMasCaros(5).empty() &&
+              vacio.contarArticulosEntreCostos(0.0, 1e9) == 0);
+    return 0;
+}
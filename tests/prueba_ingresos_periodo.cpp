@@ -0,0 +1,136 @@
+/**
+ * @file prueba_ingresos_periodo.cpp
+ * @brief Period bucketing of Inventario::obtenerIngresosPorPeriodo at its boundaries
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Empty and inverted ranges, a single day under every period kind, the
+ * month, leap-day and year edges, weeks anchored at 'desde', and ranges
+ * reaching the ends of int32_t, which are clipped to the representable
+ * dates instead of producing billions of periods.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    std::int32_t dia(const int anio, const unsigned mes, const unsigned d) {
+        return Fecha::diasDesdeCivil(anio, mes, d);
+    }
+
+    std::size_t sumaCantidades(const std::vector<IngresosPeriodo>& periodos) {
+        std::size_t total = 0;
+        for (const IngresosPeriodo& p : periodos) total += p.cantidad;
+        return total;
+    }
+
+    // Inicios consecutivos y crecientes
+    void comprobarOrden(const std::vector<IngresosPeriodo>& periodos) {
+        for (std::size_t i = 1; i < periodos.size(); ++i) COMPROBAR(periodos[i - 1].inicio < periodos[i].inicio);
+    }
+}
+
+int main() {
+    Inventario inventario;
+    const struct {
+        const char* codigo;
+        const char* fecha;
+        double costo;
+    } altas[] = {
+        {"EQ-1", "31/12/2023", 1.0}, {"EQ-2", "01/01/2024", 2.0},  {"MB-3", "31/01/2024", 4.0},
+        {"EQ-4", "01/02/2024", 8.0}, {"MB-5", "28/02/2024", 16.0}, {"EQ-6", "29/02/2024", 32.0},
+        {"MB-7", "01/03/2024", 64.0}, {"EQ-8", "31/12/2099", 128.0},
+    };
+    for (std::size_t i = 0; i < std::size(altas); ++i) {
+        if (i % 2 == 0) {
+            inventario.agregarArticulo(EquipoMedico(altas[i].codigo, altas[i].fecha, ArticleStatus::OPERATIONAL,
+                                                    altas[i].costo, MarcaEquipo::GE, 5, "Ana", AreaUso::EMERGENCIA));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico(altas[i].codigo, altas[i].fecha, ArticleStatus::OPERATIONAL,
+                                                         altas[i].costo, "acero", AreaUbicacion::CONSULTA));
+        }
+    }
+    const PeriodoIngreso todos[] = {PeriodoIngreso::DIA, PeriodoIngreso::SEMANA, PeriodoIngreso::MES,
+                                    PeriodoIngreso::ANIO};
+    constexpr std::int32_t MINIMO = std::numeric_limits<std::int32_t>::min();
+    constexpr std::int32_t MAXIMO = std::numeric_limits<std::int32_t>::max();
+
+    // Intervalos vacíos: invertido, o entero fuera de las fechas válidas
+    for (const PeriodoIngreso periodo : todos) {
+        COMPROBAR(inventario.obtenerIngresosPorPeriodo(periodo, dia(2024, 2, 2), dia(2024, 2, 1)).empty());
+        COMPROBAR(inventario.obtenerIngresosPorPeriodo(periodo, MINIMO, Fecha::PRIMER_DIA - 1).empty());
+        COMPROBAR(inventario.obtenerIngresosPorPeriodo(periodo, Fecha::ULTIMO_DIA + 1, MAXIMO).empty());
+        COMPROBAR(inventario.obtenerIngresosPorPeriodo(periodo, MAXIMO, MINIMO).empty());
+    }
+
+    // Un solo día: un periodo, que empieza donde dice su calendario
+    const std::int32_t bisiesto = dia(2024, 2, 29);
+    const std::int32_t inicios[] = {bisiesto, bisiesto, dia(2024, 2, 1), dia(2024, 1, 1)};
+    for (std::size_t k = 0; k < std::size(todos); ++k) {
+        const auto periodos = inventario.obtenerIngresosPorPeriodo(todos[k], bisiesto, bisiesto);
+        COMPROBAR(periodos.size() == 1);
+        COMPROBAR(periodos[0].inicio == inicios[k] && periodos[0].cantidad == 1 && periodos[0].costo == 32.0);
+    }
+    const auto sinIngresos = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::MES, dia(2024, 2, 2), dia(2024, 2, 2));
+    COMPROBAR(sinIngresos.size() == 1 && sinIngresos[0].cantidad == 0 && sinIngresos[0].costo == 0.0);
+
+    // Meses: los bordes caen en su mes y lo de fuera del intervalo no cuenta
+    const auto meses = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::MES, dia(2024, 1, 1), dia(2024, 3, 31));
+    COMPROBAR(meses.size() == 3);
+    COMPROBAR(meses[0].inicio == dia(2024, 1, 1) && meses[0].cantidad == 2 && meses[0].costo == 6.0);
+    COMPROBAR(meses[1].inicio == dia(2024, 2, 1) && meses[1].cantidad == 3 && meses[1].costo == 56.0);
+    COMPROBAR(meses[2].inicio == dia(2024, 3, 1) && meses[2].cantidad == 1 && meses[2].costo == 64.0);
+    // Empezando a mitad de mes el primer periodo es el mes entero, pero
+    // solo cuentan los ingresos desde 'desde'
+    const auto mitad = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::MES, dia(2024, 1, 15), dia(2024, 2, 28));
+    COMPROBAR(mitad.size() == 2 && mitad[0].inicio == dia(2024, 1, 1) && mitad[0].cantidad == 1);
+    COMPROBAR(mitad[1].cantidad == 2 && mitad[1].costo == 24.0);
+
+    // Años: el 31/12 y el 01/01 quedan en años distintos
+    const auto anios = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::ANIO, dia(2023, 12, 31), dia(2024, 1, 1));
+    COMPROBAR(anios.size() == 2);
+    COMPROBAR(anios[0].inicio == dia(2023, 1, 1) && anios[0].cantidad == 1 && anios[0].costo == 1.0);
+    COMPROBAR(anios[1].inicio == dia(2024, 1, 1) && anios[1].cantidad == 1 && anios[1].costo == 2.0);
+
+    // Semanas desde 'desde': 29/01-04/02, 05/02-11/02, ... 26/02-03/03
+    const auto semanas = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::SEMANA, dia(2024, 1, 29), dia(2024, 3, 3));
+    COMPROBAR(semanas.size() == 5);
+    for (std::size_t i = 0; i < semanas.size(); ++i) {
+        COMPROBAR(semanas[i].inicio == dia(2024, 1, 29) + static_cast<std::int32_t>(7 * i));
+    }
+    COMPROBAR(semanas[0].cantidad == 2 && semanas[0].costo == 12.0);
+    COMPROBAR(semanas[4].cantidad == 3 && semanas[4].costo == 112.0);
+
+    // Días: uno por día, también los vacíos
+    const auto dias = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::DIA, dia(2024, 2, 27), dia(2024, 3, 1));
+    COMPROBAR(dias.size() == 4 && dias[0].cantidad == 0 && dias[1].cantidad == 1 && dias[2].cantidad == 1 &&
+              dias[3].cantidad == 1);
+
+    // Todo int32_t: se recorta a 01/01/0000 - 31/12/9999
+    const auto siglos = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::ANIO, MINIMO, MAXIMO);
+    COMPROBAR(siglos.size() == 10000);
+    COMPROBAR(siglos.front().inicio == Fecha::PRIMER_DIA && siglos.back().inicio == dia(9999, 1, 1));
+    COMPROBAR(sumaCantidades(siglos) == inventario.obtenerCantidadTotal());
+    comprobarOrden(siglos);
+    const auto todosLosMeses = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::MES, MINIMO, MAXIMO);
+    COMPROBAR(todosLosMeses.size() == 120000 && todosLosMeses.back().inicio == dia(9999, 12, 1));
+    COMPROBAR(sumaCantidades(todosLosMeses) == inventario.obtenerCantidadTotal());
+    comprobarOrden(todosLosMeses);
+
+    // Cerca de INT32_MAX el avance al periodo siguiente no desborda
+    for (const PeriodoIngreso periodo : todos) {
+        const auto cola = inventario.obtenerIngresosPorPeriodo(periodo, Fecha::ULTIMO_DIA, MAXIMO);
+        COMPROBAR(cola.size() == 1 && cola[0].cantidad == 0);
+        const auto cabeza = inventario.obtenerIngresosPorPeriodo(periodo, MINIMO, Fecha::PRIMER_DIA);
+        COMPROBAR(cabeza.size() == 1 && cabeza[0].inicio == Fecha::PRIMER_DIA);
+    }
+    const auto ultimaSemana = inventario.obtenerIngresosPorPeriodo(PeriodoIngreso::SEMANA, Fecha::ULTIMO_DIA - 8, MAXIMO);
+    COMPROBAR(ultimaSemana.size() == 2 && ultimaSemana[1].inicio == Fecha::ULTIMO_DIA - 1);
+    return 0;
+}
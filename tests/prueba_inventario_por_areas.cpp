@@ -0,0 +1,169 @@
+/**
+ * @file prueba_inventario_por_areas.cpp
+ * @brief Area migration in InventarioPorAreas against a flat Inventario
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * The same additions, removals and area changes are applied to both.
+ * cambiarArea() must move the article at once. A change made directly on
+ * the article must stay in the old area until sincronizarAreas() or the
+ * next mutating call. Hospital-wide queries must match the flat
+ * inventory in the serial and the parallel fan-out.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include "inventario_por_areas.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    constexpr int ARTICULOS = 3000;
+    const char* const TECNICOS[] = {"Ana", "Luis", "Marta", "Zoe"};
+
+    std::string codigo(const int n) {
+        char texto[16];
+        std::snprintf(texto, sizeof texto, "%s-%05d", n % 2 != 0 ? "EQ" : "MB", n);
+        return texto;
+    }
+
+    template <typename Destino>
+    void agregar(Destino& destino, const int n) {
+        const auto estado = static_cast<ArticleStatus>(n % 3);
+        if (n % 2 != 0) {
+            destino.agregarArticulo(EquipoMedico(codigo(n), "01/01/2020", estado, 100.0 + n % 97,
+                                                 static_cast<MarcaEquipo>(n % 4), 1 + n % 9, TECNICOS[n % 4],
+                                                 static_cast<AreaUso>(n % 3)));
+        } else {
+            destino.agregarArticulo(MobiliarioClinico(codigo(n), "01/01/2020", estado, 10.0 + n % 13, "acero",
+                                                      static_cast<AreaUbicacion>(n % 3)));
+        }
+    }
+
+    bool cerca(const double a, const double b) { return std::fabs(a - b) <= 1e-9 * (1.0 + std::fabs(a)); }
+
+    // Cada artículo está solo en el área que le toca, y todo lo demás
+    // coincide con el inventario plano
+    void comparar(const InventarioPorAreas& porAreas, const Inventario& plano) {
+        std::size_t total = 0;
+        for (std::size_t a = 0; a < InventarioPorAreas::AREAS; ++a) {
+            const auto area = static_cast<AreaHospital>(a);
+            for (const Articulo* articulo : porAreas.area(area).obtenerTodosLosArticulos()) {
+                COMPROBAR(InventarioPorAreas::areaDe(*articulo) == area);
+            }
+            total += porAreas.obtenerCantidadPorArea(area);
+        }
+        COMPROBAR(total == plano.obtenerCantidadTotal() && porAreas.obtenerCantidadTotal() == total);
+        for (const Articulo* articulo : plano.obtenerTodosLosArticulos()) {
+            const Articulo* propio = porAreas.buscarPorCodigo(articulo->GetCode());
+            COMPROBAR(propio != nullptr && propio->GetStatus() == articulo->GetStatus() &&
+                      propio->GetUnitCost() == articulo->GetUnitCost());
+            COMPROBAR(InventarioPorAreas::areaDe(*propio) == InventarioPorAreas::areaDe(*articulo));
+        }
+        COMPROBAR(porAreas.contarEquiposPorArea() == plano.contarEquiposPorArea());
+        COMPROBAR(porAreas.contarMobiliarioPorArea() == plano.contarMobiliarioPorArea());
+        COMPROBAR(porAreas.contarEquiposPorTecnico() == plano.contarEquiposPorTecnico());
+        for (const ArticleStatus estado : {ArticleStatus::OPERATIONAL, ArticleStatus::UNDER_REVIEW, ArticleStatus::DAMAGED}) {
+            COMPROBAR(porAreas.filtrarPorEstado(estado).size() == plano.filtrarPorEstado(estado).size());
+            COMPROBAR(porAreas.obtenerCantidadPorEstado(estado) == plano.obtenerCantidadPorEstado(estado));
+            COMPROBAR(cerca(porAreas.calcularCostoTotalPorEstado(estado), plano.calcularCostoTotalPorEstado(estado)));
+        }
+        for (const ArticleType tipo : {ArticleType::MEDICAL_EQUIPMENT, ArticleType::CLINICAL_FURNITURE}) {
+            COMPROBAR(porAreas.filtrarPorTipo(tipo).size() == plano.filtrarPorTipo(tipo).size());
+            COMPROBAR(cerca(porAreas.calcularCostoTotalPorCategoria(tipo), plano.calcularCostoTotalPorCategoria(tipo)));
+        }
+        COMPROBAR(porAreas.contar(Filtro::area(AreaUso::QUIROFANO)) == plano.contar(Filtro::area(AreaUso::QUIROFANO)));
+        COMPROBAR(cerca(porAreas.calcularDepreciacionTotal(), plano.calcularDepreciacionTotal()));
+    }
+
+    AreaHospital areaActual(const InventarioPorAreas& porAreas, const std::string& clave) {
+        for (std::size_t a = 0; a < InventarioPorAreas::AREAS; ++a) {
+            if (porAreas.area(static_cast<AreaHospital>(a)).existeCodigo(clave)) return static_cast<AreaHospital>(a);
+        }
+        COMPROBAR(false);
+        return AreaHospital::EMERGENCIA;
+    }
+}
+
+int main() {
+    InventarioPorAreas porAreas;
+    Inventario plano;
+    for (int n = 0; n < ARTICULOS; ++n) {
+        agregar(porAreas, n);
+        agregar(plano, n);
+    }
+    // Un código repetido se ignora aunque su área sea otra
+    porAreas.agregarArticulo(EquipoMedico(codigo(1), "01/01/2020", ArticleStatus::OPERATIONAL, 1.0, MarcaEquipo::GE, 1,
+                                          "Ana", AreaUso::QUIROFANO));
+    comparar(porAreas, plano);
+
+    // cambiarArea traslada en el momento
+    for (int n = 1; n < ARTICULOS; n += 10) {
+        const AreaUso nueva = static_cast<AreaUso>((n + 1) % 3);
+        COMPROBAR(porAreas.cambiarArea(codigo(n), nueva));
+        static_cast<EquipoMedico*>(plano.buscarPorCodigo(codigo(n)))->setAreaUso(nueva);
+        COMPROBAR(areaActual(porAreas, codigo(n)) == InventarioPorAreas::areaDe(nueva));
+    }
+    for (int n = 0; n < ARTICULOS; n += 10) {
+        const AreaUbicacion nueva = static_cast<AreaUbicacion>((n + 2) % 3);
+        COMPROBAR(porAreas.cambiarArea(codigo(n), nueva));
+        static_cast<MobiliarioClinico*>(plano.buscarPorCodigo(codigo(n)))->setAreaUbicacion(nueva);
+        COMPROBAR(areaActual(porAreas, codigo(n)) == InventarioPorAreas::areaDe(nueva));
+    }
+    COMPROBAR(porAreas.sincronizarAreas() == 0);
+    COMPROBAR(!porAreas.cambiarArea("NO-EXISTE", AreaUso::PEDIATRIA));
+    COMPROBAR(!porAreas.cambiarArea(codigo(2), AreaUso::PEDIATRIA));        // mobiliario con área de equipo
+    COMPROBAR(!porAreas.cambiarArea(codigo(3), AreaUbicacion::CONSULTA));   // equipo con área de mobiliario
+    comparar(porAreas, plano);
+
+    // Un cambio hecho sobre el artículo espera a sincronizarAreas
+    auto* directo = static_cast<EquipoMedico*>(porAreas.buscarPorCodigo(codigo(5)));
+    const AreaHospital antes = areaActual(porAreas, codigo(5));
+    const AreaUso otra = directo->getAreaUso() == AreaUso::PEDIATRIA ? AreaUso::QUIROFANO : AreaUso::PEDIATRIA;
+    directo->setAreaUso(otra);
+    static_cast<EquipoMedico*>(plano.buscarPorCodigo(codigo(5)))->setAreaUso(otra);
+    COMPROBAR(areaActual(porAreas, codigo(5)) == antes);
+    // Volver al área de origen antes de sincronizar no traslada nada
+    auto* ida = static_cast<MobiliarioClinico*>(porAreas.buscarPorCodigo(codigo(6)));
+    const AreaUbicacion original = ida->getAreaUbicacion();
+    ida->setAreaUbicacion(original == AreaUbicacion::CONSULTA ? AreaUbicacion::QUIROFANO : AreaUbicacion::CONSULTA);
+    ida->setAreaUbicacion(original);
+    COMPROBAR(porAreas.sincronizarAreas() == 1);
+    COMPROBAR(areaActual(porAreas, codigo(5)) == InventarioPorAreas::areaDe(otra));
+    COMPROBAR(porAreas.sincronizarAreas() == 0);
+
+    // La siguiente operación que modifica también recoge los pendientes
+    for (int n = 7; n < ARTICULOS; n += 50) {
+        auto* equipo = static_cast<EquipoMedico*>(porAreas.buscarPorCodigo(codigo(n)));
+        const AreaUso nueva = static_cast<AreaUso>((static_cast<int>(equipo->getAreaUso()) + 1) % 3);
+        equipo->setAreaUso(nueva);
+        equipo->SetStatus(ArticleStatus::DAMAGED);
+        auto* referencia = static_cast<EquipoMedico*>(plano.buscarPorCodigo(codigo(n)));
+        referencia->setAreaUso(nueva);
+        referencia->SetStatus(ArticleStatus::DAMAGED);
+    }
+    agregar(porAreas, ARTICULOS);
+    agregar(plano, ARTICULOS);
+    COMPROBAR(porAreas.sincronizarAreas() == 0);
+    comparar(porAreas, plano);
+
+    // Bajas en cualquier área, también de artículos recién trasladados
+    for (int n = 0; n < ARTICULOS; n += 9) {
+        COMPROBAR(porAreas.eliminarArticulo(codigo(n)) == plano.eliminarArticulo(codigo(n)));
+    }
+    COMPROBAR(!porAreas.eliminarArticulo(codigo(0)));
+    comparar(porAreas, plano);
+
+    // El mismo resultado con el reparto entre áreas forzado y con áreas
+    // que ya reparten sus propios bloques
+    porAreas.configurarUmbralParalelo(0);
+    plano.configurarUmbralParalelo(0);
+    comparar(porAreas, plano);
+    porAreas.configurarUmbralParalelo(200);
+    comparar(porAreas, plano);
+    return 0;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file prueba_mapa_bits.cpp
+ * @brief MapaBits against std::set<uint32_t> across the array/bitmap threshold
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Chunks are filled past UMBRAL_ARREGLO and emptied below half of it, so
+ * they turn into bitmaps and back into arrays, with appends, inserts in
+ * the middle and removals of absent values. The set operators and
+ * contarInterseccion are checked on mixes of array and bitmap chunks.
+ */
+
+#include "comprobar.hpp"
+#include "mapa_bits.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+    using Referencia = std::set<std::uint32_t>;
+
+    constexpr std::size_t UMBRAL = MapaBits::UMBRAL_ARREGLO;
+    constexpr std::size_t BYTES_MAPA = 65536 / 8;  // un bloque en mapa; 4096 valores en arreglo ocupan igual
+
+    std::vector<std::uint32_t> valores(const MapaBits& mapa) {
+        std::vector<std::uint32_t> resultado;
+        mapa.paraCada([&resultado](const std::uint32_t valor) { resultado.push_back(valor); });
+        return resultado;
+    }
+
+    void comparar(const MapaBits& mapa, const Referencia& referencia) {
+        COMPROBAR(mapa.cardinalidad() == referencia.size());
+        COMPROBAR(mapa.vacio() == referencia.empty());
+        const std::vector<std::uint32_t> propios = valores(mapa);
+        COMPROBAR(std::equal(propios.begin(), propios.end(), referencia.begin(), referencia.end()));
+        for (const std::uint32_t valor : referencia) COMPROBAR(mapa.contiene(valor));
+    }
+
+    void agregar(MapaBits& mapa, Referencia& referencia, const std::uint32_t valor) {
+        mapa.agregar(valor);
+        referencia.insert(valor);
+        COMPROBAR(mapa.contiene(valor) && mapa.cardinalidad() == referencia.size());
+    }
+
+    void quitar(MapaBits& mapa, Referencia& referencia, const std::uint32_t valor) {
+        mapa.quitar(valor);
+        referencia.erase(valor);
+        COMPROBAR(!mapa.contiene(valor) && mapa.cardinalidad() == referencia.size());
+    }
+
+    // Un solo bloque: llenarlo pasa a mapa en UMBRAL + 1 y vaciarlo vuelve
+    // a arreglo en UMBRAL / 2, no antes. La representación se ve en la
+    // memoria: un arreglo de UMBRAL + 1 valores habría crecido a 16 KiB y
+    // el que deja aArreglo se reserva justo
+    void probarUmbral(const std::uint32_t alto, const bool desordenado) {
+        MapaBits mapa;
+        Referencia referencia;
+        std::vector<std::uint32_t> orden;
+        for (std::uint32_t i = 0; i <= UMBRAL; ++i) orden.push_back(alto << 16 | (i * 7u % 65536u));
+        if (desordenado) std::shuffle(orden.begin(), orden.end(), std::mt19937(alto));
+        for (std::size_t i = 0; i < UMBRAL; ++i) agregar(mapa, referencia, orden[i]);
+        agregar(mapa, referencia, orden[0]);  // repetido: sigue en el umbral
+        comparar(mapa, referencia);
+        agregar(mapa, referencia, orden[UMBRAL]);
+        COMPROBAR(mapa.memoriaUsada() < 2 * BYTES_MAPA);
+        comparar(mapa, referencia);
+
+        // Bajas, también de valores que no están, hasta la mitad del umbral
+        for (std::size_t i = 0; referencia.size() > UMBRAL / 2 + 1; ++i) {
+            quitar(mapa, referencia, orden[i]);
+            quitar(mapa, referencia, (alto << 16) | 65535u);
+        }
+        COMPROBAR(mapa.memoriaUsada() >= BYTES_MAPA);
+        comparar(mapa, referencia);
+        quitar(mapa, referencia, *referencia.begin());
+        COMPROBAR(mapa.memoriaUsada() < BYTES_MAPA);
+        comparar(mapa, referencia);
+
+        // Otra vez por encima del umbral y vaciado del todo
+        for (std::uint32_t i = 0; referencia.size() <= UMBRAL; ++i) agregar(mapa, referencia, alto << 16 | (i * 3u + 1u));
+        COMPROBAR(mapa.memoriaUsada() >= BYTES_MAPA && mapa.memoriaUsada() < 2 * BYTES_MAPA);
+        comparar(mapa, referencia);
+        while (!referencia.empty()) quitar(mapa, referencia, *std::prev(referencia.end()));
+        comparar(mapa, referencia);
+    }
+
+    // Operaciones al azar repartidas en varios bloques, con fases que
+    // llenan y vacían para cruzar el umbral en los dos sentidos
+    void probarAzar() {
+        std::mt19937 azar(2025);
+        const std::uint32_t altos[] = {0u, 1u, 7u, 65535u};
+        MapaBits mapa;
+        Referencia referencia;
+        for (int fase = 0; fase < 8; ++fase) {
+            const bool llenar = fase % 2 == 0;
+            for (int paso = 0; paso < 6000; ++paso) {
+                const std::uint32_t alto = altos[azar() % std::size(altos)];
+                const std::uint32_t valor = alto << 16 | (azar() % 12000u);
+                if ((azar() % 4 != 0) == llenar) {
+                    agregar(mapa, referencia, valor);
+                } else if (!referencia.empty() && azar() % 2 == 0) {
+                    quitar(mapa, referencia, *referencia.lower_bound(std::min(valor, *referencia.rbegin())));
+                } else {
+                    quitar(mapa, referencia, valor);
+                }
+                if (paso % 1000 == 0) comparar(mapa, referencia);
+            }
+            comparar(mapa, referencia);
+        }
+    }
+
+    MapaBits construir(const Referencia& referencia) {
+        MapaBits mapa;
+        for (const std::uint32_t valor : referencia) mapa.agregar(valor);
+        return mapa;
+    }
+
+    // Bloque 0 denso en los dos, 1 denso en uno solo, 2 disperso en los
+    // dos, 3 solo en el primero y 4 solo en el segundo
+    void probarOperadores() {
+        std::mt19937 azar(7);
+        Referencia a;
+        Referencia b;
+        const auto llenar = [&azar](Referencia& destino, const std::uint32_t alto, const std::size_t cantidad,
+                                    const std::uint32_t rango) {
+            while (destino.size() < cantidad) destino.insert(alto << 16 | (azar() % rango));
+        };
+        llenar(a, 0, 6000, 9000);
+        llenar(b, 0, 6000, 9000);
+        const std::size_t hasta1 = a.size();
+        llenar(a, 1, hasta1 + 5000, 65536);
+        const std::size_t hasta1b = b.size();
+        llenar(b, 1, hasta1b + 300, 65536);
+        llenar(a, 2, a.size() + 200, 500);
+        llenar(b, 2, b.size() + 200, 500);
+        llenar(a, 3, a.size() + 100, 65536);
+        llenar(b, 4, b.size() + 100, 65536);
+        MapaBits mapaA = construir(a);
+        MapaBits mapaB = construir(b);
+        comparar(mapaA, a);
+        comparar(mapaB, b);
+
+        Referencia comun;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(comun, comun.end()));
+        Referencia union_;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(union_, union_.end()));
+
+        COMPROBAR(MapaBits::contarInterseccion(mapaA, mapaB) == comun.size());
+        COMPROBAR(MapaBits::contarInterseccion(mapaB, mapaA) == comun.size());
+        COMPROBAR(MapaBits::contarInterseccion(mapaA, MapaBits()) == 0);
+        MapaBits interseccion = mapaA & mapaB;
+        comparar(interseccion, comun);
+        MapaBits conAnd = mapaA;
+        conAnd &= mapaB;
+        comparar(conAnd, comun);
+        MapaBits conOr = mapaA;
+        conOr |= mapaB;
+        comparar(conOr, union_);
+        comparar(mapaA | mapaB, union_);
+        comparar(mapaA & MapaBits(), Referencia());
+        comparar(MapaBits() | mapaB, b);
+
+        // Los resultados siguen admitiendo altas y bajas en cualquier
+        // representación: el AND de dos mapas densos puede quedar disperso
+        Referencia copia = comun;
+        for (std::uint32_t i = 0; i < 5000; ++i) agregar(interseccion, copia, 2u << 16 | (i * 11u % 65536u));
+        while (copia.size() > 10) quitar(interseccion, copia, *copia.begin());
+        comparar(interseccion, copia);
+        Referencia unida = union_;
+        for (auto it = a.begin(); it != a.end(); ++it) quitar(conOr, unida, *it);
+        Referencia soloB;
+        std::set_difference(b.begin(), b.end(), a.begin(), a.end(), std::inserter(soloB, soloB.end()));
+        comparar(conOr, soloB);
+    }
+}
+
+int main() {
+    probarUmbral(0, false);
+    probarUmbral(3, true);
+    probarUmbral(65535, true);
+    probarAzar();
+    probarOperadores();
+    return 0;
+}
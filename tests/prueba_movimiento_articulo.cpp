@@ -0,0 +1,44 @@
+/**
+ * @file prueba_movimiento_articulo.cpp
+ * @brief A moved-out article must not report its changes to the inventory
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <utility>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+int main() {
+    Inventario inventario;
+    inventario.agregarArticulo(EquipoMedico("EQ-001", "01/02/2020", ArticleStatus::OPERATIONAL, 100.0,
+                                            MarcaEquipo::GE, 5, "Ana", AreaUso::PEDIATRIA));
+    inventario.agregarArticulo(MobiliarioClinico("MB-001", "01/02/2020", ArticleStatus::OPERATIONAL, 50.0,
+                                                 "Acero", AreaUbicacion::CONSULTA));
+    inventario.agregarArticulo(MobiliarioClinico("MB-002", "01/02/2020", ArticleStatus::OPERATIONAL, 70.0,
+                                                 "Madera", AreaUbicacion::CONSULTA));
+    Articulo* propio = inventario.buscarPorCodigo("MB-002");
+
+    // El objeto movido queda sin observador: sus cambios no tocan el inventario
+    EquipoMedico copia = std::move(static_cast<EquipoMedico&>(*inventario.buscarPorCodigo("EQ-001")));
+    MobiliarioClinico mueble = std::move(static_cast<MobiliarioClinico&>(*inventario.buscarPorCodigo("MB-001")));
+    copia.SetStatus(ArticleStatus::DAMAGED);
+    copia.SetUnitCost(900.0);
+    copia.setAreaUso(AreaUso::QUIROFANO);
+    mueble.SetStatus(ArticleStatus::DAMAGED);
+    COMPROBAR(copia.GetCode() == "EQ-001" && copia.GetStatus() == ArticleStatus::DAMAGED);
+
+    COMPROBAR(inventario.obtenerCantidadPorEstado(ArticleStatus::DAMAGED) == 0);
+    COMPROBAR(inventario.obtenerCantidadPorEstado(ArticleStatus::OPERATIONAL) == 3);
+    COMPROBAR(inventario.obtenerIndiceBitmaps().estado(ArticleStatus::DAMAGED).vacio());
+    COMPROBAR(inventario.contarArticulosEntreCostos(900.0, 900.0) == 0);
+    COMPROBAR(inventario.filtrar(Filtro::area(AreaUso::QUIROFANO)).empty());
+
+    // El artículo del inventario sigue notificando sus propios cambios
+    propio->SetStatus(ArticleStatus::UNDER_REVIEW);
+    COMPROBAR(inventario.obtenerCantidadPorEstado(ArticleStatus::UNDER_REVIEW) == 1);
+    COMPROBAR(inventario.obtenerIndiceBitmaps().estado(ArticleStatus::UNDER_REVIEW).cardinalidad() == 1);
+    return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file prueba_orden_slots.cpp
+ * @brief Per-type listings follow slot order after the pools recycle their cells
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Removals move the last article into the freed slot and new articles
+ * reuse freed pool cells, so storage order and slot order drift apart.
+ * obtenerEquiposMedicos, obtenerMobiliario, calcularValoresConPlus and
+ * agruparEquiposPorMarcaYArea must still list articles as
+ * obtenerTodosLosArticulos does.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    std::string codigo(const char* prefijo, const int n) {
+        char texto[16];
+        std::snprintf(texto, sizeof texto, "%s-%05d", prefijo, n);
+        return texto;
+    }
+
+    void agregar(Inventario& inventario, const int n) {
+        if (n % 3 != 0) {
+            inventario.agregarArticulo(EquipoMedico(codigo("EQ", n), "01/01/2020", ArticleStatus::OPERATIONAL,
+                                                    100.0 + n, static_cast<MarcaEquipo>(n % 4), 5, "Ana",
+                                                    static_cast<AreaUso>(n % 3)));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico(codigo("MB", n), "01/01/2020", ArticleStatus::OPERATIONAL,
+                                                         10.0 + n, "acero", static_cast<AreaUbicacion>(n % 3)));
+        }
+    }
+
+    void comprobarOrden(const Inventario& inventario) {
+        std::vector<Articulo*> equipos;
+        std::vector<Articulo*> muebles;
+        for (Articulo* articulo : inventario.obtenerTodosLosArticulos()) {
+            (articulo->GetType() == ArticleType::MEDICAL_EQUIPMENT ? equipos : muebles).push_back(articulo);
+        }
+
+        const std::vector<EquipoMedico*> listados = inventario.obtenerEquiposMedicos();
+        COMPROBAR(listados.size() == equipos.size());
+        for (std::size_t i = 0; i < listados.size(); ++i) COMPROBAR(listados[i] == equipos[i]);
+
+        const std::vector<MobiliarioClinico*> mobiliario = inventario.obtenerMobiliario();
+        const auto conPlus = inventario.calcularValoresConPlus();
+        COMPROBAR(mobiliario.size() == muebles.size() && conPlus.size() == muebles.size());
+        for (std::size_t i = 0; i < mobiliario.size(); ++i) {
+            COMPROBAR(mobiliario[i] == muebles[i] && conPlus[i].first == muebles[i]);
+        }
+
+        // Cada grupo es una subsecuencia de los equipos en orden de slot
+        std::size_t agrupados = 0;
+        for (const auto& [clave, grupo] : inventario.agruparEquiposPorMarcaYArea()) {
+            std::size_t siguiente = 0;
+            for (EquipoMedico* equipo : grupo) {
+                COMPROBAR(equipo->getMarca() == clave.first && equipo->getAreaUso() == clave.second);
+                while (siguiente < equipos.size() && equipos[siguiente] != equipo) ++siguiente;
+                COMPROBAR(siguiente < equipos.size());
+                ++siguiente;
+            }
+            agrupados += grupo.size();
+        }
+        COMPROBAR(agrupados == equipos.size());
+    }
+}
+
+int main() {
+    Inventario inventario;
+    for (int n = 0; n < 600; ++n) agregar(inventario, n);
+    comprobarOrden(inventario);
+
+    // Bajas salteadas: los últimos pasan a los huecos y las celdas libres
+    // del pool se reutilizan para las altas siguientes
+    for (int n = 0; n < 600; n += 7) COMPROBAR(inventario.eliminarArticulo(codigo(n % 3 != 0 ? "EQ" : "MB", n)));
+    comprobarOrden(inventario);
+    for (int n = 600; n < 700; ++n) agregar(inventario, n);
+    comprobarOrden(inventario);
+    for (int n = 1; n < 700; n += 5) {
+        if (n % 7 != 0 || n >= 600) inventario.eliminarArticulo(codigo(n % 3 != 0 ? "EQ" : "MB", n));
+    }
+    for (int n = 700; n < 760; ++n) agregar(inventario, n);
+    comprobarOrden(inventario);
+    return 0;
+}
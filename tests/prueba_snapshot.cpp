@@ -0,0 +1,123 @@
+/**
+ * @file prueba_snapshot.cpp
+ * @brief Binary snapshot round trip and rejection of damaged files
+ * @author Medical Inventory Team
+ * @date 2025
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+
+namespace {
+    void comprobarIguales(const Inventario& a, const Inventario& b) {
+        const std::vector<Articulo*> x = a.obtenerTodosLosArticulos();
+        const std::vector<Articulo*> y = b.obtenerTodosLosArticulos();
+        COMPROBAR(x.size() == y.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            COMPROBAR(x[i]->GetDetailedInfo() == y[i]->GetDetailedInfo());
+            COMPROBAR(x[i]->GetUnitCost() == y[i]->GetUnitCost());
+        }
+        COMPROBAR(a.calcularCostoTotalPorEstado(ArticleStatus::DAMAGED) ==
+                  b.calcularCostoTotalPorEstado(ArticleStatus::DAMAGED));
+        COMPROBAR(a.obtenerTecnicosConMasEquipos(5) == b.obtenerTecnicosConMasEquipos(5));
+        COMPROBAR(a.contarArticulosEntreCostos(300.0, 700.0) == b.contarArticulosEntreCostos(300.0, 700.0));
+    }
+
+    std::vector<char> leer(const std::string& ruta) {
+        std::ifstream archivo(ruta, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+    }
+
+    void escribir(const std::string& ruta, const std::vector<char>& datos, const std::size_t cantidad) {
+        std::ofstream(ruta, std::ios::binary).write(datos.data(), static_cast<std::streamsize>(cantidad));
+    }
+
+    bool rechaza(Inventario& inventario, const std::string& ruta) {
+        try {
+            inventario.cargarDeArchivo(ruta);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+int main() {
+    const std::filesystem::path carpeta = std::filesystem::temp_directory_path() / "prueba_snapshot";
+    std::filesystem::create_directories(carpeta);
+    const std::string ruta = (carpeta / "inventario.bin").string();
+    const std::string danado = (carpeta / "danado.bin").string();
+
+    Inventario inventario;
+    for (std::size_t i = 0; i < 5000; ++i) {
+        const auto estado = static_cast<ArticleStatus>(i % 3);
+        if (i % 3 != 0) {
+            const std::string fecha = "0" + std::to_string(1 + i % 9) + "/02/20" + std::to_string(10 + i % 14);
+            inventario.agregarArticulo(EquipoMedico("EQ" + std::to_string(i), fecha, estado,
+                                                    100.0 + static_cast<double>((i * 37) % 1000) + 0.25 * (i % 4),
+                                                    static_cast<MarcaEquipo>(i % 4), 1 + static_cast<int>(i % 9),
+                                                    "Técnico Número " + std::to_string(i % 300),
+                                                    static_cast<AreaUso>(i % 3)));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico("MB" + std::to_string(i), "01/02/2020", estado,
+                                                         100.0 + static_cast<double>((i * 13) % 1000),
+                                                         "Acero inoxidable " + std::to_string(i % 20),
+                                                         static_cast<AreaUbicacion>(i % 3)));
+        }
+    }
+    inventario.buscarPorCodigo("EQ1")->SetStatus(ArticleStatus::DAMAGED);
+    static_cast<EquipoMedico*>(inventario.buscarPorCodigo("EQ2"))->setTecnicoAsignado("Nuevo");
+    inventario.eliminarArticulo("MB3");
+
+    // Una vida útil no positiva no llega al archivo: el cargador la rechazaría
+    auto* equipo = static_cast<EquipoMedico*>(inventario.buscarPorCodigo("EQ4"));
+    const int vidaUtil = equipo->getVidaUtilAnios();
+    for (const int anios : {0, -3}) {
+        bool lanzo = false;
+        try {
+            equipo->setVidaUtilAnios(anios);
+        } catch (const std::invalid_argument&) {
+            lanzo = true;
+        }
+        COMPROBAR(lanzo && equipo->getVidaUtilAnios() == vidaUtil);
+    }
+
+    inventario.guardarEnArchivo(ruta);
+    Inventario cargado;
+    cargado.cargarDeArchivo(ruta);
+    comprobarIguales(inventario, cargado);
+
+    // Un byte alterado, un archivo truncado, vacío o ausente se rechazan
+    // sin tocar lo que ya estaba cargado
+    const std::vector<char> datos = leer(ruta);
+    COMPROBAR(datos.size() > 100);
+    for (const std::size_t posicion : {std::size_t{0}, std::size_t{9}, std::size_t{17}, std::size_t{70},
+                                       datos.size() / 2, datos.size() - 1}) {
+        std::vector<char> alterados = datos;
+        alterados[posicion] ^= 0x40;
+        escribir(danado, alterados, alterados.size());
+        COMPROBAR(rechaza(cargado, danado));
+    }
+    escribir(danado, datos, datos.size() - 3);
+    COMPROBAR(rechaza(cargado, danado));
+    escribir(danado, datos, 0);
+    COMPROBAR(rechaza(cargado, danado));
+    COMPROBAR(rechaza(cargado, (carpeta / "no_existe.bin").string()));
+    comprobarIguales(inventario, cargado);
+
+    Inventario vacio;
+    vacio.guardarEnArchivo(ruta);
+    cargado.cargarDeArchivo(ruta);
+    COMPROBAR(cargado.obtenerCantidadTotal() == 0);
+
+    std::filesystem::remove_all(carpeta);
+    return 0;
+}
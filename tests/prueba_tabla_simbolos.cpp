@@ -0,0 +1,75 @@
+/**
+ * @file prueba_tabla_simbolos.cpp
+ * @brief TablaSimbolos under concurrent interning and lock-free reads
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Writers intern overlapping sets of strings while readers resolve every
+ * published id; the texts cross several storage blocks, so readers also
+ * see blocks being added.
+ */
+
+#include "comprobar.hpp"
+#include "tabla_simbolos.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr int TEXTOS = 40000;  // más que los primeros bloques (1024, 2048, ...)
+    constexpr int ESCRITORES = 4;
+    constexpr int LECTORES = 4;
+
+    std::string texto(const int n) { return "simbolo-" + std::to_string(n); }
+}
+
+int main() {
+    TablaSimbolos tabla;
+    COMPROBAR(tabla.size() == 0);
+    COMPROBAR(tabla.buscar("nada") == TablaSimbolos::SIN_ID);
+
+    std::atomic<bool> terminado{false};
+    std::vector<std::thread> hilos;
+    // Cada escritor recorre todos los textos desde un punto distinto
+    for (int e = 0; e < ESCRITORES; ++e) {
+        hilos.emplace_back([&tabla, e] {
+            for (int i = 0; i < TEXTOS; ++i) {
+                const std::string t = texto((i + e * TEXTOS / ESCRITORES) % TEXTOS);
+                const TablaSimbolos::Id id = tabla.internar(t);
+                COMPROBAR(tabla.texto(id) == t);
+            }
+        });
+    }
+    for (int l = 0; l < LECTORES; ++l) {
+        hilos.emplace_back([&tabla, &terminado] {
+            while (!terminado.load()) {
+                const std::size_t publicados = tabla.size();
+                for (std::size_t id = publicados > 512 ? publicados - 512 : 0; id < publicados; ++id) {
+                    const std::string& t = tabla.texto(static_cast<TablaSimbolos::Id>(id));
+                    COMPROBAR(t.compare(0, 8, "simbolo-") == 0);
+                    COMPROBAR(tabla.buscar(t) == id);
+                }
+            }
+        });
+    }
+    for (int e = 0; e < ESCRITORES; ++e) hilos[static_cast<std::size_t>(e)].join();
+    terminado = true;
+    for (std::size_t h = ESCRITORES; h < hilos.size(); ++h) hilos[h].join();
+
+    // Cada texto tiene un único id y las referencias no se movieron
+    COMPROBAR(tabla.size() == TEXTOS);
+    std::vector<const std::string*> direcciones(TEXTOS);
+    for (int i = 0; i < TEXTOS; ++i) {
+        const TablaSimbolos::Id id = tabla.buscar(texto(i));
+        COMPROBAR(id < TEXTOS && tabla.texto(id) == texto(i));
+        COMPROBAR(tabla.internar(texto(i)) == id);
+        direcciones[id] = &tabla.texto(id);
+    }
+    for (int i = 0; i < 5000; ++i) tabla.internar("otro-" + std::to_string(i));
+    for (std::size_t id = 0; id < direcciones.size(); ++id) {
+        COMPROBAR(&tabla.texto(static_cast<TablaSimbolos::Id>(id)) == direcciones[id]);
+    }
+    COMPROBAR(tabla.internar("") == tabla.size() - 1 && tabla.texto(tabla.buscar("")).empty());
+    return 0;
+}
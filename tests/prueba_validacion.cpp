@@ -0,0 +1,244 @@
+/**
+ * @file prueba_validacion.cpp
+ * @brief Differential test of the hand-written validators against the std::regex checks they replaced
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Every code of up to 23 characters with one byte changed, every code of
+ * three characters over a set of boundary bytes, every DD/MM/YYYY with
+ * day and month 00-99 and years 1990-2110, and every single-byte change
+ * of a few valid dates must get the same answer from the regex reference,
+ * Articulo::IsValid*, and the batch validators. The enum codecs must
+ * accept every spelling the old parsers did, plus the few listed
+ * additions, and nothing else.
+ */
+
+#include "codec_enums.hpp"
+#include "comprobar.hpp"
+#include "validacion.hpp"
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace {
+    // Las comprobaciones anteriores de Articulo; los patrones se compilan
+    // una sola vez
+    bool codigoReferencia(const std::string& code) {
+        if (code.empty() || code.length() < 3 || code.length() > 20) return false;
+        static const std::regex pattern("^[A-Za-z0-9_-]+$");
+        return std::regex_match(code, pattern);
+    }
+
+    bool fechaReferencia(const std::string& date) {
+        if (date.length() != 10) return false;
+        static const std::regex pattern("^([0-2][0-9]|3[01])/(0[1-9]|1[0-2])/([12][0-9]{3})$");
+        if (!std::regex_match(date, pattern)) return false;
+        const int day = std::stoi(date.substr(0, 2));
+        const int month = std::stoi(date.substr(3, 2));
+        const int year = std::stoi(date.substr(6, 4));
+        if (day < 1 || day > 31 || month < 1 || month > 12) return false;
+        if (year < 2000 || year > 2099) return false;
+        if (month == 2) {
+            const bool leap = (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+            if (day > (leap ? 29 : 28)) return false;
+        } else if (month == 4 || month == 6 || month == 9 || month == 11) {
+            if (day > 30) return false;
+        }
+        return true;
+    }
+
+    std::vector<std::string> codigos;
+    std::vector<bool> codigosEsperados;
+    std::vector<std::string> fechas;
+    std::vector<bool> fechasEsperadas;
+
+    void comprobarCodigo(const std::string& codigo) {
+        const bool esperado = codigoReferencia(codigo);
+        const std::string_view vista = codigo;
+        std::uint8_t valido = 2;
+        Validacion::validarCodigos(&vista, 1, &valido);
+        COMPROBAR(Articulo::IsValidCode(codigo) == esperado);
+        COMPROBAR(Validacion::codigoValido(codigo) == esperado);
+        COMPROBAR(valido == (esperado ? 1 : 0));
+        codigos.push_back(codigo);
+        codigosEsperados.push_back(esperado);
+    }
+
+    void comprobarFecha(const std::string& fecha) {
+        const bool esperado = fechaReferencia(fecha);
+        const std::string_view vista = fecha;
+        std::uint8_t valida = 2;
+        Validacion::validarFechas(&vista, 1, &valida);
+        COMPROBAR(Articulo::IsValidDate(fecha) == esperado);
+        COMPROBAR(Validacion::fechaValida(fecha) == esperado);
+        COMPROBAR(valida == (esperado ? 1 : 0));
+        fechas.push_back(fecha);
+        fechasEsperadas.push_back(esperado);
+    }
+
+    // Toda la columna de una vez: recorre también el camino por bloques
+    template <typename Validar>
+    void comprobarLote(const std::vector<std::string>& textos, const std::vector<bool>& esperados, Validar validar) {
+        const std::vector<std::string_view> vistas(textos.begin(), textos.end());
+        std::vector<std::uint8_t> validos(vistas.size(), 2);
+        std::size_t cuantos = 0;
+        for (const bool esperado : esperados) cuantos += esperado ? 1 : 0;
+        COMPROBAR(validar(vistas.data(), vistas.size(), validos.data()) == cuantos);
+        for (std::size_t i = 0; i < vistas.size(); ++i) COMPROBAR(validos[i] == (esperados[i] ? 1 : 0));
+    }
+
+    void comprobarCodecs() {
+        using MedicalInventory::Domain::ArticleStatus;
+        using MedicalInventory::Domain::ArticleType;
+        // Tipos y estados: lo que aceptaban los parsers anteriores, en
+        // cualquier combinación de mayúsculas ASCII
+        for (const char* texto : {"medical equipment", "Medical Equipment", "MEDICAL EQUIPMENT", "equipo_medico",
+                                  "Equipo médico", "equipment", "EQUIPMENT"}) {
+            COMPROBAR(Articulo::StringToType(texto) == ArticleType::MEDICAL_EQUIPMENT);
+        }
+        for (const char* texto : {"clinical furniture", "Clinical Furniture", "MOBILIARIO_CLINICO", "mobiliario clínico",
+                                  "Furniture"}) {
+            COMPROBAR(Articulo::StringToType(texto) == ArticleType::CLINICAL_FURNITURE);
+        }
+        for (const char* texto : {"operational", "Operational", "OPERATIVO"}) {
+            COMPROBAR(Articulo::StringToStatus(texto) == ArticleStatus::OPERATIONAL);
+        }
+        for (const char* texto : {"under review", "Under Review", "en revisión", "En Revision", "EN_REVISION"}) {
+            COMPROBAR(Articulo::StringToStatus(texto) == ArticleStatus::UNDER_REVIEW);
+        }
+        for (const char* texto : {"damaged", "Damaged", "dañado", "DANADO"}) {
+            COMPROBAR(Articulo::StringToStatus(texto) == ArticleStatus::DAMAGED);
+        }
+        // Añadidos: nombre del enumerador y formas sin tilde
+        for (const char* texto : {"medical_equipment", "equipo medico"}) {
+            COMPROBAR(Articulo::StringToType(texto) == ArticleType::MEDICAL_EQUIPMENT);
+        }
+        for (const char* texto : {"clinical_furniture", "mobiliario clinico"}) {
+            COMPROBAR(Articulo::StringToType(texto) == ArticleType::CLINICAL_FURNITURE);
+        }
+        COMPROBAR(Articulo::StringToStatus("UNDER_REVIEW") == ArticleStatus::UNDER_REVIEW);
+        for (const char* texto : {"dañada", "medical", "", "operational "}) {
+            ArticleStatus estado{};
+            ArticleType tipo{};
+            COMPROBAR(!CodecEnums::ESTADO.parsear(texto, estado) && !CodecEnums::TIPO.parsear(texto, tipo));
+        }
+
+        // Marcas: grafía exacta como antes; el resto sigue siendo OTROS
+        COMPROBAR(EquipoMedico::stringToMarca("Philips") == MarcaEquipo::PHILIPS);
+        COMPROBAR(EquipoMedico::stringToMarca("PHILIPS") == MarcaEquipo::PHILIPS);
+        COMPROBAR(EquipoMedico::stringToMarca("GE") == MarcaEquipo::GE);
+        COMPROBAR(EquipoMedico::stringToMarca("Mindray") == MarcaEquipo::MINDRAY);
+        COMPROBAR(EquipoMedico::stringToMarca("MINDRAY") == MarcaEquipo::MINDRAY);
+        for (const char* texto : {"philips", "ge", "Ge", "mindray", "Siemens", ""}) {
+            COMPROBAR(EquipoMedico::stringToMarca(texto) == MarcaEquipo::OTROS);
+        }
+        MarcaEquipo marca{};
+        COMPROBAR(CodecEnums::MARCA.parsear("Otros", marca) && marca == MarcaEquipo::OTROS);
+        COMPROBAR(CodecEnums::MARCA.parsear("OTROS", marca) && marca == MarcaEquipo::OTROS);
+        for (const char* texto : {"otros", "other", "others", "philips"}) {
+            COMPROBAR(!CodecEnums::MARCA.parsear(texto, marca));
+        }
+
+        // Áreas de uso: grafía exacta; lo desconocido sigue siendo EMERGENCIA
+        COMPROBAR(EquipoMedico::stringToArea("Pediatría") == AreaUso::PEDIATRIA);
+        COMPROBAR(EquipoMedico::stringToArea("PEDIATRIA") == AreaUso::PEDIATRIA);
+        COMPROBAR(EquipoMedico::stringToArea("Pediatria") == AreaUso::PEDIATRIA);
+        COMPROBAR(EquipoMedico::stringToArea("Quirófano") == AreaUso::QUIROFANO);
+        COMPROBAR(EquipoMedico::stringToArea("QUIROFANO") == AreaUso::QUIROFANO);
+        COMPROBAR(EquipoMedico::stringToArea("Quirofano") == AreaUso::QUIROFANO);
+        for (const char* texto : {"pediatria", "quirófano", "surgery", "operating room", "pediatrics"}) {
+            COMPROBAR(EquipoMedico::stringToArea(texto) == AreaUso::EMERGENCIA);
+        }
+        AreaUso area{};
+        for (const char* texto : {"emergencia", "emergency", "surgery", "pediatrics"}) {
+            COMPROBAR(!CodecEnums::AREA_USO.parsear(texto, area));
+        }
+
+        // Áreas de ubicación: grafía exacta o invalid_argument
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("Consulta") == AreaUbicacion::CONSULTA);
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("CONSULTA") == AreaUbicacion::CONSULTA);
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("Emergencia") == AreaUbicacion::EMERGENCIA);
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("EMERGENCIA") == AreaUbicacion::EMERGENCIA);
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("Quirófano") == AreaUbicacion::QUIROFANO);
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("QUIROFANO") == AreaUbicacion::QUIROFANO);
+        COMPROBAR(MobiliarioClinico::stringToAreaUbicacion("Quirofano") == AreaUbicacion::QUIROFANO);
+        for (const char* texto : {"consulta", "consultation", "outpatient", "emergency", "surgery", "quirofano"}) {
+            bool lanzo = false;
+            try {
+                MobiliarioClinico::stringToAreaUbicacion(texto);
+            } catch (const std::invalid_argument&) {
+                lanzo = true;
+            }
+            COMPROBAR(lanzo);
+        }
+
+        // Los nombres que se muestran se vuelven a leer igual
+        for (std::size_t i = 0; i < CodecEnums::MARCA.cantidad(); ++i) {
+            COMPROBAR(EquipoMedico::stringToMarca(CodecEnums::MARCA.nombre(static_cast<MarcaEquipo>(i))) ==
+                      static_cast<MarcaEquipo>(i));
+        }
+        for (std::size_t i = 0; i < CodecEnums::AREA_UBICACION.cantidad(); ++i) {
+            const auto valor = static_cast<AreaUbicacion>(i);
+            COMPROBAR(MobiliarioClinico::stringToAreaUbicacion(CodecEnums::AREA_UBICACION.nombre(valor)) == valor);
+        }
+    }
+}
+
+int main() {
+    comprobarCodecs();
+    for (std::size_t largo = 0; largo <= 23; ++largo) {
+        const std::string base(largo, 'a');
+        comprobarCodigo(base);
+        for (std::size_t posicion = 0; posicion < largo; ++posicion) {
+            for (int byte = 0; byte < 256; ++byte) {
+                std::string codigo = base;
+                codigo[posicion] = static_cast<char>(byte);
+                comprobarCodigo(codigo);
+            }
+        }
+    }
+    std::string bordes = "09AZaz_-/:@[`{ \x7f\x80\xff";
+    bordes.push_back('\0');
+    for (const char a : bordes) {
+        for (const char b : bordes) {
+            for (const char c : bordes) comprobarCodigo(std::string{a, b, c});
+        }
+    }
+
+    char texto[16];
+    for (int dia = 0; dia < 100; ++dia) {
+        for (int mes = 0; mes < 100; ++mes) {
+            for (int anio = 1990; anio <= 2110; ++anio) {
+                std::snprintf(texto, sizeof texto, "%02d/%02d/%04d", dia, mes, anio);
+                comprobarFecha(texto);
+            }
+        }
+    }
+    for (int anio = 0; anio < 10000; anio += 7) {
+        std::snprintf(texto, sizeof texto, "29/02/%04d", anio);
+        comprobarFecha(texto);
+    }
+    for (const char* base : {"29/02/2024", "31/12/2099", "01/01/2000", "15/06/2050"}) {
+        for (std::size_t posicion = 0; posicion < 10; ++posicion) {
+            for (int byte = 0; byte < 256; ++byte) {
+                std::string fecha = base;
+                fecha[posicion] = static_cast<char>(byte);
+                comprobarFecha(fecha);
+            }
+        }
+    }
+    for (std::size_t largo = 0; largo <= 12; ++largo) {
+        comprobarFecha(std::string(largo, '1'));
+        comprobarFecha(std::string("01/01/2020").substr(0, std::min<std::size_t>(largo, 10)) +
+                       std::string(largo > 10 ? largo - 10 : 0, '0'));
+    }
+
+    comprobarLote(codigos, codigosEsperados, Validacion::validarCodigos);
+    comprobarLote(fechas, fechasEsperadas, Validacion::validarFechas);
+
+    static_assert(Validacion::fechaValida("29/02/2024") && !Validacion::fechaValida("29/02/2023") &&
+                  Validacion::codigoValido("EQ-001"));
+    std::printf("%zu códigos y %zu fechas iguales a la referencia\n", codigos.size(), fechas.size());
+    return 0;
+}
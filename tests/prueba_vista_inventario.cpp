@@ -0,0 +1,191 @@
+/**
+ * @file prueba_vista_inventario.cpp
+ * @brief VistaInventario over a mapped snapshot (and its delta) against the Inventario that wrote it
+ * @author Medical Inventory Team
+ * @date 2025
+ *
+ * Every record, lookup, filter, grouping and aggregate of the view must
+ * match the inventory, serially and with the parallel scan, before and
+ * after an incremental save with changes, additions and removals. A view
+ * keeps reading the file it opened after the snapshot is replaced, and
+ * missing or truncated files are rejected.
+ */
+
+#include "comprobar.hpp"
+#include "inventario.hpp"
+#include "vista_inventario.hpp"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MedicalInventory::Domain::ArticleStatus;
+using MedicalInventory::Domain::ArticleType;
+
+namespace {
+    constexpr int ARTICULOS = 3000;
+
+    std::string codigo(const int n) { return (n % 2 != 0 ? "EQ-" : "MB-") + std::to_string(n); }
+
+    void agregar(Inventario& inventario, const int n) {
+        const auto estado = static_cast<ArticleStatus>(n % 3);
+        const std::string fecha = "1" + std::to_string(n % 9) + "/0" + std::to_string(1 + n % 9) + "/20" +
+                                  std::to_string(10 + n % 15);
+        if (n % 2 != 0) {
+            inventario.agregarArticulo(EquipoMedico(codigo(n), fecha, estado, 100.0 + n % 997 + 0.25 * (n % 4),
+                                                    static_cast<MarcaEquipo>(n % 4), 1 + n % 12,
+                                                    "Técnico " + std::to_string(n % 23), static_cast<AreaUso>(n % 3)));
+        } else {
+            inventario.agregarArticulo(MobiliarioClinico(codigo(n), fecha, estado, 20.0 + n % 301,
+                                                         "Material " + std::to_string(n % 6),
+                                                         static_cast<AreaUbicacion>(n % 3)));
+        }
+    }
+
+    bool cerca(const double a, const double b) { return std::fabs(a - b) <= 1e-9 * (1.0 + std::fabs(a)); }
+
+    void compararArticulo(const ArticuloVista& vista, const Articulo& articulo, const FechaCorte& corte) {
+        COMPROBAR(vista.GetCode() == articulo.GetCode() && vista.GetType() == articulo.GetType());
+        COMPROBAR(vista.GetStatus() == articulo.GetStatus() && vista.GetUnitCost() == articulo.GetUnitCost());
+        COMPROBAR(vista.GetEntryDate() == articulo.GetEntryDate() && vista.GetEntryDay() == articulo.GetEntryDay());
+        if (vista.esEquipo()) {
+            const auto& equipo = static_cast<const EquipoMedico&>(articulo);
+            COMPROBAR(vista.getMarca() == equipo.getMarca() && vista.getAreaUso() == equipo.getAreaUso());
+            COMPROBAR(vista.getVidaUtilAnios() == equipo.getVidaUtilAnios());
+            COMPROBAR(vista.getTecnicoAsignado() == equipo.getTecnicoAsignado());
+            COMPROBAR(vista.CalculateTotalCost(corte) == equipo.CalculateTotalCost(corte));
+        } else {
+            const auto& mueble = static_cast<const MobiliarioClinico&>(articulo);
+            COMPROBAR(vista.getMaterial() == mueble.getMaterial());
+            COMPROBAR(vista.getAreaUbicacion() == mueble.getAreaUbicacion());
+            COMPROBAR(vista.calcularValorConPlus() == mueble.calcularValorConPlus());
+        }
+    }
+
+    // Mismos artículos, en el mismo orden de slot
+    template <typename Lista>
+    void compararLista(const std::vector<ArticuloVista>& vista, const Lista& articulos) {
+        COMPROBAR(vista.size() == articulos.size());
+        for (std::size_t i = 0; i < vista.size(); ++i) COMPROBAR(vista[i].GetCode() == articulos[i]->GetCode());
+    }
+
+    void comparar(const VistaInventario& vista, const Inventario& inventario) {
+        const FechaCorte& corte = inventario.obtenerFechaCorte();
+        const std::vector<Articulo*> articulos = inventario.obtenerTodosLosArticulos();
+        COMPROBAR(vista.obtenerCantidadTotal() == articulos.size());
+        for (std::uint32_t slot = 0; slot < articulos.size(); ++slot) {
+            const ArticuloVista registro = vista.articulo(slot);
+            COMPROBAR(registro.GetSlot() == slot);
+            compararArticulo(registro, *articulos[slot], corte);
+            const std::optional<ArticuloVista> buscado = vista.buscarPorCodigo(articulos[slot]->GetCode());
+            COMPROBAR(buscado && buscado->GetSlot() == slot);
+        }
+        COMPROBAR(!vista.buscarPorCodigo("NO-EXISTE") && !vista.existeCodigo(""));
+
+        for (const ArticleStatus estado : {ArticleStatus::OPERATIONAL, ArticleStatus::UNDER_REVIEW, ArticleStatus::DAMAGED}) {
+            compararLista(vista.filtrarPorEstado(estado), inventario.filtrarPorEstado(estado));
+            COMPROBAR(vista.obtenerCantidadPorEstado(estado) == inventario.obtenerCantidadPorEstado(estado));
+            COMPROBAR(cerca(vista.calcularCostoTotalPorEstado(estado), inventario.calcularCostoTotalPorEstado(estado)));
+        }
+        for (const ArticleType tipo : {ArticleType::MEDICAL_EQUIPMENT, ArticleType::CLINICAL_FURNITURE}) {
+            compararLista(vista.filtrarPorTipo(tipo), inventario.filtrarPorTipo(tipo));
+            COMPROBAR(vista.obtenerCantidadPorTipo(tipo) == inventario.obtenerCantidadPorTipo(tipo));
+            COMPROBAR(cerca(vista.calcularCostoTotalPorCategoria(tipo), inventario.calcularCostoTotalPorCategoria(tipo)));
+        }
+        compararLista(vista.obtenerArticulosDanados(), inventario.filtrarPorEstado(ArticleStatus::DAMAGED));
+        const auto grupos = vista.agruparEquiposPorMarcaYArea();
+        const auto esperados = inventario.agruparEquiposPorMarcaYArea();
+        COMPROBAR(grupos.size() == esperados.size());
+        for (const auto& [clave, grupo] : esperados) {
+            const auto encontrado = grupos.find(clave);
+            COMPROBAR(encontrado != grupos.end());
+            compararLista(encontrado->second, grupo);
+        }
+        COMPROBAR(vista.contarEquiposPorTecnico() == inventario.contarEquiposPorTecnico());
+        COMPROBAR(vista.contarEquiposPorArea() == inventario.contarEquiposPorArea());
+        COMPROBAR(vista.contarMobiliarioPorArea() == inventario.contarMobiliarioPorArea());
+        const auto costos = vista.calcularCostosPorCategoria();
+        for (const auto& [tipo, costo] : inventario.calcularCostosPorCategoria()) COMPROBAR(cerca(costos.at(tipo), costo));
+        COMPROBAR(vista.obtenerCostosMinMax() == inventario.obtenerCostosMinMax());
+        COMPROBAR(cerca(vista.calcularDepreciacionTotal(), inventario.calcularDepreciacionTotal()));
+    }
+
+    // En serie y repartido entre hilos
+    void compararSiempre(const std::string& ruta, const Inventario& inventario) {
+        VistaInventario vista(ruta);
+        vista.actualizarFechaCorte(inventario.obtenerFechaCorte());
+        comparar(vista, inventario);
+        vista.configurarUmbralParalelo(0);
+        comparar(vista, inventario);
+    }
+
+    bool rechaza(const std::string& ruta) {
+        try {
+            VistaInventario vista(ruta);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+int main() {
+    const std::filesystem::path carpeta = std::filesystem::temp_directory_path() / "prueba_vista_inventario";
+    std::filesystem::create_directories(carpeta);
+    const std::string ruta = (carpeta / "inventario.bin").string();
+
+    Inventario inventario;
+    inventario.actualizarFechaCorte(FechaCorte::Desde(Fecha::diasDesdeCivil(2026, 3, 15)));
+    for (int n = 0; n < ARTICULOS; ++n) agregar(inventario, n);
+    inventario.fusionarCambios(ruta);
+    compararSiempre(ruta, inventario);
+
+    VistaInventario vista(ruta);
+    bool fuera = false;
+    try {
+        vista.articulo(static_cast<std::uint32_t>(ARTICULOS));
+    } catch (const std::out_of_range&) {
+        fuera = true;
+    }
+    COMPROBAR(fuera);
+
+    // Con un delta encima: cambios, altas y bajas que mueven el último slot
+    for (int n = 0; n < 200; n += 3) inventario.buscarPorCodigo(codigo(n))->SetStatus(ArticleStatus::DAMAGED);
+    static_cast<EquipoMedico*>(inventario.buscarPorCodigo(codigo(11)))->setTecnicoAsignado("Turno de noche");
+    static_cast<MobiliarioClinico*>(inventario.buscarPorCodigo(codigo(12)))->setMaterial("Madera");
+    inventario.buscarPorCodigo(codigo(13))->SetUnitCost(999999.0);
+    for (int n = 100; n < 130; ++n) inventario.eliminarArticulo(codigo(n));
+    for (int n = ARTICULOS; n < ARTICULOS + 40; ++n) agregar(inventario, n);
+    inventario.guardarCambios(ruta);
+    COMPROBAR(std::filesystem::exists(SnapshotInventario::rutaDelta(ruta)));
+    compararSiempre(ruta, inventario);
+    COMPROBAR(!VistaInventario(ruta).existeCodigo(codigo(100)));
+
+    // La vista abierta antes sigue leyendo su archivo aunque se reemplace
+    Inventario anterior;
+    anterior.cargarDeArchivo(ruta);
+    VistaInventario abierta(ruta);
+    abierta.actualizarFechaCorte(inventario.obtenerFechaCorte());
+    anterior.actualizarFechaCorte(inventario.obtenerFechaCorte());
+    for (int n = 200; n < 400; ++n) inventario.eliminarArticulo(codigo(n));
+    inventario.fusionarCambios(ruta);
+    comparar(abierta, anterior);
+    compararSiempre(ruta, inventario);
+
+    // Archivo ausente o truncado
+    std::vector<char> datos;
+    {
+        std::ifstream archivo(ruta, std::ios::binary);
+        datos.assign(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+    }
+    const std::string truncado = (carpeta / "truncado.bin").string();
+    std::ofstream(truncado, std::ios::binary).write(datos.data(), static_cast<std::streamsize>(datos.size() / 2));
+    COMPROBAR(rechaza(truncado));
+    COMPROBAR(rechaza((carpeta / "no_existe.bin").string()));
+
+    std::filesystem::remove_all(carpeta);
+    return 0;
+}